@@ -225,3 +225,21 @@ int segwit_addr_decode(int* witver, uint8_t* witdata, size_t* witdata_len, const
   *witver = data[0];
   return 1;
 }
+
+int bech32_encode_bytes(char *output, const char *hrp, const uint8_t *data, size_t data_len) {
+  uint8_t data5[84];
+  size_t data5_len = 0;
+  if (data_len > 50) return 0;
+  convert_bits(data5, &data5_len, 5, data, data_len, 8, 1);
+  return bech32_encode(output, hrp, data5, data5_len);
+}
+
+int bech32_decode_bytes(uint8_t *data, size_t *data_len, const char *hrp, const char *input) {
+  uint8_t data5[84];
+  char hrp_actual[84];
+  size_t data5_len;
+  if (!bech32_decode(hrp_actual, data5, &data5_len, input)) return 0;
+  if (strncmp(hrp, hrp_actual, 84) != 0) return 0;
+  *data_len = 0;
+  return convert_bits(data, data_len, 8, data5, data5_len, 5, 0);
+}
@@ -100,4 +100,13 @@ int bech32_decode(
 
 int bech32_decode_nocheck(uint8_t *data, size_t *data_len, const char *input);
 
+/** Encode/Decode bytes (no witness version) as a Bech32 string (e.g. npub)
+ *  Returns 1 if successful.
+ */
+int bech32_encode_bytes(char *output, const char *hrp, const uint8_t *data, size_t data_len);
+int bech32_decode_bytes(uint8_t *data, size_t *data_len, const char *hrp, const char *input);
+
+/** One step of the Bech32 checksum (BCH code) computation */
+uint32_t bech32_polymod_step(uint32_t pre);
+
 #endif
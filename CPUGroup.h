@@ -0,0 +1,1034 @@
+// File generated by VanitySearch::GenerateCode()
+// CPU GROUP definitions
+#define CPU_GRP_GEN_SIZE 1024
+
+// SecpK1 Generator table (Contains G,2G,3G,...,(CPU_GRP_SIZE/2 )G)
+static const uint64_t cpuGx[][4] = {
+  {0x59f2815b16f81798ULL,0x29bfcdb2dce28d9ULL,0x55a06295ce870b07ULL,0x79be667ef9dcbbacULL},
+  {0xabac09b95c709ee5ULL,0x5c778e4b8cef3ca7ULL,0x3045406e95c07cd8ULL,0xc6047f9441ed7d6dULL},
+  {0x8601f113bce036f9ULL,0xb531c845836f99b0ULL,0x49344f85f89d5229ULL,0xf9308a019258c310ULL},
+  {0x74fa94abe8c4cd13ULL,0xcc6c13900ee07584ULL,0x581e4904930b1404ULL,0xe493dbf1c10d80f3ULL},
+  {0xcba8d569b240efe4ULL,0xe88b84bddc619ab7ULL,0x55b4a7250a5c5128ULL,0x2f8bde4d1a072093ULL},
+  {0x2f057a1460297556ULL,0x82f6472f8568a18bULL,0x20453a14355235d3ULL,0xfff97bd5755eeea4ULL},
+  {0xe92bddedcac4f9bcULL,0x3d419b7e0330e39cULL,0xa398f365f2ea7a0eULL,0x5cbdf0646e5db4eaULL},
+  {0x67784ef3e10a2a01ULL,0xa1bdd05e5af888aULL,0xaff3843fb70f3c2fULL,0x2f01e5e15cca351dULL},
+  {0xc35f110dfc27ccbeULL,0xe09796974c57e714ULL,0x9ad178a9f559abdULL,0xacd484e2f0c7f653ULL},
+  {0x52a68e2a47e247c7ULL,0x3442d49b1943c2b7ULL,0x35477c7b1ae6ae5dULL,0xa0434d9e47f3c862ULL},
+  {0xbbec17895da008cbULL,0x5649980be5c17891ULL,0x5ef4246b70c65aacULL,0x774ae7f858a9411eULL},
+  {0xc5b0f47070afe85aULL,0x687cf4419620095bULL,0x15c38f004d734633ULL,0xd01115d548e7561bULL},
+  {0xdeeddf8f19405aa8ULL,0xb075fbc6610e58cdULL,0xc7d1d205c3748651ULL,0xf28773c2d975288bULL},
+  {0xe49b241a60e823e4ULL,0x26aa7b63678949e6ULL,0xfd64e67f07d38e32ULL,0x499fdf9e895e719cULL},
+  {0x44adbcf8e27e080eULL,0x31e5946f3c85f79eULL,0x5a465ae3095ff411ULL,0xd7924d4f7d43ea96ULL},
+  {0xc44ee89e2a6dec0aULL,0xb2a31369b87a5ae9ULL,0x3011aabc21c23e97ULL,0xe60fce93b59e9ec5ULL},
+  {0x66e4faa04a2d4a34ULL,0xeb9898ae79b97687ULL,0xa420fee807eacf21ULL,0xdefdea4cdb677750ULL},
+  {0xcf55c2a2444da7ccULL,0xf3ba28d1a319f5e7ULL,0x2b0286db4a990fa0ULL,0x5601570cb47f238dULL},
+  {0x7475656138385b6cULL,0xf06acfebd7e86d27ULL,0x93ef5cff444f4979ULL,0x2b4ea0a797a443d2ULL},
+  {0xf3e471b273211c97ULL,0xf02d5290aff74b03ULL,0x200b559b2f7dd5a5ULL,0x4ce119c96e2fa357ULL},
+  {0x81340aef25be59d5ULL,0x1d9ad40271f81071ULL,0x4f93fa332ce33330ULL,0x352bbf4a4cdd1256ULL},
+  {0x99ddcb316f31e9fcULL,0x2431741c72713b4bULL,0x5c96fdb91c0c1e2fULL,0x421f5fc9a2106544ULL},
+  {0xdc9cdadd4ecacc3fULL,0xe42ab8dfeff5ff29ULL,0x230010559879124ULL,0x2fa2104d6b38d11bULL},
+  {0x502bda8b202e6ceULL,0x683215439d62b794ULL,0x8ac09c9161ba8b09ULL,0xfe72c435413d33d4ULL},
+  {0x69ca0cd7f5453714ULL,0x263c3d84e09572e2ULL,0xab21a9b066edda83ULL,0x9248279b09b4d68dULL},
+  {0x5e5cad81710c4c8aULL,0xc03fe1b2abb84088ULL,0xf40cbdefc8e40997ULL,0x6687cdb5b650d558ULL},
+  {0x7e996d443dee8729ULL,0x2f570e144bf615c0ULL,0x8e70132fb0beb752ULL,0xdaed4f2be3a8bf27ULL},
+  {0xc39a66f904f97968ULL,0x6b31536da6eb344dULL,0xa7fa6f64d5dc3c82ULL,0x55eb67d7b7238a70ULL},
+  {0xe6a3b5e87d22e7dbULL,0x11ecd9e9fdf281b0ULL,0x8acf28d7cbb19f90ULL,0xc44d12c7065d812eULL},
+  {0x7513a49d9a688a00ULL,0x1ccfff21574de092ULL,0xb69fc311a03f864ULL,0x6d2b085e9e382ed1ULL},
+  {0xb61c65cbd269e6b4ULL,0x152b695336c28063ULL,0xc89a20cfded60853ULL,0x6a245bf6dc698504ULL},
+  {0x75d0dbd407143e65ULL,0xdacffcb89904a61dULL,0x47b6e054e2f378ceULL,0xd30199d74fb5a22dULL},
+  {0xf95ae57f0d0bd6a5ULL,0xce13300b0bec1146ULL,0xc077e3d2fe541084ULL,0x1697ffa6fd9de627ULL},
+  {0x32e8b4da0547fc11ULL,0x31d611b96c358b60ULL,0xd0e80d468c344ba3ULL,0x1be68a5a028f2601ULL},
+  {0xf982345ef27a7479ULL,0x9deb8360ffb7f61dULL,0x986d0f07e834cb0dULL,0x605bdb019981718bULL},
+  {0xc899da20f0198f9ULL,0x5d5fefe3388f85d9ULL,0xb56c563e3e5e67aULL,0xe0392cfa338aaf2fULL},
+  {0xfe31c7e9d87ff33dULL,0xdcb01c354959b10cULL,0x7402fdc45a215e10ULL,0x62d14dab4150bf49ULL},
+  {0x69cd5fdf1691fff7ULL,0x38e2e1fc705821eaULL,0xa88ac16c7d80bffdULL,0xb699a30e6e184cdfULL},
+  {0x5e555c2f86308b6fULL,0x2c50e9f56b9b8b42ULL,0xde5b4b06c408e56bULL,0x80c60ad0040f27daULL},
+  {0xf1929141bb0b4d0bULL,0xeacf59a33d99cd9ULL,0x9f0e21203041bf08ULL,0x91de2f6bb67b1113ULL},
+  {0x9d5eabb0fa03c8fbULL,0x4cc5dc9487d84704ULL,0xaa74c6348cc54d34ULL,0x7a9375ad6167ad54ULL},
+  {0xc18ed3a3c86ce1afULL,0x9cb5e65cee430558ULL,0x1db5833ff5f2226dULL,0xfe8d1eb1bcb3432bULL},
+  {0x4bb51f459bc3ffc9ULL,0xbb408ec39b68df50ULL,0x907a9ed045447a79ULL,0xd528ecd9b696b54cULL},
+  {0xe06b70a9b3834765ULL,0x60c180165d971a61ULL,0x541514731622af8dULL,0x5d045857332d5b9eULL},
+  {0x87231808f8b45963ULL,0x5266115e4a7ecb13ULL,0xea25f514e8ecdad0ULL,0x49370a4b5f43412ULL},
+  {0xc16baedc90235717ULL,0x980fdde9c7e85701ULL,0xf903b3d100e3950dULL,0xf8b0b03d44112259ULL},
+  {0xf1c13eb1fc345d74ULL,0x881d811e0e1498e2ULL,0xd73df930d64702efULL,0x77f230936ee88cbbULL},
+  {0x9bd870aa1118e5c3ULL,0xfc579b27452bebc1ULL,0xb441656ef4e65b4bULL,0x6eca335d9645307dULL},
+  {0xeb28531b7739f530ULL,0x58c80074ab9d4dbaULL,0xea44887e5c7c0bceULL,0xf2dac991cc4ce4b9ULL},
+  {0x7e8fde79bd559a9aULL,0x50bc64404230e7a6ULL,0xd5f1774aefa8f02eULL,0x29757774cc6f3be1ULL},
+  {0xbcba4850c690d45bULL,0x5a216cdfc9dae3deULL,0x1b4be8fbbe252012ULL,0x463b3d9f662621fbULL},
+  {0xca731921025ff695ULL,0x7d36cfc8814c1b29ULL,0x294339ca3da761fULL,0x2b22efda32491a9eULL},
+  {0xa32496b49998f247ULL,0x6b98fac14328a2d1ULL,0x9232d4aff3b5997ULL,0xf16f804244e46e2aULL},
+  {0x249971067c1d506bULL,0x3447be24500ca7a5ULL,0x1c8331fd47a2e5ffULL,0x4fdcb8fa639cee44ULL},
+  {0x369e15f7151d41d1ULL,0x5d245315ace27c65ULL,0xb0352b7a14311af5ULL,0xcaf754272dc84563ULL},
+  {0x48894a2bd3460117ULL,0xafe5fd8d103f827eULL,0x27740c2bbff05b6aULL,0xbce74de6d5f98dc0ULL},
+  {0x24497bc86f082120ULL,0x44a09c07cb86d7c1ULL,0xf85d0f1709979d8bULL,0x2600ca4b282cb986ULL},
+  {0x742b761c49b46d3bULL,0x764c1ef4094ee4b6ULL,0x1540cbc9bf962cf4ULL,0x45562f033698facaULL},
+  {0xc602a7746998e435ULL,0x1c48685e24f7dc8ULL,0x338ec53cd12220bcULL,0x7635ca72d7e8432cULL},
+  {0xd2acfc4d5fb8c192ULL,0x350c778ac8a30e57ULL,0x8fe0cf28ff1d8822ULL,0x1257e93a78a5b7dULL},
+  {0xc1a50743bf56cc18ULL,0xb7f2b33479d468fbULL,0xdbbf4a87deee8a66ULL,0x754e3239f325570cULL},
+  {0xbf07f6894c04f299ULL,0x3c4d66a91706edecULL,0x84a271333f7fbd04ULL,0x108443b948d15535ULL},
+  {0x9fe2694691d9b9e8ULL,0x330800661d1c952fULL,0xff57859c82d570f0ULL,0xe3e6bd1071a1e96aULL},
+  {0xe37918e6f874ef8bULL,0xfc4c6f1dcdbafd81ULL,0xb1051eaf832823cULL,0xbf23c1542d16eab7ULL},
+  {0x4cc47fdcf04aa6ebULL,0xc4ccb1f32ba35f4bULL,0x26ae73d88f732985ULL,0x186b483d056a0338ULL},
+  {0x7b54d781ff03d722ULL,0x3a5b3abcd29189bfULL,0xe3a7b7b92b6c439fULL,0x79264c4b4bfcd7fULL},
+  {0x1a8321724ce0963fULL,0x5442e6d2b737d9c9ULL,0x44c98561f4be4f72ULL,0xdf9d70a6b9876ce5ULL},
+  {0x980bb7b87c78b8e9ULL,0x4b795b416e702c1cULL,0xb673bacb5cb7ca55ULL,0x70e6b44a2ac6083aULL},
+  {0x5de64c5f34ce7143ULL,0xab52554f849ed899ULL,0x497ca815d5dce0f8ULL,0x5edd5cc23c51e87aULL},
+  {0xf959c495a3be5440ULL,0x1fb66f6861c84a35ULL,0x4f1420dd3b90d344ULL,0xc00be8830995d1e4ULL},
+  {0x722d362f84614fbaULL,0x7aa3fba1c355b17aULL,0xda12fe02287e9e77ULL,0x290798c2b6476830ULL},
+  {0x659032865ff5154cULL,0x1e988d693df4a1fbULL,0xecb4b17f84f42d8cULL,0xa8f2c94e19d9d829ULL},
+  {0x62dfdecef4053b45ULL,0xcd29552fe3602573ULL,0x54754efa150ac39ULL,0xaf3c423a95d9f5b3ULL},
+  {0x6e37b93c5c478840ULL,0xfd6b072c4fbb8d47ULL,0x9c052cebbfbb7e9dULL,0x2773840fcf4e9e45ULL},
+  {0x8d2fed50d884249aULL,0x6bb66b26dcf98dfULL,0xcccaa28c99bf2749ULL,0x766dbb24d134e745ULL},
+  {0x3fe397c5b3300b23ULL,0xac44bd64c7bae07cULL,0x278d0d7420a88df0ULL,0x96516a8f65774275ULL},
+  {0xce92e666191abe3eULL,0x45f7b44f6c596a58ULL,0xa21277c33784f416ULL,0x59dbf46f8c94759bULL},
+  {0xbb3d3d987058c8aeULL,0xe7e555bd9114950ULL,0x7efe354db9f95fe7ULL,0x2ddf7bbcfe114e80ULL},
+  {0xb62dc6018cfd87b8ULL,0xdd647e711a95e73cULL,0x305e691e74e9a4a8ULL,0xf13ada95103c4537ULL},
+  {0xecd31e14f87f62eULL,0x10e6e63863716127ULL,0xd7c744ed34659f0ULL,0xe9623bbef1bf90ecULL},
+  {0x488550015a88522cULL,0xda1869c06ebadfb6ULL,0x6d4167a2c59cca4cULL,0x7754b4fa0e8aced0ULL},
+  {0x9e594fecc13b59dfULL,0xbe89b397b454c8b5ULL,0xa37c28e771c6cb4ULL,0xe35bc6bb1b05b213ULL},
+  {0xa6828c99e2262519ULL,0x1858f95de8041d2ULL,0xaa3874d46abef9d7ULL,0x948dcadf5990e048ULL},
+  {0xe5626baaf6812379ULL,0xa1ecdbabdcfccd39ULL,0xd3330a7f05a58614ULL,0x87c01e27d84da2dbULL},
+  {0x70328a8a3d7c77abULL,0xfb224cf5ac0bfa15ULL,0x89c7b48f8202ec37ULL,0x7962414450c76c16ULL},
+  {0xe4749682de46eeacULL,0x9de2d0e222575f22ULL,0x70fb906bced4409ULL,0x497c83c39c76e56dULL},
+  {0xb0dd085137ec47caULL,0x5a16977225b8847bULL,0xb15b160644d91548ULL,0x3514087834964b54ULL},
+  {0xf7086353a80c44feULL,0x16d1cfda1b054da5ULL,0x3d81d3e1ef66cdabULL,0xa8af384e794930e6ULL},
+  {0x42943d3f7b527eafULL,0x93e947eb8df787b4ULL,0xc79ce2c9dd8bc549ULL,0xd3cc30ad6b483e4bULL},
+  {0x2af2e606110cc919ULL,0x216cbbc90d97aed6ULL,0xfe540e4b0664410fULL,0xeb49fd9f510469f4ULL},
+  {0x3975ba0ff4847610ULL,0x2b29823db913f649ULL,0xce1c78fcbfefe08bULL,0x1624d84780732860ULL},
+  {0xf6639d49c8704818ULL,0xd3a6172d6511c68bULL,0xb435db84a21605a7ULL,0xde1d35cbc6308cc5ULL},
+  {0x6df7b4fd5fc61cd4ULL,0x5192474b5af207daULL,0x6902c95633e62a98ULL,0x733ce80da955a8a2ULL},
+  {0xbf6dcd5710e682f2ULL,0xc134bcd7d6f35919ULL,0x24120ca18648961aULL,0x84df2e6e5e84cdffULL},
+  {0xef258dfab81c045cULL,0x8966c5092171e699ULL,0xcf1a1c33bbd3b49fULL,0x15d9441254945064ULL},
+  {0x43933aca7f8cb0e3ULL,0xa22eb53fe1efe3a4ULL,0x8fa64e044b2eb72eULL,0x3f0e80e574456d8fULL},
+  {0xac138599d0717940ULL,0x1c21417c9d2b8aaaULL,0xb612136e5ce70d27ULL,0xa1d0fcf2ec9de675ULL},
+  {0xd637ab63ef91e5b4ULL,0x191110fd2e9122abULL,0x39bf1c39d65f194dULL,0x4752f85486208311ULL},
+  {0xc7ca37331cb36980ULL,0xa790badee8245c06ULL,0x5780c0735f84dbe9ULL,0xe22fbe15c0af8cccULL},
+  {0x221b4cef7500f88ULL,0x3ee306b3406a2689ULL,0x2e174c835fb72bf5ULL,0xed3bace23c5e1765ULL},
+  {0x4009452246cfa9b3ULL,0x69635e394704eaa7ULL,0xee13473c1155f5fULL,0x311091dd9860e8e2ULL},
+  {0xe5d46389103c7eULL,0x74e3a1b9d30671f8ULL,0xd9bed6f42dc6a289ULL,0x3049f7ffc71d744bULL},
+  {0x1867d4232ec2dbdfULL,0x883928b45a934078ULL,0xb31c0442d3e6ac24ULL,0x34c1fd04d301be89ULL},
+  {0x203f636ee00926dcULL,0xdb0df90ecd4c9483ULL,0x1fb52a688d9d6fe6ULL,0x1880c9ad32fbb07eULL},
+  {0xcc2a5e6b049b8d63ULL,0x8d13f3abbcd08affULL,0x1c14de5b557eb42aULL,0xf219ea5d6b54701cULL},
+  {0x90c7f04f8accb725ULL,0x888043b17bcbe914ULL,0x72310db34c1e79f3ULL,0x1fc757d383e42507ULL},
+  {0x7236912469a0b448ULL,0x543a5490bca62708ULL,0xb1f683db8f45de26ULL,0xd7b8740f74a8fbaaULL},
+  {0x81c5845bb834c21eULL,0x853b0f22b8925d5dULL,0x20391cef85374576ULL,0x7e660beda020e9ccULL},
+  {0x9fe4d3091aa824bfULL,0xad5bcd32abdd9428ULL,0xf86f7c98d3a3335eULL,0x32d31c222f8f6f0eULL},
+  {0xf745ddaa42583d11ULL,0x7b00f024a9728087ULL,0xfa735fc4fcd0ab7cULL,0x3bb9aec1f1eb9ec7ULL},
+  {0x340f86cbc18347b5ULL,0x8793d77cd59592c4ULL,0x71045a155d9831eaULL,0x7461f371914ab326ULL},
+  {0xeb0aadf82a8d733cULL,0xffc274bf62fca8f9ULL,0x884a36f2080d682ULL,0xbc82dd73e5161dbaULL},
+  {0x287698bad7b2b2d6ULL,0x6d716b2c3e67453dULL,0x74356a25aa38206aULL,0xee079adb1df18600ULL},
+  {0xbd95ec557a93eab5ULL,0x88d6b130b16695e5ULL,0x93cc339096d66ad5ULL,0xb74f0c165b4a9435ULL},
+  {0x2bfd8616ba9da6b5ULL,0xe65de331874c9dc7ULL,0x467b18302ee620f7ULL,0x16ec93e447ec83f0ULL},
+  {0x9306fe7f8957f489ULL,0xef6cc374ce143846ULL,0xf81eee193a3af355ULL,0xfc6040fe245682cdULL},
+  {0x85b96065d537bd99ULL,0xd8855897f98b6aa4ULL,0x38978290afa70b6bULL,0xeaa5f980c245f6f0ULL},
+  {0x3ec1775d0fadae00ULL,0x1dc81f9c32bb84a5ULL,0x53de84833ccffdb3ULL,0xa7c0ea7395d87852ULL},
+  {0xa96c4b6b35a49f51ULL,0x58ae04877151342eULL,0x692ee1910a024399ULL,0x78c9407544ac132ULL},
+  {0x9caa00f574adc826ULL,0x89e7020e8e0becb7ULL,0xbd3ff25e9d1667faULL,0xdd5ba67cfb807824ULL},
+  {0x726578d9702857a5ULL,0x1cdc8ae7a6fc688ULL,0x16dcd838431aea00ULL,0x494f4be219a1a770ULL},
+  {0xe0a3bfda73176237ULL,0x7bf7ddaf568a5fb9ULL,0xd23f25efba0f6dd8ULL,0x139ae46a1133f1f9ULL},
+  {0xbf4c1e665c1fe9b5ULL,0xd28211ea58faa70eULL,0x6bc7f2f5144ea549ULL,0xa598a8030da6d86cULL},
+  {0x9a7b09b1029471e3ULL,0xb8ffea50ec08422aULL,0x685bb8c12419bbf5ULL,0xf90b89d53bdc724aULL},
+  {0x4dbadc3e58595997ULL,0x208f020f12570a18ULL,0x9192f5f2dbeafecULL,0xc41916365abb2b5dULL},
+  {0x6938ad32c494b319ULL,0x9f055dd3c1c7e533ULL,0x2e1e0ba01ad1a0f8ULL,0x6df7b5a7a126a611ULL},
+  {0xe4c73a5514742881ULL,0x92a2e0d2e0a36acfULL,0x5a724604da03bc5bULL,0x841d6063a586fa47ULL},
+  {0x647077456769a24eULL,0xbcf55cd700535655ULL,0x696c3d09f7d1671cULL,0x34ff3be4033f7a06ULL},
+  {0xed112ac4d70e20d5ULL,0x282b33810928be4dULL,0x76026947f89bde2fULL,0x5e95bb399a6971d3ULL},
+  {0x6e731b06c6f51cd8ULL,0xa0e70ed205c5e94dULL,0x74e67f1d7052f398ULL,0x9dda94404337db14ULL},
+  {0xf99471bca0ef2f66ULL,0x5ec07564b5315d8bULL,0x76c39f8a99fd974eULL,0x36e4641a53948fd4ULL},
+  {0x45d2ae2ae38947d7ULL,0x7ed3c170c45e44d4ULL,0x361bcd154301ff4bULL,0x8a93046d22897b40ULL},
+  {0xaeab27c2c579f726ULL,0xf5643842170e914fULL,0x90c191a2f507a41cULL,0x336581ea7bfbbb2ULL},
+  {0x2b1f39bec59b9618ULL,0xf17d3f1f5eeafb4eULL,0x75e8b46dc5a91925ULL,0xd5f66020bdd383a8ULL},
+  {0x849742706bd43edeULL,0x3781025ed6890c4ULL,0xa1f2634fcf00ec84ULL,0x8ab89816dadfd6b6ULL},
+  {0x3f667f69d0d97018ULL,0xafe835feca1575e9ULL,0x5f5f8d2aaf30fc6dULL,0xf25f6e271e231dfdULL},
+  {0x4bb40284b8c5fb94ULL,0x20b0938e8acff254ULL,0x8133344d9299fcaaULL,0x1e33f1a746c9c577ULL},
+  {0x5ea937913ccf1095ULL,0x6f0328bc6eda337bULL,0x9541a803535b09dcULL,0xf1dd626b9722019ULL},
+  {0xa410361fd8f08f31ULL,0xed1f4cc18cbcfcfULL,0xee7f30ded79dd20aULL,0x85b7c1dcb3cec1b7ULL},
+  {0xb92d2f1129289fa9ULL,0xfa4acb89cd7d9487ULL,0x888c0a54ce408b48ULL,0x9358bf4e626ce79aULL},
+  {0x72a2800661ac5f51ULL,0x7fbe9a3b878a7af8ULL,0x9275f4b125d6d45dULL,0x29df9fbd8d9e4650ULL},
+  {0xc9f81b66ff472adbULL,0xb5e571af914fe014ULL,0x6adc31b4e7830036ULL,0xef68a2c7ad33241dULL},
+  {0x8082b2e449fce252ULL,0xdfe58ca2f768105cULL,0x3fea6e671aaf8adfULL,0xa0b1cae06b0a847aULL},
+  {0xd7efe2315fbc7671ULL,0x743f1bc852858e32ULL,0xd20291ce1798f490ULL,0x8e3d1248c7657211ULL},
+  {0xa113f2e4c0e121e5ULL,0xb499dfb3b2133e4bULL,0x36dc7ff67e840295ULL,0x4e8ceafb9b3e9a1ULL},
+  {0x5dfb298429952152ULL,0x1cf5e707c8f3050dULL,0x8a0e679d9eea6a8ULL,0x7b732af34077f331ULL},
+  {0xf42725c2b789a33bULL,0xa5076689a010919ULL,0x5afb81c7ca2f6908ULL,0xd24a44e047e19b6fULL},
+  {0xdf051b79da14b6c3ULL,0x6f02c24fbb10ae46ULL,0x2718197ef17ed087ULL,0xecc99b0cf89ef141ULL},
+  {0x5104e98e8e3b35d4ULL,0x1edd28abbab77bULL,0x249fdfcfacb99584ULL,0xea01606a7a6c9cddULL},
+  {0xb908ea95e5eebbefULL,0x9b16386bde7f857ULL,0xc128ac00a410976ULL,0x1f6014569d1203aeULL},
+  {0x4ad196de8ce2131fULL,0x252007d8c5ea31beULL,0x6c6328655eb96651ULL,0xaf8addbf2b661c8aULL},
+  {0x419eb6997dee8d17ULL,0x2f127b76ff24d7b8ULL,0xb603b7d515377322ULL,0xe19d8d416b28eeefULL},
+  {0x722f0e3450f45889ULL,0xa674a3dabcfca15eULL,0x6cc516d47e0fb165ULL,0xe3ae1974566ca0ULL},
+  {0x8e7b0a261f997190ULL,0x4a03a9c0107e1d63ULL,0xbf7257c3b588e75bULL,0x9ea5c218b98cc990ULL},
+  {0x75ea8ced397e246ULL,0x1993ff3ed258802ULL,0x1cf6993ffed1e3e3ULL,0x591ee355313d9972ULL},
+  {0xd7a17c18f15a3699ULL,0x5e603eb6750077acULL,0x5f13c7cc84c166d5ULL,0xa8be67d40815919cULL},
+  {0x77cf03255b52984ULL,0xfa8584e47b084945ULL,0xf19aa97318d8da61ULL,0x11396d55fda54c49ULL},
+  {0xf734afb0a29f390ULL,0xa53573822a6e94b3ULL,0x36ecbe198e90fe71ULL,0x915050c28c39ebfdULL},
+  {0x5540157e017aa7aULL,0x8dcdfd5468754b64ULL,0x90000738c9e0c40bULL,0x3c5d2a1ba39c5a17ULL},
+  {0x5ec32ad51b03f6cULL,0xa4d047122a9b184bULL,0x2bc776838f73f576ULL,0x308913a27a52d922ULL},
+  {0x425ef8a1793cc030ULL,0xfbc395afb04ac078ULL,0xa3a99a7299f2e9c3ULL,0xcc8704b8a60a0defULL},
+  {0x22109700780a7943ULL,0x83ff4ac34a966eb8ULL,0x97a3b8bc51bfa271ULL,0xfbaf4eb5bdf8fe93ULL},
+  {0xa204119b2889b197ULL,0x7dd4defccc53ee7eULL,0xcd9777ac5cad29b9ULL,0xc533e4f7ea8555aaULL},
+  {0xa218a7bda715e7baULL,0xb77beeb53920db82ULL,0x91dd96717159e106ULL,0xf62885ce55ff7be2ULL},
+  {0xf566d48e33da6593ULL,0x69ba8c34eec07bbcULL,0x109f6d08d03cc96aULL,0xc14f8f2ccb27d6fULL},
+  {0x56835fe50c9d3205ULL,0x9f00c12cdc12c51ULL,0xb41f30c4efd7c491ULL,0xa5822bd06c673e21ULL},
+  {0xe441f72e0b90e6efULL,0x4c9739ed75f8f21cULL,0xbac24789fa17115aULL,0xa6cbc3046bc6a450ULL},
+  {0xbaa1f1cdcbf2d359ULL,0x695331569d729745ULL,0xa663505914704a7bULL,0x328ba6c70c404497ULL},
+  {0x344b39f99d43cc38ULL,0x130a3c0267d11ce6ULL,0xebfb86c1359b1cafULL,0x347d6d9a02c48927ULL},
+  {0x4fa07b1b19160f3bULL,0xcd0b27f7eec5752fULL,0x9ea89e83889fa4bULL,0xf9502d540ca7d5abULL},
+  {0x855ef7437b72656aULL,0xd47c67b1bf31c8cfULL,0x83f7dcb375ef5866ULL,0xda6545d2181db8d9ULL},
+  {0x8464ab4070ab2b7aULL,0xd9c41961f668fdb6ULL,0xf06e95d0665a4073ULL,0xc4f942ea2b52a8ceULL},
+  {0xb9d5994b8feb1111ULL,0xec25d6945d657146ULL,0xa13b8148309c6de7ULL,0xc40747cc9d012cb1ULL},
+  {0xfa4f1bc1da40f082ULL,0x838230a85b762e92ULL,0x48fc20ec98691ed6ULL,0x69317694d15b16c5ULL},
+  {0xc8203ef4037f3502ULL,0x338c7f713348bd34ULL,0xccf3a610be870e78ULL,0x4e42c8ec82c99798ULL},
+  {0xf3287432beb31db2ULL,0x8fcae82788f506a0ULL,0x896a193ed088a2b6ULL,0x78a891aa2234a498ULL},
+  {0x87522a1b3b0dedeaULL,0xd251cadb0c867432ULL,0x23aba2e1af70b236ULL,0x3775ab7089bc6af8ULL},
+  {0x7632c5c33e4cb721ULL,0xdcb079365966c543ULL,0xad4572c55b488607ULL,0x192e787021b1e83eULL},
+  {0x46959e3e82f74e26ULL,0xd954595d1314ba88ULL,0x9d94fb814d3d775aULL,0xcee31cbf7e34ec37ULL},
+  {0x74818ee88f5e524fULL,0xc8c0ac8d1f6b993ULL,0xcf58f7bc65a2514dULL,0x8267f5f35e78f30dULL},
+  {0xcdc1a01d08b47986ULL,0xfddb58fd45b1ebefULL,0x19f6ea6a4eb5464eULL,0xb4f9eaea09b69176ULL},
+  {0x9169e4ea2b19a602ULL,0x5dacf1a224b15755ULL,0x94ed72da5b996139ULL,0xa076cacf92cc467cULL},
+  {0xb77907792ebcc60eULL,0x84e2515afc3dccc1ULL,0xa0179a48966d30ceULL,0xd4263dfc3d2df923ULL},
+  {0x395681815f5be39cULL,0xb9e912769ef3393fULL,0x162aaae1836a64aaULL,0x4265bbaf8d442ac5ULL},
+  {0x2233eeda897612c4ULL,0x32acc0a4a2de42ULL,0x4f8d35eb6930857cULL,0x48457524820fa65aULL},
+  {0xb054d3844f1724c1ULL,0x495f3686c9351822ULL,0x2187ee0a7a4e2503ULL,0x3e805fa563758c7bULL},
+  {0x367a1767c11ccedaULL,0x45e19919152923fULL,0xb11644f3a2afdfc2ULL,0xdfeeef1881101f2cULL},
+  {0x75f3d8ef294845f3ULL,0x75a7adb1b1596240ULL,0xec401a7fa0f5db8bULL,0x296eef5bdd483af1ULL},
+  {0x6c82df83b8fae859ULL,0x5d89bcbc6062ced3ULL,0x3c573f44e1f38983ULL,0x6d7ef6b17543f837ULL},
+  {0xe63065b098bbae2eULL,0x5d8db3a2dc56b8b1ULL,0x2416f0ae4ed51ec8ULL,0x32c001f5785688f6ULL},
+  {0x5af25af66e04541fULL,0xf3c88b9322554703ULL,0x684500d3b991f2e3ULL,0xe75605d59102a5a2ULL},
+  {0xc7b750f733ce1752ULL,0xe783c797d7cd204eULL,0x812ddf64d99c9aeaULL,0xd7a0da58d01dc635ULL},
+  {0x7dd43fefb1ed620cULL,0x9a0c2e60abe38845ULL,0x6a2be453d5020bc9ULL,0xeb98660f4c4dfaa0ULL},
+  {0xd0f9cf8031bdc863ULL,0x1d8742af3a39049aULL,0x3b4ab50f6b1030ceULL,0x838ed2eb98f46685ULL},
+  {0xdc3563e3b8dba942ULL,0x2154596941888336ULL,0x5939f2e6892b1992ULL,0x13e87b027d8514d3ULL},
+  {0x5f2d7ca5d86e196eULL,0x64f08ea3aa575d8fULL,0x88b4262217960359ULL,0x21c76dbf7a8d075aULL},
+  {0x7bf4491691e5764aULL,0x25424b371ce2708eULL,0x17c38f06a5be6fc1ULL,0xee163026e9fd6fe0ULL},
+  {0x6a0c81bd90877ed5ULL,0xfe3f31125f3bc5bcULL,0xe38b59ba5857b83cULL,0x93e651f2d3ac2659ULL},
+  {0x9932e5db33af3d80ULL,0x1e626d4350586799ULL,0x78de3a750c2dc89bULL,0xb268f5ef9ad51e4dULL},
+  {0xeeefbcc2e74b75fbULL,0x8feced69f26a8b55ULL,0x83fe7a9de8ae5b4bULL,0xcd5a3be41717d656ULL},
+  {0xbf7ffdba93c4750dULL,0x2b02f01ca99ceea3ULL,0xe9fad85eb6c7bfe4ULL,0xff07f3118a9df035ULL},
+  {0xc1e4dbfd90ac0427ULL,0x658aa6490ef4ef1aULL,0x4108c1d9049df6b3ULL,0x6c0d1f1784e47ff0ULL},
+  {0xc16e8c3ce2b526a1ULL,0xa4b9f69e0d825ebeULL,0x4146fd20ffb658beULL,0x8d8b9855c7c052a3ULL},
+  {0xacc0a89758554b6cULL,0xca6dd9da7a9efa19ULL,0xef8b8cdbd452f7c5ULL,0xda9b9e9ab699c11cULL},
+  {0xa54263180da32b63ULL,0xe4b851ceca91b1ebULL,0xbfa9d472d7ae26dfULL,0x52db0b5384dfbf05ULL},
+  {0x56fc4c098ad30369ULL,0xd2f58220c30a7cb0ULL,0xf080ea4c21a2ade2ULL,0x52520de6009c7e49ULL},
+  {0xfff543becbd43352ULL,0x7d0f29c3f3fa48c6ULL,0x395efd24e80919ccULL,0xe62f9490d3d51da6ULL},
+  {0x65348f778db0e595ULL,0xa7163cb9fba082bbULL,0xd7ce3765816076ebULL,0x7d86781855db1b17ULL},
+  {0x6d8e7d65aaab1193ULL,0x1afa2ff5cb7b14fdULL,0x957509c88f77d019ULL,0x7f30ea2476b399b4ULL},
+  {0xb25031df15661815ULL,0x4e7759552d729e07ULL,0x81c5c2cd51ac727bULL,0x59ae134c1a41cfeeULL},
+  {0xc60a0361800b7a00ULL,0xef0fb7b4a1dd1d9aULL,0x46a210fada6c903fULL,0x5098ff1e1d9f14fbULL},
+  {0x2cf6531fd68befd5ULL,0x8615402eb31f2c08ULL,0x5131b1389effbbd2ULL,0xf4a0caad9ad20992ULL},
+  {0xb9f2c81e2778ad58ULL,0xe2f3c4ccce445c96ULL,0x72895be6b9cbefa6ULL,0x32b78c7de9ee512aULL},
+  {0xa8f9e0cfb9746eccULL,0xac67947361320882ULL,0xb360ad75ee73fabULL,0xb40226a37a1a586dULL},
+  {0x74b581550547a4f7ULL,0xe37d50f08269dfc0ULL,0xd076eef2a7c72b0cULL,0xe2cb74fddc8e9fbcULL},
+  {0x577e0ffa43b4f3bcULL,0x66c2f828ca99faccULL,0x52ac321ea930afa6ULL,0x54bebc996f6c2b7cULL},
+  {0x1be0d99cd10ae3a8ULL,0x26009a35f235cb14ULL,0xdadc299496ab3574ULL,0x8438447566d4d7beULL},
+  {0x34d667b8fad96201ULL,0xcac732be31e1b614ULL,0x2bba4eff99c743dcULL,0xcea8d97ae24caebbULL},
+  {0x8ab65c82c711d67eULL,0x587d9c46f660b87ULL,0x9b584c6fc6c30887ULL,0x4162d488b8940203ULL},
+  {0xfc9caa19ff32151eULL,0xf84b6f6249ae3d7dULL,0xd12ef9ca0a34b068ULL,0x4b24649ac96f264fULL},
+  {0x4f3ba4a4bf5f683dULL,0x175d767aec3e5068ULL,0xf0f89bfd2dcf54fcULL,0x3fad3fa84caf0f34ULL},
+  {0xf600bbde5b2c74a4ULL,0xa562847bec1b88b6ULL,0x243061575dc28b48ULL,0xbdc6c1b0f061c563ULL},
+  {0x1c69532faeb1a86bULL,0xc1fb84bf1370798fULL,0x568c1a7ce05d0816ULL,0x674f2600a3007a00ULL},
+  {0x609c45706ce6b514ULL,0x890905c79b357322ULL,0x8885c35600844d49ULL,0x8bc89c2f919ed15ULL},
+  {0xf87d29bd5ee9f08fULL,0x3d82d6c692714bcfULL,0xb81b815ad1fb3b26ULL,0xd32f4da54ade74abULL},
+  {0xf08670f188ce2bcULL,0x234d56537053d014ULL,0x78ac98661e39723dULL,0x714651a9cb4af14cULL},
+  {0x1ed954f1e3ce3ff6ULL,0x6fbb6931f72b08cbULL,0x6e593657135845d3ULL,0x30e4e67043538555ULL},
+  {0x25149eed98fe1249ULL,0x7558b9e8d46130c1ULL,0x61fa0449250cd2a5ULL,0x7e62469c0893fc16ULL},
+  {0xf1971b04d4cad297ULL,0x7f3dcd10b01e580bULL,0x4682904330e4deeULL,0xbe2062003c51cc30ULL},
+  {0x6b51046bf16e839bULL,0xafddfed53ea14522ULL,0x867960f4f378473fULL,0x639863c5cf03696ULL},
+  {0xc419859fff5df04aULL,0xcb6e84a601df5993ULL,0xd29e0fb9ac2af211ULL,0x93144423ace3451eULL},
+  {0x422049a122517961ULL,0x2fb1f35ea3adc41fULL,0xa5b943abdd4a0d7fULL,0x7d54261d569c7330ULL},
+  {0xcb66418c157b112cULL,0x97829205c7b7d2a7ULL,0xf21ca26d6c34fb81ULL,0xb015f8044f5fcbdcULL},
+  {0xa5cbfc789ef0184bULL,0x30c21799e65a6647ULL,0x52db740b48aba6d2ULL,0xb35511d67e63fa65ULL},
+  {0x6b3f2af341a21b52ULL,0x4f8a18de57a140d3ULL,0x9e4868117a465a3aULL,0xd5e9e1da649d97d8ULL},
+  {0x9683baab330bff95ULL,0x7f0107d535274c94ULL,0xe0ca7b596da918dULL,0xe485be3daccabfabULL},
+  {0x996a5316d36966bbULL,0x983005cd72e16d6fULL,0x5dbf8ed77b992439ULL,0xd3ae41047dd7ca06ULL},
+  {0x215b395a558aa151ULL,0xb9e20c1151efa971ULL,0x23f53c4cf55a0a63ULL,0x659214ac1a17900ULL},
+  {0x9f80af87c897b065ULL,0x87197d0a82e377b4ULL,0xfc66cdd22800f0a4ULL,0x463e2763d885f958ULL},
+  {0x8fef8516060dfcULL,0x76545f84205e6a2aULL,0x48494b9dc41ab086ULL,0xddc5310f00582ac8ULL},
+  {0x83cddfc910641917ULL,0x58e597c40bfe747cULL,0xc6f53ec1bb63ec31ULL,0x7985fdfd127c0567ULL},
+  {0xf3ed516ed7c504efULL,0x4d8e2df756ef139dULL,0xa8f86c708c25f0e1ULL,0x6a843ba43c244f89ULL},
+  {0xd5ff1543da7703e9ULL,0x9e74c59cb83d2d0eULL,0xb2dd249410eac7f9ULL,0x74a1ad6b5f76e39dULL},
+  {0x5fc0da4813704a08ULL,0x636478cbbff1713aULL,0x5edf6a1f8a10dff8ULL,0x2e34552aa716aef7ULL},
+  {0xa71d0896b22f6da3ULL,0xc9bab42c72747463ULL,0x2d416664ba19b7fULL,0x30682a50703375f6ULL},
+  {0xd33464c342dc0080ULL,0xeef5d66580c8e23ULL,0xa74ebd6746e13afeULL,0x136933174bc388ULL},
+  {0x1ee6c1347769ef57ULL,0x654e7a2b2464f52bULL,0x6c3791efefa79597ULL,0x9e2158f0d7c0d5f2ULL},
+  {0xf50618fa7eaf5aa3ULL,0x8b2b0c32f081e206ULL,0xeb76cc1731c1ba31ULL,0x22213b78f3dcfbdfULL},
+  {0x322857f3be327d66ULL,0x8172e566e3c4fce7ULL,0xeba4029c202538c2ULL,0x176e26989a43c9cfULL},
+  {0x2d6c77bcac938f93ULL,0xc46e2a586d37641cULL,0xa7afc8456a40d57bULL,0x8758a9fd232f0fe9ULL},
+  {0x7004788c50374da8ULL,0xcf1892393dfc4f1bULL,0x68abb89a13ad747eULL,0x75d46efea3771e6eULL},
+  {0xd903e0547bb26bfbULL,0x861a483939a113e2ULL,0xa5f3c28db17e60daULL,0x69b47c7249439d23ULL},
+  {0x5b7319f645605721ULL,0x2310fb0451c86934ULL,0xfb698c4c825f6d5fULL,0x809a20c67d64900fULL},
+  {0x475a62c4bc8ade53ULL,0xed04459e09ca4351ULL,0xc300e97d5188fca2ULL,0x5654834268843e72ULL},
+  {0x8d563446f972c180ULL,0xdefece1cf29c6352ULL,0xed4500b4eac7083fULL,0x1b38903a43f7f114ULL},
+  {0x646e23fd5f51508ULL,0xd8c39cabd5ac1ca1ULL,0xea2a6e3e172de238ULL,0x8282263212c609d9ULL},
+  {0xf4e6c58868feef23ULL,0x263458ce2d07566dULL,0xab0b4e8ddfa3efe7ULL,0x90a80db6eb294b9eULL},
+  {0xf458aaa1bbf1433ULL,0x552b572eda6a27a2ULL,0xea7d7701363c4285ULL,0x545f13c023715040ULL},
+  {0x6dc25d47376bea9bULL,0x3e6f36054a14546eULL,0x12d625460f60340eULL,0xc2c80f844b705998ULL},
+  {0x4632645c569f8346ULL,0x957e1dc74ca93808ULL,0x47108936b531bb68ULL,0xf27cddeea945ef40ULL},
+  {0xa323ce11a28e7553ULL,0x2d00cfe1d5fcd692ULL,0xfdf989d3f19fb265ULL,0x9cf606744cf4b5f3ULL},
+  {0x623833d9037c07dfULL,0x4fb004d707db9cc0ULL,0x6604467edd323c31ULL,0xb54d9afb4f81394dULL},
+  {0xce98f5855ad82208ULL,0xa6280b0c742005abULL,0x5a493fd6060d936eULL,0x57488fa28742c6b2ULL},
+  {0xc3af58d3e8e65bc6ULL,0x6b71482e30faaf96ULL,0x7430ee6e589c05e5ULL,0x4a5f2b9f56c13dc7ULL},
+  {0x4edbc5eb4899447dULL,0xd40ed616c758cdc8ULL,0xdc8df2b8d75963c2ULL,0xf1133cbe6be8bbc8ULL},
+  {0x951b67458ef54d7ULL,0x9c05377aaad02537ULL,0x88f2f14b83fec504ULL,0x630aca4d7f4e5d92ULL},
+  {0xf4e04175bbe89c0ULL,0x3f3d69bff3e42505ULL,0x7f8989c79065bb81ULL,0x95083e753301bd78ULL},
+  {0x94cd2910186a92dfULL,0x82d033abe15ee1a0ULL,0x7a5a04b09d46f6f1ULL,0x14e333e19222ffafULL},
+  {0x62100443bc5c75c6ULL,0x8668c7b363c8d973ULL,0x5e576ed29c99af63ULL,0x1a908355cbb75675ULL},
+  {0xbd6b7cea1ad3ec49ULL,0xc8245d6ffb4bbc43ULL,0xc75f9d4d45b2b643ULL,0xd1e0265aa86ae428ULL},
+  {0xf04df3bef349b648ULL,0x8a2d1f63c5f31db4ULL,0xaa867308fad97f9fULL,0xc5922f740bd343d5ULL},
+  {0x10758152439f943fULL,0x3ff705cf3d8eb910ULL,0xc9c91effca154cdeULL,0xa83d1893ba454e96ULL},
+  {0x96434420e6c95dc9ULL,0x55dcf31163897d9ULL,0x7691a40431b0b672ULL,0x64e1b1969f910297ULL},
+  {0xd44a3a5d1fb1dfa8ULL,0xc818a14cee53f767ULL,0xfe370eeb9075043eULL,0x2290006b8d17b03cULL},
+  {0x808fb7ea07ce08deULL,0xc602f8a7549e9ce7ULL,0x6c521bad3333dd37ULL,0x33b2e76687744edULL},
+  {0x225a6e483cf4b80ULL,0xa5a4f8a80adcdb14ULL,0x2ca9a53d9d22580ULL,0xbbba8d764098dc4ULL},
+  {0x951473be45e4f294ULL,0x89fbf30ff294a75cULL,0xc2a3103317b4ac31ULL,0x20f18f4c866d8a1cULL},
+  {0x9fbf74b955b3edc6ULL,0xfca6476eed1fd8d6ULL,0xa8dfaa5328fffedfULL,0xaa336dda311186a2ULL},
+  {0xd1444176d7b69a8bULL,0x2df3465354643befULL,0xa0eb4c685e2a8b9dULL,0x4d1623c944c9c716ULL},
+  {0x9465e6a4ac04dc3fULL,0x5d5ac4b6f46d2dadULL,0xa7c06f71ad2c0db6ULL,0xf66dc33e335abc9ULL},
+  {0xd4ad0ff53db079e0ULL,0x4faad0a4dd0da7e2ULL,0x280d6b3685894785ULL,0xa901b0dbe8ab292dULL},
+  {0xef5f2776b40cbed5ULL,0x54f28fa8f3f367e3ULL,0xefdb401c11354c5eULL,0xbb8a643d0f0c3991ULL},
+  {0x3031c9a6ebfc9a70ULL,0x2f42a24f7c80889bULL,0x50bd66f4484645b1ULL,0x7e0af07130218ffdULL},
+  {0xfb37d7c0fa4753a8ULL,0x7353c30a84f9fde9ULL,0xb8eb0201cecc40e5ULL,0xfe330b776c5f5c95ULL},
+  {0xef82aab05aebf20dULL,0xb47f0528546e9da4ULL,0xc185d335440a9038ULL,0x7ba8187e1a7b25a2ULL},
+  {0x241dd1f60f2ce57bULL,0x220c57cb0d48496cULL,0x4663785ce387c4acULL,0x4b8b2d95c98777baULL},
+  {0x55b84a39d93a6807ULL,0x9767b7960e926772ULL,0xb6000816e18fca38ULL,0x8c050fc34d83b279ULL},
+  {0xbf008c5f9969da10ULL,0xe1e4f29fdf154f7ULL,0x5e1637258402cac3ULL,0xb07d3e8dbbe686eULL},
+  {0x2a7b8b1bc99c2ec9ULL,0x9d7201a2cbf50620ULL,0x25860583a5249948ULL,0x53b7849a78e4df86ULL},
+  {0x890a71cef93cb107ULL,0x881b6842b2da753fULL,0x2893f416eb820836ULL,0x3f6841c0aa49e8f4ULL},
+  {0xfebc527e53313b33ULL,0xb633500431dee78eULL,0x6a075a010fe762beULL,0x9bdf9e67a5d0c995ULL},
+  {0xac1c2fc929010467ULL,0x1b92cc919c7f24e0ULL,0x5edf6d2fca4b15f9ULL,0x261923949e9661b5ULL},
+  {0x429fd9904a381f34ULL,0x17d9f42c6ec2d2fbULL,0xbac031a47606f89ULL,0x7caa72b37a8ab3bdULL},
+  {0x2ae7f6cb96e73ce9ULL,0xcc3cf4ce06a9402bULL,0xc097793d9116ce71ULL,0xb1d6ff90f1776329ULL},
+  {0xde16b97e3993d81aULL,0x925d62c75532493dULL,0x79c0295fc3f48db7ULL,0x2ef29b9f09827975ULL},
+  {0xebe186694c574c92ULL,0x3d7ceb47ea8d3ae9ULL,0xdad8e169c06514f0ULL,0xf0d94b756288b707ULL},
+  {0x9e5c34be97317ff8ULL,0x4029e952ec354e6aULL,0x573c1860ae5d02c6ULL,0xdf157cad95b07875ULL},
+  {0x15d53b8b91afeb7cULL,0xf49cfb56bd9452b3ULL,0x6fa8ad52c3b042faULL,0x6abd4d9333bfafbbULL},
+  {0xb15a987016454b1dULL,0xe651d236b71920e7ULL,0xb6182e643b9eb544ULL,0xdd55c150a29ca526ULL},
+  {0x7f2f6c96df756f05ULL,0xb07f1e9c78c773c4ULL,0x93788317e4874a4aULL,0x85a7b790fc9d9624ULL},
+  {0x25b9e4b898227f27ULL,0xc4d5d39387f01723ULL,0x19147763063d3256ULL,0x16886cf46ed42c79ULL},
+  {0xcfaaeb03678dfdc7ULL,0x9d3bce6705a8a806ULL,0x6e4e3f391d9fddcdULL,0x654f313a31153e07ULL},
+  {0x56aeaa7b2b60732fULL,0x27968c22484ff45eULL,0x8e8b306d6f0acffULL,0x6ff180fcdaa30618ULL},
+  {0x8bc63d79ece7a90cULL,0x2ce7eccf5ef16332ULL,0x9741bbeca9aeedc0ULL,0xf9d8df5e84d139b7ULL},
+  {0xf8bcc8eadc395e36ULL,0xaa912b5539f685c4ULL,0x3eb4f51f40ee677cULL,0x3ea4511a00dc2a0ULL},
+  {0x57092c2e810feafULL,0xc95226709bc0f32bULL,0xf3da1e01e00eae28ULL,0x86cb288be8f7c5ebULL},
+  {0x3c7cca20f253081dULL,0x53e4150a835e54b6ULL,0xb38742d8f32dfb8dULL,0xb82cd70dc3de9eaULL},
+  {0xbfbde332851adf4bULL,0xd074c5a950068469ULL,0xea4f47738b8e383dULL,0x72e8d1d7b3a6df2bULL},
+  {0xb7b38b57a196c77fULL,0x6d056f017327d49ULL,0x84ee23bf105a69a6ULL,0xfe2fc3e000748745ULL},
+  {0xc7de6a136a109f76ULL,0xcf45f67f0004633bULL,0x858be8e17a4207c8ULL,0x561b1c96e5af2704ULL},
+  {0x845dbf574bb7858bULL,0xe8b0011446ea35ecULL,0x47e8778b12db9d6eULL,0x4b90176cdaa3693ULL},
+  {0xc7ac53b7e81dfb49ULL,0xd0172be8cb2e3bfcULL,0x2031e39c810f81a2ULL,0xe19b94787546d486ULL},
+  {0xcd3ec10a5944c6d2ULL,0xdefc4272f59528a0ULL,0x4b8c86a9f0dbc9edULL,0x35f382511d34600bULL},
+  {0xbd0cf968ae813458ULL,0xd57454b00d23fce0ULL,0xf6fb17a6299ed421ULL,0x2f19cd628cd13cfcULL},
+  {0xf3cc2371722cb94aULL,0xe1d0e9ac3f0111cdULL,0xa1027e26587d3f5bULL,0x1d74b2970311b7ffULL},
+  {0x371b37e58a69fccbULL,0x82d302e24c43e22aULL,0x3472adc69ce9c2d3ULL,0x13597010dfab0f82ULL},
+  {0xf934a68a98450428ULL,0x4f75d1b7c41593e6ULL,0xb020737b9ec722eULL,0x50a094f309c6f956ULL},
+  {0x92f44930ae3ccdfeULL,0xd2fb805d77a00ec2ULL,0x1f9294d456849c86ULL,0xe290678cbf2a518fULL},
+  {0x99b0a6d627c63db7ULL,0x282dbcd914b48105ULL,0xdfecf12e275ec38cULL,0x9b65bb812129157cULL},
+  {0x41a9d2dab3eba32eULL,0xb36248acde3cb427ULL,0xb8a65ca77c422ddaULL,0xfe1c5d4876b17caaULL},
+  {0x1c20802d36a4bc6bULL,0x85e7f1c5e620eca5ULL,0x456c1115a1dc831cULL,0x8b4544fc1fdfa06eULL},
+  {0x6b2168fe82d6c03ULL,0x132d0676311a5945ULL,0xece52a94195712d6ULL,0x6c7630c50231b40eULL},
+  {0xd5f81d95de0ab4aaULL,0x6cb2ae13ddcede29ULL,0x5179b29cc5578fdcULL,0x6c709880b959eb7cULL},
+  {0x8f3f350f48e6014fULL,0xb98f917c524b4f8bULL,0xe7d0950e536a1e25ULL,0x238e918ae286a80bULL},
+  {0x85b56773d537806ULL,0x76fc9d67802b81e7ULL,0x95d891f794a087a0ULL,0x77760b5137ba6a71ULL},
+  {0x48f3d67e59663767ULL,0x2a2f5b2f968d1331ULL,0xe341c05fc609fd52ULL,0xe4b65a7cff579e46ULL},
+  {0xdf4c426e7e163102ULL,0xe23cd4f8efd625d0ULL,0xe9a904a8a8c91a67ULL,0x1a8bd7836a0b0c82ULL},
+  {0x457051461540ed0bULL,0x5765395df8ed19d1ULL,0x2466597572a907baULL,0xf5eaf4de39d745e7ULL},
+  {0x53db5390864abc30ULL,0xa3fb3099e69471d7ULL,0xfb1e453ed24d91d6ULL,0xfe217db659079913ULL},
+  {0x889c71e4fb8e3f52ULL,0xbaa045e73dab0980ULL,0xbd3f3a5182745060ULL,0x124c5c798edff99aULL},
+  {0x212aed49f5b33b91ULL,0x7e3abd748cb6c5fULL,0xc38f58b65ead696dULL,0x2504d63754afd5ebULL},
+  {0xc55303dc864f625aULL,0x5dd189beb02fdfd3ULL,0xaf586b9c402003e9ULL,0xd2a035b8715bfdbULL},
+  {0x7fbddcafdb197b5cULL,0x6160abbf5cc8976bULL,0x89a9bd3f687105c3ULL,0xb06f702f47b22d7ULL},
+  {0x876745f9a3372a42ULL,0x6c39aa35a87e2cc1ULL,0x8d9b9103361874b3ULL,0x65210379a8f4d1aULL},
+  {0xbc2128a60d044e23ULL,0xa6f3f99ebd23d0acULL,0x4034eeb931b54480ULL,0x803b203bb31f9cf9ULL},
+  {0x88236c81fdbc33b0ULL,0x8cb29372e5799f76ULL,0xb1d22b59a2b99962ULL,0x429053001eec810ULL},
+  {0xd57289fe0302749aULL,0xe52de1de8e95a8dcULL,0xbb50e5bda03a7312ULL,0x266a9cb4c5f5ceadULL},
+  {0x7aea9ded421e0b20ULL,0x5e190d948ed2d7bbULL,0xcb71534a9ad04798ULL,0xabf10b2d598ff1d9ULL},
+  {0x5d7360bcf84eba94ULL,0x64c4c141e9abea35ULL,0x2599a7ab98163df3ULL,0xfd8a9d95d80c7ad5ULL},
+  {0xef7c62a092b55825ULL,0xf85699f1c9e1a96cULL,0xbcaebd264b611f92ULL,0xa8ec150dde7feb5fULL},
+  {0xf2cb6f26f9db0a7dULL,0x6e84acc5b7b0b8f8ULL,0x59fc339a8b2c80beULL,0xa7322df309f28f23ULL},
+  {0xae26074eab7c9c54ULL,0xa57451495c25e9c4ULL,0x15462823821bb9cbULL,0x6522b91f2e518e5ULL},
+  {0x82c3c7e4cb052d36ULL,0xbd4c461aea569ffcULL,0x63a104ddbf7f0f18ULL,0x82a8c10f336a6649ULL},
+  {0x8c77c15df280714aULL,0x32c79f178cafef8cULL,0xbe1d440de92f23f5ULL,0xe5e2f23f7f3ebbd6ULL},
+  {0xc54784a94f15d6dfULL,0x6c4ef2b75ba5c516ULL,0x7cd12f05a60c26ULL,0x9b50d1b68e3bf795ULL},
+  {0xc98334d798d27e79ULL,0x13929c030ac2b7ecULL,0xbb2e268f07c0bd6eULL,0x70d4ed5aa6bc59c5ULL},
+  {0x6718595fbae08d32ULL,0xb8dcb9d7ee82cb80ULL,0x7de3a82281d3056aULL,0x3f9083ddc8b423feULL},
+  {0x91fc66fc195742b6ULL,0x2f4e021adc54c879ULL,0x9937dbf1ea906594ULL,0x695a4bc690d371e4ULL},
+  {0xdbd1074ef2167fafULL,0xc923170659d50bfaULL,0x56eff6bd592666cbULL,0xc75c85c1ee17c1a2ULL},
+  {0xed181dfcb8155102ULL,0x346d804976604ea4ULL,0xcb7e7aae006316d1ULL,0x56276403f3a5f577ULL},
+  {0x5c68d57698656045ULL,0x60ea8e2b3d4b7fb9ULL,0xb4d0cf0d2f7aad7cULL,0xc5341feaf8a0f5d3ULL},
+  {0x809355f764cf1baULL,0x34e40a537d398c68ULL,0x111d5f6a04749d07ULL,0x9038876f21c3bc14ULL},
+  {0x8967a03260c2d89bULL,0x220852b7752d67fdULL,0xd52bd4c68705dd22ULL,0x83acda3e2a8997e0ULL},
+  {0xed2bd22ed44f7809ULL,0x31b94960db0898a7ULL,0x61d5209abd231bdbULL,0x5d8c91c5507b7af5ULL},
+  {0x5bd279b30025237bULL,0xf1c0d5716c5d3962ULL,0x5b9c4164e29d594cULL,0x5b8191468b299074ULL},
+  {0x83737d56b9b55983ULL,0xcd4f6d703d538acfULL,0x8c61e798442e5453ULL,0x588f275c9a465457ULL},
+  {0x9b89045e2c3b0e6cULL,0x32f5f664d38d7721ULL,0xf8041796166104e7ULL,0x64778122214e38efULL},
+  {0x4968d01879f05627ULL,0x8703b423b93e0829ULL,0xaee312306c994dc8ULL,0x3f44923b0693b954ULL},
+  {0x43d0cb9f1af12323ULL,0x2b475a9d6da1017cULL,0x795099099aee8664ULL,0xed4d826afe5762f4ULL},
+  {0x943296b9aebb30d8ULL,0x9cb012d173167742ULL,0xb2f9a546e05cb011ULL,0x953365cf99092ecdULL},
+  {0x7a06eb40cd109c4aULL,0x4d82ac2b55f7afe9ULL,0xacd6f551346fd61aULL,0x38b42924419aecc3ULL},
+  {0xa675756d4c913fdcULL,0x662967e3b8fd89f6ULL,0x3ec01a72a2b48542ULL,0xd5fb3642dd34f771ULL},
+  {0x446ac2e982138911ULL,0xbb2a8f6224f216e3ULL,0xb434cf70183e8615ULL,0xc3cad4a8d8bb94a7ULL},
+  {0x152f2aa8e736f1ULL,0xa19cb524734664e1ULL,0xb8346dd2e5023d25ULL,0xa5b5088c01df0902ULL},
+  {0x55588e4a54bd6538ULL,0xd9212e5736591a9eULL,0x54fae40dce3ea9ecULL,0x2d408ff4d3d236fdULL},
+  {0xce799f5377539d77ULL,0x61b371d8c145f818ULL,0x7c75ab4fd13f60b1ULL,0x6e087ac61ce91382ULL},
+  {0xbafb7eaa7a33c854ULL,0xd67423a3a3c6fdaeULL,0x76e90cf813f888ebULL,0xee7adf6d247f25fbULL},
+  {0x38fe94479a207310ULL,0x97b2f0ce99495d2cULL,0x85625011814927d8ULL,0x864e30ec83f1ab49ULL},
+  {0x7c811f3e01144b34ULL,0xdd5d37a37c9a864bULL,0x3d91151dc4c5e89dULL,0x2f9457c8a9ffaca1ULL},
+  {0x572e051373d72229ULL,0xf13ab5402c8fbe9bULL,0x49cc68cea542f71cULL,0x7a594943852c33cULL},
+  {0x7b30c46eb7fec294ULL,0x60120483ef531c27ULL,0x1ce3478cefe18de3ULL,0xd3f332b8a0f11582ULL},
+  {0xcd34ecdb324e4279ULL,0x7bfaa6a000cc126ULL,0xb170355da78b00ceULL,0xee9bf5db6bf58d83ULL},
+  {0x9a4cdf1f8e152b91ULL,0x5f3ddb8666b52f7eULL,0x3521fcd86ef36dd7ULL,0x183408d338b05aadULL},
+  {0xc75991fd328618a3ULL,0xf237fd4928da8d6dULL,0x5679e2a39c61aebeULL,0x368b590c7040ee62ULL},
+  {0x3d3956095f40374eULL,0x21faffd6c2534686ULL,0xba8f1f0ff9cf89a7ULL,0x283fec5db1145e53ULL},
+  {0x4a5b728ba70076c4ULL,0x4b7f34db23ef1044ULL,0xab459017757f7532ULL,0xef98e34f8fd7a186ULL},
+  {0xf54a0dfbdd52fa62ULL,0xebc73579770fd6daULL,0x413bd249d8e7dbfcULL,0xce7570a4f943cfaULL},
+  {0x89c56579b464b617ULL,0x592496fbc8b1510eULL,0xf869cc90d81d9371ULL,0x4b5bfce9275226a6ULL},
+  {0x37794a4c838fd470ULL,0xdf79031574cbeb15ULL,0x1269f648cd919525ULL,0x7e9c4f19c8f4ec3fULL},
+  {0x4fd7674b83411328ULL,0xad78857d654d2c5fULL,0x237dff76a505bb63ULL,0x942139d4c45b0ee4ULL},
+  {0x3bf451b464cb001bULL,0xba04f4c722a3ec2ULL,0xa7c7f919df2309f9ULL,0xe2a9bbe60d5d5bfeULL},
+  {0x29ba933572aca3aaULL,0xddf755b146a97266ULL,0x35dde695b48cfd5cULL,0x886eb2e66be68b88ULL},
+  {0xe709900275271012ULL,0xf55e641b1558c265ULL,0xe43bf37d42a94990ULL,0x504512a43e17ef50ULL},
+  {0xa908b701b5476085ULL,0xb5714e7796eb9f84ULL,0x10d3aad6a78ed1afULL,0x3443a7067a08cd3eULL},
+  {0xcd5cbe87285f850dULL,0x859945d8a17b3411ULL,0x4b2d1d51ba72c721ULL,0x81d1f013a6bb325fULL},
+  {0x810ae9a13952ee2cULL,0x6e09b46aac3b7de3ULL,0xe1a27fbd9d1b0c88ULL,0xd5b0ac978945c962ULL},
+  {0xa733383d1d895022ULL,0xd90dd51414a3b87cULL,0x18a872767e66c33dULL,0x5b66c2dfc1d28266ULL},
+  {0xf6d3ab8c560e3564ULL,0x606f4c6608f96ba7ULL,0x103c0fb2aa1d36c0ULL,0x94d09a21e27ec50fULL},
+  {0xafaf868820381186ULL,0x99b583d9af58c597ULL,0xdbd2d544bdbff8abULL,0xaeb5f70e98ec5e38ULL},
+  {0xc935d52c94388352ULL,0x8ea83e7d8745b6bdULL,0xd80d8cd566f2213fULL,0x60f74920a550b0beULL},
+  {0x707a98212505052eULL,0x557679ca76ad753aULL,0x84761e3c67a9c02aULL,0xb289effe841943bULL},
+  {0x49a9f8ee55640f0dULL,0xe8f67752d830ca26ULL,0x901c75bf0ad6c84aULL,0x481ae134ba75525eULL},
+  {0xf81bd356f619291cULL,0x3f585917e44e1200ULL,0x6b0c8360cfd28288ULL,0xabae39458b12199eULL},
+  {0x443b35835e2ec00ULL,0x9682d35086af5d5fULL,0xd1c2a6a6cee4ac39ULL,0x794a1c1a306d944eULL},
+  {0x9419c80955fbacaaULL,0x1e0f658c8d91b013ULL,0x81ac224a518eb29dULL,0x4a9583a6485b5a5aULL},
+  {0xbf30da3c728c7ea9ULL,0x1980ddfc201ca2d2ULL,0x505232b12c82984bULL,0x97a2b6ff47c3de75ULL},
+  {0x3a21010210ebc169ULL,0xea236ac1460f17aeULL,0x65fcf46544ab0d9eULL,0xd52f630edba6f7cbULL},
+  {0xc74a8a45238f4b32ULL,0x7f80f94a517484cbULL,0x92e54a2577cc170aULL,0x3824b450c286bcf8ULL},
+  {0x8d10e1209add6a4dULL,0xc74a2a6335bca9bfULL,0xf5c50fc052e4c1e9ULL,0xbdc523782c75858ULL},
+  {0xa550839cf4713b42ULL,0xe7dc2e4bcf43bbcaULL,0xf4419000bf4b6ab9ULL,0xcfd70505faacd3caULL},
+  {0x26ee0912e59ad087ULL,0x88156d168f13ce86ULL,0x3bb64e476eb6167aULL,0x44770a338bf0aab8ULL},
+  {0xe80483a1fdd836deULL,0xbff1e99544d93ac2ULL,0x892e957cf45fc04fULL,0x5234cd122b1b943eULL},
+  {0x3e32d924515e1679ULL,0x6503108d8ee8e1c8ULL,0x319ac20323e36672ULL,0xb15e7b322e404aeeULL},
+  {0x368d947a98f374f3ULL,0xf225c4c20f719044ULL,0xf418307a62755591ULL,0x5e203ed5f22d171dULL},
+  {0x27bbd9aeddb00f22ULL,0x665ae108d5e04190ULL,0xf2c50f758a1c1df9ULL,0xa1ed755705225cd0ULL},
+  {0x1cce481c4557ebdbULL,0x32c7e0f65871af33ULL,0xcbea34f83d4b3b64ULL,0x5abee688767d78d1ULL},
+  {0x3cf8afb31d918af5ULL,0x479e9ec9c23a37a2ULL,0xd9bfc43c2c60580fULL,0xe8aaf3616a1bc60fULL},
+  {0x4cf16175ee702bdeULL,0x55cb3a42aabf276dULL,0xed6e5009df72a7f7ULL,0x4d87dac33916fef2ULL},
+  {0xc5a3aa37054c20a3ULL,0x759c04338a3db76ULL,0x52a4a4ef6187a6d6ULL,0x5dc6f8cd2c855e63ULL},
+  {0x875d289f2050a94cULL,0x75d82fef7413e661ULL,0x2fed8ece711bedf3ULL,0x600a6c0a11395e4dULL},
+  {0x5f1a07cb6b42f3a6ULL,0xf6563620461af26aULL,0x68a063ef22aa489cULL,0x6332731167bed8afULL},
+  {0x85a52acf8b8ed029ULL,0x88fa5898eb286e79ULL,0x4964b6eb4a72a35bULL,0x54a38d7f1cb06cfeULL},
+  {0x535230f948080263ULL,0xad66e50ad798a0d3ULL,0x2305c2017e8654dbULL,0x8a40d9259a393b38ULL},
+  {0xd7b1a0297a9832a2ULL,0x5b39a16efb1376d2ULL,0x12093e635130275aULL,0x954b544fc17ced53ULL},
+  {0xcdfdeaf82078645aULL,0xa6a02c8bcc20b17dULL,0xf517fd3f9a05b7deULL,0xe714710727c7420aULL},
+  {0xdb84e208a0664ba9ULL,0x457f06acd3ec84e8ULL,0xefb655513d9420aaULL,0x38add3d6209080c8ULL},
+  {0xcae1f69c9661c82dULL,0x9922bce891c026c0ULL,0x1e42a68553952c2ULL,0x6131291cd95fb878ULL},
+  {0x5defc382a812022cULL,0x48b26d6791fc1417ULL,0xa69dae2afe315336ULL,0x58af3ff6ad4c5fa7ULL},
+  {0xb782bcf1d1ca4951ULL,0xfc5e2aa9da5003bfULL,0xd0a9bfa81788809eULL,0x4bc4f845b6764692ULL},
+  {0xa393dd3cc13daf9bULL,0xacd81f2c129e2e9bULL,0xbfd83186bad43acULL,0xcdaf553843b6c241ULL},
+  {0x698e6ecaa2be67dfULL,0x52865b5d582a201fULL,0x29f9bff5c985f364ULL,0x45a880a27bbee9dfULL},
+  {0xa4ed5ae98e67e053ULL,0xe007afbf034336bcULL,0xd1237ba589e53688ULL,0x54d6c11add0ad7e3ULL},
+  {0xf21f1a0d4af4f2a4ULL,0x877e5495b21500d3ULL,0x64d6847a220145d1ULL,0x6a826a38317c0c86ULL},
+  {0x71d7055e766e2a61ULL,0x630f89e2ddeb8eebULL,0x7ce22c9d50d0d0e4ULL,0xba295548376a319ULL},
+  {0x613e8a34366a23a9ULL,0x8bd860de7c6cc75fULL,0x6cc8aa1b09dce572ULL,0x15356506f255f7e9ULL},
+  {0xf995de1d41a41d4eULL,0x9b27a6d32f35519bULL,0x2a7708bb1a4928fbULL,0x63d208b1d5da7078ULL},
+  {0x2b5e1ca0f2b89b91ULL,0xcacff3a5cca6443aULL,0x6b86517802dac2ecULL,0xf3bc12aef53d9f5fULL},
+  {0xc4768f698e6eccd5ULL,0x70699299b46fd20eULL,0xbab09f3f711b8944ULL,0xd2fe6f2a4a5b2302ULL},
+  {0x6f728297335c0fd4ULL,0x22320bef58453373ULL,0xf7a26ef18b387649ULL,0x7e3c8c6dfa04a536ULL},
+  {0x2a7f83c6fe4dd676ULL,0x9141a9e58f01a821ULL,0x921dac67a08a99a9ULL,0xd31c9cb3077dffdULL},
+  {0xd8844608ad0369d8ULL,0x6943ab9bd6e17223ULL,0xc161c696d85155feULL,0x198cbfcfa0575fc2ULL},
+  {0xcdb7e17db1aa5da5ULL,0xf8377bda229c85dcULL,0x692c9d158b0fed48ULL,0xd78d9e6e3949fb2dULL},
+  {0x3aeb1350afb0e5e8ULL,0x5a147caa780b1fd6ULL,0x22183c089089b90dULL,0x1e056e89b68cf35aULL},
+  {0x854de34ac5146e2cULL,0xe38747872eb0f194ULL,0xaf2eaee0d2c8108dULL,0x32a2371e19493415ULL},
+  {0x3fac729e72faaa21ULL,0xd8108144ce7f98fbULL,0xa6173b2f1a646d47ULL,0xdc7ff9748d827e7eULL},
+  {0x2b2524cff17db5aaULL,0xbe54fd1050964433ULL,0xd04e6dc6dbe5af58ULL,0xfae90a817f8e22f6ULL},
+  {0x9a99da1b2fd28e79ULL,0x36b2eff0bf8f8ec2ULL,0x5354bc11cdfbc48ULL,0x71b95efcc4981e07ULL},
+  {0xac76a68d881cff57ULL,0x370628799f0042d5ULL,0xbe4ff75fc7f23c78ULL,0x552ccd9a6dc6ed77ULL},
+  {0x6876883ade542b3aULL,0xf6b96121897044aeULL,0xc9f3e8ffa25bba83ULL,0x43854caf29dc2bd6ULL},
+  {0x218467b781380011ULL,0xa7dbfe1ceb3c3046ULL,0xb6159caa1834e391ULL,0x4b4c722cdafe6b53ULL},
+  {0x45c2ecf2d427b222ULL,0xb6eff990fb877961ULL,0x708c9b730d5fd084ULL,0x2adfe17090e9f9cULL},
+  {0x6ef85d9f839e9307ULL,0x45007d49f44be010ULL,0x789149b4deb5e017ULL,0xa401466c36306589ULL},
+  {0x471e3e8227a9d6f9ULL,0x9f70c54ae33c620ULL,0x15b3a5343b3ff31aULL,0xa123452c2b7eaf31ULL},
+  {0x59eac485c16b9f1fULL,0x1fac813a96608f9cULL,0x20cbf7a8bfda75acULL,0x9e6d1d11b1010556ULL},
+  {0x3d06e32ccec0a6abULL,0xaab166ae7decca60ULL,0x86c1521761348737ULL,0x9b89a3c2ca995a81ULL},
+  {0xc5a94d0a9b2ac0eaULL,0xb45d15557178df96ULL,0xf407989c69a5fa44ULL,0x36e42046e6ff9497ULL},
+  {0xc907964611e9e9b2ULL,0x384b04339ed8b2edULL,0x8e2b9a0dc45272bULL,0x64dd7457e7d9d739ULL},
+  {0x5033637562d46286ULL,0xc3ba1c7ec9293fdeULL,0x4fd3a6f3416ab8cfULL,0x2c5654e3e9511b21ULL},
+  {0x6b35767d6fa2176cULL,0x20abba421c7f550aULL,0xd327fd714eb71c87ULL,0x59227431be607c6bULL},
+  {0xa520dcfc7afd0ee3ULL,0xe1575fac35347aaeULL,0x42435e45738a1fc0ULL,0x8d58e0c7f81ffd92ULL},
+  {0x8c5106ef795fe2c2ULL,0x843b7d08a7237bdcULL,0x1c80ddf199374363ULL,0x53d765cdadb26e9eULL},
+  {0x78a3851d834b7bc5ULL,0x66182f26e1ef5088ULL,0x4e1b53eba3fc6487ULL,0xaeeca6c51962ff44ULL},
+  {0x6d7b519a57bb66afULL,0x452ee909b66ffc1ULL,0x523a989c0f5ff6c1ULL,0xe507de9ec16b3bf3ULL},
+  {0x873da3e3e7096167ULL,0x96217bfbc3765457ULL,0x7965744876cd683fULL,0xad67f8ec3b9270f3ULL},
+  {0x5569c98339b4a6f2ULL,0x65601d76e2a57983ULL,0x81903b8cb9f60b7aULL,0x16f48c60eb84fb2ULL},
+  {0x3199ed26d0cf5b23ULL,0xe616e3c00cbfa3f7ULL,0x4a8015d9d001dd58ULL,0xa88477a4bbd192a0ULL},
+  {0xcab6339e1446056ULL,0xbb98e382a3b3af9ULL,0x270b513233d12d85ULL,0x650471ae774265e3ULL},
+  {0x9cc896ecfda0741eULL,0x3472a630354b893ULL,0x67582ac3dc16263dULL,0xd7141263f49b52d0ULL},
+  {0x559aac2abc21dda8ULL,0x348d1ba1fd7ac821ULL,0xcc90e19d69825faeULL,0x15dea416fa34584fULL},
+  {0x9b1a22423c00c0e9ULL,0x87e8962e773936f5ULL,0x12bcf93290c8b916ULL,0xb765379dd0ce61f6ULL},
+  {0xdc5cba07b05b46e2ULL,0xee9d6a07b4f7c751ULL,0x3db900878357ba46ULL,0xb42b24954f1f70edULL},
+  {0x6269a8de20457a2fULL,0xb4b29346bce2383aULL,0xc04b336ac4e2d15aULL,0x57eaa919a8428f13ULL},
+  {0xa17fc57fc0230f83ULL,0x6ab10b7e8e250960ULL,0x1dab1125dec9b460ULL,0x8e9e4f5c6aeac31ULL},
+  {0x6af37c9586c9257dULL,0x2dddc948770dcd1cULL,0x9e09a08f9c47da92ULL,0x9743e81db8951246ULL},
+  {0x29549fe93fe1ac2eULL,0xd6f2bb81f804b528ULL,0x8627fb63bd4d50bfULL,0x87be732373bd4b73ULL},
+  {0x46beae21f38eb0abULL,0xb9d48c9132d6932bULL,0x7c0afb33275efa0bULL,0xf535fcf0dbf4a517ULL},
+  {0x2727e1659d60f7ULL,0xd2cfd466af34ac95ULL,0x85e9514ab5c8924dULL,0x43601d61c8363874ULL},
+  {0xa549aca42390eb9fULL,0x4fe4937014412b1eULL,0x2e6a29898e95f7f1ULL,0x34fd3c50ce93565bULL},
+  {0xa0daafa32ab49d0dULL,0x6902e3942a2560acULL,0x365f0bcbba66af96ULL,0x341b1580f83071c5ULL},
+  {0xe885f0be51d324baULL,0xf0f9594fb445a474ULL,0xe5212c847b322e73ULL,0xb1c145fa89deb0ccULL},
+  {0x57627171f14dad95ULL,0x33ac1aa8e56492ebULL,0x7c7181e2c79fb154ULL,0x175e7cb3ce4a3a43ULL},
+  {0x1ece2218dc1eedf1ULL,0x1d4b391c2c167694ULL,0xb5ee8f0f087a90b3ULL,0xe7e90db9c68fb748ULL},
+  {0x249e45c1307165adULL,0x89c1e4954c80ba98ULL,0xe3b3c8482ca3ecacULL,0x5ad430cc64e61c61ULL},
+  {0xb739ff14eece9be5ULL,0x9a7a2aa2b9c707eaULL,0xead13c9dc41a0cedULL,0xe5d533d0b1a50075ULL},
+  {0x8aefefa60db8b837ULL,0x80f0ce3dd7d09f2ULL,0x988602df07fa84c1ULL,0x41dce0d96dace318ULL},
+  {0x480ceec6b11708d6ULL,0xfdd5ad5864f0b208ULL,0x6b247da76fb322b5ULL,0x8623a0242997d4d9ULL},
+  {0xa23cc14239961bccULL,0x9aed2d5e0432fe5bULL,0x103c1dc252067643ULL,0xa5ef449887104ddaULL},
+  {0xded5a9c6edb33c7fULL,0xcaa92b4d28fb0f20ULL,0x4ca355603ac6073ULL,0xee38bcc9c07b2c0eULL},
+  {0x6db57235fb3a9d45ULL,0x18225f2e2d6d5e62ULL,0x38bdf68b852a2cbeULL,0x4da26ece9ad46003ULL},
+  {0x3386f2303e62a830ULL,0xa9502af9a5a384ddULL,0x8c7ec4b0ec577f41ULL,0x5c4f5b92acb30eeULL},
+  {0x29dedc69f98f4763ULL,0xe9d9558511e69111ULL,0x488d8eb16a19a4f7ULL,0x6e621e6f53d2408eULL},
+  {0xd1a0a7ebaf176c59ULL,0xac3c67b10e1c262bULL,0xf9845bd73aca2c3fULL,0xa01fa1d039ffdcf7ULL},
+  {0xda4554d5278be83bULL,0x66bae20a8f082ab6ULL,0x9b57ea758a395a90ULL,0xebaf57645bed7469ULL},
+  {0x8f3c7effdb7efbfdULL,0x25c8c5e0b5fe8b36ULL,0xb3e13d57ffa04267ULL,0xcafe3746efcaafe3ULL},
+  {0x6a6ff6353310182fULL,0xfaa38ca11438c17aULL,0x24b55dbf052b15d2ULL,0xc0f88a71711b632dULL},
+  {0xd183073e086303bbULL,0xc2000654b98625afULL,0xfc9954b772ee03b8ULL,0x1169517b36adaecdULL},
+  {0x1b5287b05b5c6350ULL,0xdc1cddb73cf70ae0ULL,0xc6244fbf262922c6ULL,0x5d9b6c1884b79498ULL},
+  {0xecf734de8d4afe93ULL,0xbf46c6d8342ce4c2ULL,0x33c29be27eb55ca7ULL,0x1bd37624603ad841ULL},
+  {0x654c49f04e02e21cULL,0xe57d759555904016ULL,0xd4f214c6323a53b7ULL,0xd1d1360f37ed6e69ULL},
+  {0xd1a62db35e5a0efcULL,0x88fec599840554a3ULL,0x654b195156ea885bULL,0xd819f05a2b256434ULL},
+  {0xe4969ccbee411731ULL,0xace29a8365674703ULL,0x58acfa1897b1b2b2ULL,0xefc987cbf1023af5ULL},
+  {0x9d2a50d2b9b4565bULL,0x3a4037f6a4b3c97ULL,0x9926e3c74cea9f81ULL,0xe95f2ecc2a6f8517ULL},
+  {0x31090faa18284ff0ULL,0x968d1d7b83ef6b01ULL,0x61b88b7873864480ULL,0xf3026b97163df3bdULL},
+  {0xa77f2ffccf816c09ULL,0x4ade43bdfd6ff05fULL,0x54f0bd1f5d5db164ULL,0x7bb81730470f80d0ULL},
+  {0x5622090d682c5873ULL,0xdeeecf968ff830bULL,0x92ac92c68c9cff46ULL,0x5d34ff5f123b5b69ULL},
+  {0x15cf66b400c5c4a2ULL,0xd19aaa9bf484cae4ULL,0x72e19a795e2f26c4ULL,0x34670a0fd7442419ULL},
+  {0xdac67280468447f4ULL,0xe0ee591d31a9b0bbULL,0xc39da06584308cc8ULL,0xcbf9ba1794a95247ULL},
+  {0x7958202262098d15ULL,0x44258f8bdf27a502ULL,0xb46edc0609a49fc0ULL,0xe8b6d43b8c8ad16bULL},
+  {0x79acacd4c7dcd31fULL,0x8e7747b8368d7a53ULL,0xbf5982a6b57a7344ULL,0x920975ba09e2261bULL},
+  {0x281cd432a7abe2e9ULL,0x8e9b7f5f9a964ba1ULL,0xef5b4ea5d0aa1760ULL,0xd902ff7196ddc842ULL},
+  {0x33fcf13207eeca64ULL,0x391323123bc180ffULL,0x926cdce82b4f25d0ULL,0x815b2ae46fdcb55dULL},
+  {0x1027f5d7abf26691ULL,0xc402465ac9ef1abfULL,0x41261d431ed5d6b5ULL,0x7de7ff4adac9e8c0ULL},
+  {0xde3c454f7e0b16eULL,0x27ca8025da231926ULL,0x30ea86397a4d387eULL,0x1bb9a6c28e28d4baULL},
+  {0xe2eac38c5a21cca3ULL,0x1cac180586e0593dULL,0xe188ab31bff04795ULL,0xdec5646cf68e99d4ULL},
+  {0x34d337c6da68bc22ULL,0x9c05a4ba78eb4c3dULL,0xb099d29ddde278f1ULL,0x6f0153fedffd83eaULL},
+  {0xa23db209b94d95ddULL,0x15827ab192badab5ULL,0x49c76eabca8f836fULL,0x5578c43ad6e125c4ULL},
+  {0x2e9cb7a91b20258aULL,0xed23e5e6c6dae855ULL,0xd00d38471bf555aULL,0x3454f73b3bee77a4ULL},
+  {0x678fb8f58ae63078ULL,0xf7136fc937924c39ULL,0xa9ab2130bdc4870aULL,0x7a6dde243e278c95ULL},
+  {0xfc59317c230e9a86ULL,0x1dfcf68640eddf02ULL,0x1b8c2616ad528030ULL,0x367807c9a3606b4eULL},
+  {0xa4e269ab79ad5a63ULL,0x325e6d15b0827d6fULL,0x8c69d32b0c8528d9ULL,0x6e8f70652c33ef0bULL},
+  {0xacba5941201af62bULL,0x1b8254175fc4909ULL,0x1374e06f0c44b815ULL,0x8ec4fdc39891f6afULL},
+  {0x926e2c00ef34a24dULL,0xadbc968d9e159d0ULL,0x905a857a9cf918d5ULL,0x465370b287a79ff3ULL},
+};
+static const uint64_t cpuGy[][4] = {
+  {0x9c47d08ffb10d4b8ULL,0xfd17b448a6855419ULL,0x5da4fbfc0e1108a8ULL,0x483ada7726a3c465ULL},
+  {0x236431a950cfe52aULL,0xf7f632653266d0e1ULL,0xa3c58419466ceaeeULL,0x1ae168fea63dc339ULL},
+  {0x6cb9fd7584b8e672ULL,0x6500a99934c2231bULL,0xfe337e62a37f356ULL,0x388f7b0f632de814ULL},
+  {0xcfe97bdc47739922ULL,0xd967ae33bfbdfe40ULL,0x5642e2098ea51448ULL,0x51ed993ea0d455b7ULL},
+  {0xdca87d3aa6ac62d6ULL,0xf788271bab0d6840ULL,0xd4dba9dda6c9c426ULL,0xd8ac222636e5e3d6ULL},
+  {0x3c870c36b075f297ULL,0xde80f0f6518fe4a0ULL,0xf3be96017f45c560ULL,0xae12777aacfbb620ULL},
+  {0xa5082628087264daULL,0xa813d0b813fde7b5ULL,0xa3178d6d861a54dbULL,0x6aebca40ba255960ULL},
+  {0xb5da2cb76cbde904ULL,0xc2e213d6ba5b7617ULL,0x293d082a132d13b4ULL,0x5c4da8a741539949ULL},
+  {0x5cc262ac64f9c37ULL,0xadd888a4375f8e0fULL,0x64380971763b61e9ULL,0xcc338921b0a7d9fdULL},
+  {0x3cbee53b037368d7ULL,0x6f794c2ed877a159ULL,0xa3b6c7e693a24c69ULL,0x893aba425419bc27ULL},
+  {0x301d74c9c953c61bULL,0x372db1e2dff9d6a8ULL,0x243dd56d7b7b365ULL,0xd984a032eb6b5e19ULL},
+  {0x6b051b13f4062327ULL,0x79238c5dd9a86d52ULL,0xa8b64537e17bd815ULL,0xa9f34ffdc815e0d7ULL},
+  {0x29b5cb52db03ed81ULL,0x3a1a06da521fa91fULL,0x758212eb65cdaf47ULL,0xab0902e8d880a89ULL},
+  {0xc65f40d403a13f5bULL,0x464279c27a3f95bcULL,0x90f044e4a7b3d464ULL,0xcac2f6c4b54e8551ULL},
+  {0xc504dc9ff6a26b58ULL,0xea40af2bd896d3a5ULL,0x83842ec228cc6defULL,0x581e2872a86c72a6ULL},
+  {0xe1f32cce69616821ULL,0x1296891e44d23f0bULL,0x9db99f34f5793710ULL,0xf7e3507399e59592ULL},
+  {0xcfb199f69e56eb77ULL,0xced1f4a04a95c0f6ULL,0xe997b0ead2a93daeULL,0x4211ab0694635168ULL},
+  {0xf5192e5e8b061d58ULL,0x81d8e0bc736ae2a1ULL,0xe9e298043589351dULL,0xc136c1dc0cbeb930ULL},
+  {0xb570c854e5c09b7aULL,0x1a01f60c50269763ULL,0xb343083b5a1c8613ULL,0x85e89bc037945d93ULL},
+  {0x450288ee9233dc3aULL,0x6162948271d96967ULL,0x5da61fa10a844c67ULL,0x12ba26dcb10ec162ULL},
+  {0x67bd3d8bcf81998cULL,0x4a1b3b2e71b1039cULL,0xd59c18259dda3e1fULL,0x321eb4075348f534ULL},
+  {0xdb20717ad1cd6781ULL,0x743034b37b223115ULL,0x16f6db7e225d1e14ULL,0x2b90f16d11dabdb6ULL},
+  {0x423ba76b532b7d67ULL,0x181d70ecfc882648ULL,0xb64569335bd5dd80ULL,0x2de1068295dd865ULL},
+  {0x978ed2fbcf58c5bfULL,0x1dc88e36b4a9d22ULL,0xd3ab47e09d729981ULL,0x6851de067ff24a68ULL},
+  {0xe54a32ce97cb3402ULL,0x3fc0de2a887912ffULL,0x5d1aa71bdea2b1ffULL,0x73016f7bf234aadeULL},
+  {0xb32e83b25c83ad64ULL,0xef8e529f033f272ULL,0x1a1fa873825c7200ULL,0x3fd502b3111178b1ULL},
+  {0xab40e52290be1c55ULL,0x3f83c230f3afa726ULL,0xd4a1aca87ef8d700ULL,0xa69dce4a7d6c98e8ULL},
+  {0xd0689f2f493be3c8ULL,0x40973bce1c95052dULL,0xb1e718bf4042585ULL,0x7d916a47b2b58140ULL},
+  {0xa039063f0e0e6482ULL,0xe106e861edf61c5ULL,0x76c45926c982fdacULL,0x2119a460ce326cdcULL},
+  {0x8dbac47a17f388fbULL,0x776238aa0bd5ff24ULL,0xc739ddfa33604a83ULL,0xacb82eb93309ad1cULL},
+  {0xfd5e6348100d8a82ULL,0x8b33ba48d0423b6eULL,0x8b3f5126f16a24adULL,0xe022cf42c2bd4a70ULL},
+  {0x5b3ff1f24106ab9ULL,0x1f760cc364ed8196ULL,0xb3d6dec9e9838065ULL,0x95038d9d0ae3d5c3ULL},
+  {0xadee9d63d01b2396ULL,0xa2cf15009e498ae7ULL,0x27561506e4557433ULL,0xb9c398f186806f5dULL},
+  {0xff1822f5d1f30e79ULL,0xc076329c75146bc6ULL,0xb3ca6265f9400779ULL,0xbebc47511ade7308ULL},
+  {0x3b01e1e9056b8c49ULL,0xc26bfae84fb14db4ULL,0x81a78d93ec96fe23ULL,0x2972d2de4f8d206ULL},
+  {0xdfd6e3f50e7da3acULL,0xbb5b10f4bd8aa51eULL,0xee7a347a5e4681f9ULL,0x76d458642a2c93adULL},
+  {0x35f5642483b25eafULL,0x1aa132967ab4722ULL,0x98088a1950eed0dbULL,0x80fc06bd8cc5b010ULL},
+  {0xb745bc318a51ab04ULL,0xd9d7268126c76a16ULL,0x5a096ee637ebed3bULL,0xd505700c51d860ceULL},
+  {0x1aa01f56430bd57aULL,0xa65eed4cbe7024ebULL,0x26e66bad7fe72f70ULL,0x1c38303f1cc5c30fULL},
+  {0x9a9a2e83124a7899ULL,0x55b03158202a9d3eULL,0xe34e7a1009f87251ULL,0xeb9ef6c031eed31dULL},
+  {0x2d499ec224dc7f7ULL,0xbdc59ea10c70ce2bULL,0x9559e0d79269046ULL,0xd0e3fa9eca87269ULL},
+  {0xe531c573cda9b5b4ULL,0xfae4db40801a2572ULL,0x134ac7c1d371cffbULL,0x7b158f244cd0de2ULL},
+  {0x63465b521409933ULL,0xbc4345405c520dbcULL,0x9966f21881fd656eULL,0xeecf41253136e5f9ULL},
+  {0x1879a7cabf06fb68ULL,0xa1d1f34761c6cf26ULL,0x2decbab8d098a8c2ULL,0xdb2ba972802d45fdULL},
+  {0xb653052a12949c9aULL,0x54c3f3afbb5b6764ULL,0x8b3081b0512fd62aULL,0x758f3f41afd6ed42ULL},
+  {0x517ab5c246242203ULL,0xd0a986928ac79972ULL,0x6be1883b362f123bULL,0xbd8e9dc301d9adc9ULL},
+  {0xbe8eb3c7671c60d6ULL,0x96c95330d97077cbULL,0xa08266e9ba1b378ULL,0x958ef42a7886b640ULL},
+  {0x498a2f7805a08668ULL,0x3a496a3a3bf8ec34ULL,0x592f579074b875a0ULL,0xd50123b57a7a0710ULL},
+  {0x1a117dba703a3c37ULL,0x9eb5fbeb0598e4fdULL,0x4da1f32dec2531dfULL,0xe0dedc9b3b2f8dadULL},
+  {0x50bd28c17c470134ULL,0x151b423eac4033b5ULL,0xa0eba45a7a41876dULL,0xc39d07337ddc9268ULL},
+  {0x1cb377b01af7307eULL,0xc622e27c970a1de3ULL,0x43114306dd8622d7ULL,0x5ed430d78c296c35ULL},
+  {0x30b83fd19adc87cdULL,0xc7048846d46ade00ULL,0x4c16662fc134fadcULL,0x7ed520327080a9faULL},
+  {0xd6579962c4e31df6ULL,0x2a6c53c26e5cce26ULL,0x13d206fcdf4e33d9ULL,0xcedabd9b82203f7eULL},
+  {0x90f3743d00fdaefbULL,0x422cc82409d50796ULL,0xae4d91eb555010aaULL,0x25a5208b674bfd4cULL},
+  {0xc32f908318a04476ULL,0x5f4fa9b7962232a5ULL,0xa41b643fa5e46057ULL,0xcb474660ef35f5f2ULL},
+  {0xf216512417c9f6b4ULL,0x4f7ce5c6fc73a6f4ULL,0x525a3e7dbf0d8d5aULL,0x5bea1fa17a41b115ULL},
+  {0x4b0be9475a7e4b40ULL,0x5ac6be74ab5f0ef4ULL,0xa693b03fcddbb45dULL,0x4119b88753c15bd6ULL},
+  {0x99025ec62b034e02ULL,0x64558508362bc5fcULL,0xacf931bfbd9c32a2ULL,0x9403d11a2b419edaULL},
+  {0xd9e76f302c5b9c61ULL,0x4ecfc061d57048baULL,0x3d1d5e590f78e6d7ULL,0x91b649609489d61ULL},
+  {0xb54e3d341904a1a7ULL,0xa7cc69244f295166ULL,0x42dad154e1116edULL,0x1124ec11c77d356eULL},
+  {0xc5d98093c536683ULL,0x23ee33d0197a695dULL,0xb3cd0ed304ea49a0ULL,0x673fb86e5bda30fULL},
+  {0x5b04403db9581a9fULL,0xd60282d32adfca55ULL,0xf055520d4db8c49fULL,0x4e7b5daba34fbcf9ULL},
+  {0x67002af4920e37f5ULL,0xa5a2283993e90c41ULL,0x40c0aa58379a3cb6ULL,0x59c9e0bba394e76fULL},
+  {0x4dc37efe66831d9fULL,0xc522fc54811e2f78ULL,0x7ad928a0ba5392e4ULL,0x5cb3866fc3300373ULL},
+  {0xa4a797f86e80888bULL,0x21fb8090895138b4ULL,0x2e17446e204180abULL,0x3b952d32c67cf77eULL},
+  {0xe3071c74b063c5e1ULL,0xaa2c8068f1845197ULL,0x92999ee9c438d47eULL,0x6f6f0e0784eada9fULL},
+  {0x17b8c45cf2ba2417ULL,0xb157222720ef9da2ULL,0x5f862b785dc39d4aULL,0x55eb2dafd84d6ccdULL},
+  {0x4ff98b2aae170cf8ULL,0xa0d0e6436da1675ULL,0x4173867ab5324be4ULL,0x49ba3203048e06d8ULL},
+  {0xcdc706ab7399a868ULL,0xc13c66c0d17a2905ULL,0x61e8cec030c89ad0ULL,0xefae9c8dbc141306ULL},
+  {0xa2043e7791c51bb7ULL,0x56efe24d228bfe6eULL,0xde652a340600c73ULL,0xecf9665e6eba4572ULL},
+  {0x6d003afd41943e7aULL,0x5b29c094db2a2314ULL,0x988d00bcf79af25dULL,0xe38da76dcd440621ULL},
+  {0xf9ddc14e86be1ebfULL,0xfad3da15d691efa4ULL,0x462e21f336a8971dULL,0x3f1d72d253a01dfcULL},
+  {0xbc2feded498fd9c6ULL,0xc8cd5aa667a15581ULL,0x9a93b0e6f35cfb40ULL,0xf98a3fd831eb2b74ULL},
+  {0x9d3a95324e543c49ULL,0x9afd48bbc2a2cfb4ULL,0x74eaa876aa416cf5ULL,0xcc26479830e10370ULL},
+  {0x2c924f97cbac5996ULL,0x97584a65fa06ceddULL,0x8dcc887980da38b8ULL,0x744b1152eacbe5e3ULL},
+  {0x7f6bf255f1337ff0ULL,0xb2f75ab36207e155ULL,0x108c0a99d567fba9ULL,0xbdacd9a05fb9fb73ULL},
+  {0xd85e216c4a307f6eULL,0x42ce739a7919798cULL,0xf4ea6ce648309a0ULL,0xc534ad44175fbc30ULL},
+  {0xeb13f199399f4ec9ULL,0x90f3408491c470b4ULL,0x2e754603b426bc0dULL,0xec93e49c88fc8565ULL},
+  {0x778419bdaf5733dULL,0x6949e21a6a75c257ULL,0x63bf4bc808341f32ULL,0xe13817b44ee14de6ULL},
+  {0x53013eafa44ee737ULL,0xfe6043c9dd68844eULL,0xe0fe953a8edaa929ULL,0x38a9743b4bc299e9ULL},
+  {0x37a48b57841163a2ULL,0x8d1e4e350b6cbcc5ULL,0x224b967c3020b8faULL,0x30e93e864e669d82ULL},
+  {0xc128b757cdd92acbULL,0x358eb4e66a331b76ULL,0x9c4d07d56a198decULL,0x21868874cc2cb5a7ULL},
+  {0xcbba2cae5347d57eULL,0xdf9154efbd2ef1d2ULL,0xd5d28a3224b1bc25ULL,0xe491a42537f6e597ULL},
+  {0xe5ec95ee2a1eceeULL,0x420e76859e59e54eULL,0x64ef68644823be8aULL,0x90e9991a7304206aULL},
+  {0x60afa5b29db83437ULL,0x12507a051f04ac57ULL,0xd5c1fc133ef6f6bULL,0x100b610ec4ffb476ULL},
+  {0xa7ed795b923b9722ULL,0x7ae69493fda866f8ULL,0x4653a557449ff8b2ULL,0x9807da341a297ee8ULL},
+  {0x7e7d15a0de293311ULL,0x6039e77c15c2378bULL,0x8e1652c48e8127fcULL,0xef0afbb205620544ULL},
+  {0xe3ab823d6581cc28ULL,0xaf9915f0377906f1ULL,0xcb32648c493af7deULL,0xa24d6d07ede1cedeULL},
+  {0xafb34db04eede0a4ULL,0x3c2ad46290358630ULL,0x89c5e9be8f9508aeULL,0x8b378a22d827278dULL},
+  {0x4c481324a6c8912bULL,0x5d6406cbfcd76e17ULL,0x34db14f93706891dULL,0x6e638df7a9105bbcULL},
+  {0xcc06e2a404078575ULL,0x896878f5282be4c8ULL,0x914448c6cd9d4caULL,0x68651cf9b6da903eULL},
+  {0x75d5e1f0201f1dedULL,0x823ac662e052fa27ULL,0x2aaf43c6b4e4ebf1ULL,0xd03ce0b8ef7aa8aaULL},
+  {0xc54673bc1dc5ea1dULL,0x3e1ef8e0201e4578ULL,0x485a4d8b8db9fcceULL,0xf5435a2bd2badf7dULL},
+  {0x79b16d545167625eULL,0x8935e6d57f30002aULL,0xc5339c7d978e3b74ULL,0x1d1d201c7c29525cULL},
+  {0xfc37bbe9efe4070dULL,0x434800bacebfc685ULL,0x34f5137b73b84177ULL,0xd56eb30b69463e72ULL},
+  {0xcb0289e2ea5f404fULL,0x9501253aa65b53a4ULL,0xe90b9c08485d01b3ULL,0xcb66d7d7296cbc91ULL},
+  {0x19212d39c197a629ULL,0x641462a54070f3d5ULL,0xb2e90737309667f2ULL,0xedd77f50bcb5a3caULL},
+  {0x654f3ee5c9e6c1c2ULL,0xb6f36b14fbf54ad1ULL,0x6ec19e9ce26ae4bdULL,0xc80f1d852659b418ULL},
+  {0xe43d06d77d31da06ULL,0xa38289154964799bULL,0x88b430a69f53a1a7ULL,0xa855babad5cd60cULL},
+  {0xfce17ad5e335286eULL,0x97bd17be084895d0ULL,0xdcda5e8a7a1f87bfULL,0xe57a6f571288ccffULL},
+  {0xbd80f0b1286d8374ULL,0x871ec5a64feee685ULL,0xffd1f04788c06830ULL,0x66db656f87d1f04fULL},
+  {0xc7032f99470bef44ULL,0xdfefdefd1262bca4ULL,0x7f86709d01d2b66eULL,0xfae7bc16185fc1a6ULL},
+  {0xc5321857ba73abeeULL,0xd57f1ceeb487443dULL,0x54bd46f730174136ULL,0x9414685e97b1b59ULL},
+  {0xe6db815548473ccULL,0x99ac0b24e3a90c27ULL,0xb7f1c9750e28afeULL,0xa20c096cf36367bfULL},
+  {0xd8c2962a400766d1ULL,0xf4b08d3c07b27fb8ULL,0xf73af4544cccf6b1ULL,0x4cb95957e83d40b0ULL},
+  {0x2f80fd5dc15e76bdULL,0x9a859739bea9b37eULL,0x9297ff08e74df0bdULL,0xb4d0e7ef521c1c81ULL},
+  {0x411e0315eaa4593bULL,0xff15db5ed3c049b3ULL,0xe1010f337ad4717eULL,0xfa77968128d9c92eULL},
+  {0x21eaef2c7208e409ULL,0x6a8fedc6f9e8ead4ULL,0x806527d1daf1bbb9ULL,0x2d114a5edb320cc9ULL},
+  {0x118d14b8462e1661ULL,0x2e6dac9e6f26e961ULL,0x9ccd3d7915b9e1daULL,0x5f3032f5892156e3ULL},
+  {0x21ee1baef2bb04cdULL,0xcd14d9dd764d4726ULL,0x6af5b9dd4a6600d7ULL,0x9ae0247b2342180cULL},
+  {0xb39847b3cc092ff6ULL,0x2eee1ff50c986ea6ULL,0xcbdddcae0aa44254ULL,0x8ec0ba238b96bec0ULL},
+  {0x1e786104f47797f0ULL,0xae93a0bae7389730ULL,0x54a9b4bf719f02dfULL,0xe5f28c3a044b1cacULL},
+  {0xebaac479ec1c8c1eULL,0xa446989af04c4e25ULL,0x4c5f37e0ecc5f9f6ULL,0x8dc2412aafe3be5cULL},
+  {0x3b98e9611f5dc208ULL,0x90ab454e65e5ec9eULL,0xbc306c9b6c15494aULL,0x646fa5b5fcdad2d3ULL},
+  {0x9626778e25b0674dULL,0x9d58186a50e49713ULL,0xd0e8c2a7ca5804a3ULL,0x5e4631150e62fb40ULL},
+  {0x5d4e075e32808785ULL,0xed8bd517407373fdULL,0xf656a354b9c92684ULL,0x28312a55765d0435ULL},
+  {0xb18041024edc07dcULL,0xd784869d7e6ea67fULL,0x19a528391c994624ULL,0xf65f5d3e292c2e08ULL},
+  {0xf58513f8fb152bceULL,0x19e16b89ce982871ULL,0x3f876ff45961a83cULL,0xa26becc5ea1819d3ULL},
+  {0x62b675f194a3ddb4ULL,0xfa1fbd583c064d24ULL,0xd5404795539a5e68ULL,0xf3e0319169eb9b85ULL},
+  {0x94a0753a915b644cULL,0x42425d84290545f2ULL,0xd0d6e193aaaf5a56ULL,0xd6b837116fa89fa1ULL},
+  {0x55f4b031880d562cULL,0xf925ce30d767ed6eULL,0x39ba7f075e36ba2aULL,0x42242a969283a5f3ULL},
+  {0x3e6ec481a8991472ULL,0xb8a5ffbeb480ba0eULL,0x63fd238833a12188ULL,0x995e555c8aabd2ULL},
+  {0x10026dbd2d864e6bULL,0x23fc63b65b35f86aULL,0x7e4b4a7140737aecULL,0x204b5d6f84822c30ULL},
+  {0x7048c13feb4785f6ULL,0x1a652cb086ee45d5ULL,0x1aaa132d75f7515fULL,0x672bd987c7e383baULL},
+  {0xed16e96b58fa9913ULL,0xd5caf9450f34bfc0ULL,0x49d245b328984989ULL,0x4f14351d0087efaULL},
+  {0xeb09520a981fdf32ULL,0xa81efa6b414a583eULL,0xb290cf45325af0b4ULL,0x9e2599b420982535ULL},
+  {0xe7a36de01a8d6154ULL,0xe62562d6744c169cULL,0x1904f9a1c7543698ULL,0x73867f59c0659e8ULL},
+  {0x8491067a73cc2f1aULL,0x55df16c3e8f8b681ULL,0x3f6619d89832098cULL,0x5d9d11623a236c55ULL},
+  {0x161384c746012865ULL,0xa99c9aed7d8ba38bULL,0xeebfc71181313775ULL,0x39f23f366809085bULL},
+  {0x7d5fa49229d31669ULL,0x306a0a11fdd22b0dULL,0xae6fae38ed6d2ec4ULL,0x65a58128f755afULL},
+  {0x6fd51cf5694c78fcULL,0x56ea13493fd563e0ULL,0x164227b085c9aa94ULL,0xd2424b1b1abe4eb8ULL},
+  {0xe9002dccb1af50ceULL,0x43ddf472fbb16491ULL,0x29ca19b9110c315bULL,0xb227f7d021263c6fULL},
+  {0xf3dcdcabd2fda224ULL,0x91f7ab1410cd1e0eULL,0x99252129b6e56b33ULL,0xead12168595fe1beULL},
+  {0x17c5de9e6f3aa216ULL,0x879b9ab8e9b75d4aULL,0x11263a75d9328a1cULL,0x8f8c3eec190df3d1ULL},
+  {0x58a47a9129cdd24eULL,0x503d459c3e898458ULL,0x44e654aef624136fULL,0x6fdcef09f2f6d0a0ULL},
+  {0x369ee69a35b4af25ULL,0x8be2ff17f252cebdULL,0xd2946af2a8737bb6ULL,0xbab2192b75324599ULL},
+  {0xe33a7d2057f3b3b6ULL,0x2306d320f1d03010ULL,0xa9c8ed618d24edffULL,0x60660257dd11b3aULL},
+  {0xfeb77705fc25f516ULL,0xe17549340a46831aULL,0x4286ae3f103a2074ULL,0xf46bfb389fdb7ce4ULL},
+  {0xc6fed3c35e999511ULL,0xfcafad1895d7a633ULL,0xf39048f25a8847f4ULL,0x3d98a9cdd026dd43ULL},
+  {0x5530a39d2e8d7639ULL,0xb34905a2087e6a25ULL,0x57337b85ccacbb62ULL,0x5af11032704e83d0ULL},
+  {0xcd2876eb2a27d84bULL,0xda61dc861c019e55ULL,0x6e2d8862179139ffULL,0xb4c4fe99c775a60ULL},
+  {0x786ef55ebe29887eULL,0x2abe221a176d0e2eULL,0xe8842c4bfd67c46cULL,0x202632e371066766ULL},
+  {0x50f049503a296cf2ULL,0x6b72da1834aff0e6ULL,0xec4b19d917a6a28eULL,0xae434102edde0958ULL},
+  {0x7ef1dc6418717decULL,0xb9352baaa63e144aULL,0xf64480e19393e90eULL,0x99a48e10ecfcb81ULL},
+  {0xb827ce62a326683cULL,0x422c086a63460502ULL,0x4b48f6d534ce5c79ULL,0xcf2174118c8b6d7aULL},
+  {0x8f163904bad1c7cfULL,0x3e0012f6af5c01dfULL,0xb92fd08559ee2a71ULL,0x17c4d13c535be360ULL},
+  {0x2cdec417afea8fa3ULL,0x13f996887b8244dULL,0xc63db50f1c0f1c69ULL,0x6fb8d5591b466f8fULL},
+  {0x6d5c41a70c1e9fdbULL,0xe7c5f702206dc0e8ULL,0x598a5284fc790673ULL,0x4abcdd05201e8bdULL},
+  {0xcfd652188a3ea98dULL,0xb7d4494bc2823700ULL,0xcfbfe369f7a7b3cdULL,0x322af4908c7312b0ULL},
+  {0x91475348ac0dce51ULL,0xafe9f96231d1d1c2ULL,0x5a75a2a70908f483ULL,0x82b83f8d79ec4b86ULL},
+  {0xf3dfbcdb71749700ULL,0x2520818680e26ac8ULL,0x2a034eafd096836bULL,0x6749e67c029b85f5ULL},
+  {0x266e2d163fc83d99ULL,0xe2268c7d1679757ULL,0xfc534d42aecc459ULL,0xa54b0056fbeb471bULL},
+  {0x3420a72eeb0bd6a4ULL,0xde97e4874f81f53ULL,0x16217f07bf4d0730ULL,0x2aeabe7e45315101ULL},
+  {0xbd249eeb28a2fea2ULL,0x9fabf3e9a060bd70ULL,0xe74e6b0c79b53775ULL,0xa049b1f4eefc6732ULL},
+  {0xeee98f1a4be5d196ULL,0x1ff0b053d25ca2bdULL,0xa60fc4775460c790ULL,0xb0ea558a113c30beULL},
+  {0x65a2b31f88196c47ULL,0xbab1d00db0dbc03aULL,0x189b5d017f8fdb76ULL,0x6db068bbf5499243ULL},
+  {0xc5767bea93ea57a4ULL,0x4ff536b01b257be4ULL,0x289d5833a7beb474ULL,0x998c74a8cd45ac01ULL},
+  {0xc121316a8ded4293ULL,0x87a558dadae0c580ULL,0xde8682090b6ec098ULL,0x51559be325b4d6d6ULL},
+  {0x61f79ca4c81bd257ULL,0xf9b8b9fdd270f66ULL,0xf9d4de7396fc18b8ULL,0xb2284279995a34e2ULL},
+  {0x60ab5efce8fe4c67ULL,0xa8333fea82bd1f12ULL,0x91e3531f66c0375dULL,0xf4a5b09543febe5fULL},
+  {0x940b74e3ac1f1b13ULL,0xf395b74fc4bcdc4eULL,0x1d1e0862db347f8cULL,0xbdd46039feed1788ULL},
+  {0x52c0bb205d654a9dULL,0x8209f6506fe4c0ffULL,0x6571de2ed92bcc04ULL,0x36e7ff517ad79fabULL},
+  {0xbb8e0f45eb596096ULL,0xd9b925bb4a4b3a26ULL,0x9a2fb6242f1a43a2ULL,0x6f0a256bc5efdf42ULL},
+  {0x7eb8538d1da95407ULL,0x52bfe6a7b0deab60ULL,0x656df2f95983cff2ULL,0x74eb8317416fe8fdULL},
+  {0xc0e8649113dc3a38ULL,0x75b740dd098075e6ULL,0xfd4473e16fe1c284ULL,0xc359d6923bb398f7ULL},
+  {0xb35f4eda136d08a8ULL,0x19b58fa4588cb4f5ULL,0x487708ebeb652d9fULL,0xa3bcd62645ceba65ULL},
+  {0x9862afd617fa9b9fULL,0x60ceb573c7060313ULL,0xb130619e2c0f95a3ULL,0x21ae7f4680e889bULL},
+  {0x4a6efe1a786fce55ULL,0x287d8f897b2b1b47ULL,0xa518bdc4c4e812e4ULL,0xc8ecc2845917b7ffULL},
+  {0x2689ff1e31c74448ULL,0x6d565ab687870cb1ULL,0x1c987f6ecec92f08ULL,0x60ea7f61a353524dULL},
+  {0x6b71df5b05c81ae8ULL,0xb6822f65e0a7a93bULL,0xc4ba2fbd12803a7bULL,0xa10ce6db4859d825ULL},
+  {0x7fea824b77dc208aULL,0x6673051b4935bd89ULL,0x9e78f07ce5680c5dULL,0x49b96715ab6878a7ULL},
+  {0x3592fc86703dad66ULL,0xecbde264616c3f61ULL,0x99a77f7feabe8213ULL,0xc6bd3cdf50b11f93ULL},
+  {0xbb5e83037e0fa2d4ULL,0x5db936156b9514e1ULL,0xc6de6caf2cb48956ULL,0x5ca560753be2a12fULL},
+  {0x4def01604ed38e14ULL,0xd61a7ec68024807aULL,0x3f5624422bbc0abcULL,0xe39a66553ac9f9d6ULL},
+  {0xa94473693606437ULL,0xa5492144cc54bcc4ULL,0xa7a8b33a07783341ULL,0x7571d74ee5e0fb92ULL},
+  {0x3069d623b9fa4343ULL,0x54379bcdd800b82dULL,0xfcf5f25527302df6ULL,0x6912a35beb5035cbULL},
+  {0x42ad961409018cf7ULL,0xac8db17bf7a76a2cULL,0xbcb9736a828cfa7fULL,0xbe52d107bcfa09d8ULL},
+  {0xbfd1e93bf71e23b9ULL,0x81c36d5c8710bb68ULL,0xd84c22cdd600ef63ULL,0x6c8e5d14a501c926ULL},
+  {0xf448a01c43b1c6dULL,0x149ef0be14ed4d8ULL,0x26b947ae2bcf6bfaULL,0x8fd64a14c06b589cULL},
+  {0x21ab2902da0ff381ULL,0xc67205e31e72c170ULL,0x8ecc5e35e976f77eULL,0xb5cdcb48ee2cdcd6ULL},
+  {0xb24a8ac07200682aULL,0x8bb131c012ca542eULL,0x7433a4f18c61726fULL,0x39e5c9925b5a54b0ULL},
+  {0x449d42ee37e65fa4ULL,0x10770ad296a01ad0ULL,0x43e203fe3b8c422ULL,0xa213cbd11f2c882dULL},
+  {0xae164e122a208d54ULL,0x89e127760ad6cf7fULL,0x30e30d6295853ce1ULL,0x62dfaf07a0f78febULL},
+  {0xb3fa2102457cf151ULL,0x9d4552d208e1e7e2ULL,0x87a3b97e37fd2230ULL,0x3140b915410c1212ULL},
+  {0xe7a76aaa49bd0f77ULL,0xdc6cc07db2d60a9aULL,0x8733c38a1fa1c2e7ULL,0x25a748ab367979d9ULL},
+  {0xb4eeba071b0594bULL,0xcc12918983bf74f0ULL,0xec1daf204a51288aULL,0xe74d9c8f8463ea37ULL},
+  {0x16a83ae09a9a7517ULL,0xc390bde74b4bbdffULL,0xf9420bab396793c0ULL,0xecfb7056cf1de042ULL},
+  {0xcf85d393d3f2f8bfULL,0x2b1de5b2d1d3bd8cULL,0xf9a51421b1549bceULL,0x94de12d051e62940ULL},
+  {0xf74b190dca712d10ULL,0xc521a0959b2d80bbULL,0xdfefa10c57fea9bcULL,0xcd450ec335438986ULL},
+  {0xfcfcc8fc7c306316ULL,0xfac71452a632431fULL,0x657cc56cf6e46ad1ULL,0xe662b869a22227b3ULL},
+  {0x8360990e2bfad125ULL,0x4f729ac5308b0693ULL,0x40b9b48728473e31ULL,0xf5c54754a8f71ee5ULL},
+  {0xbbc027380762cef4ULL,0xbe040a8c062b742ULL,0xf6f2928340e28465ULL,0x912770e068008032ULL},
+  {0xe85f44100099223eULL,0xa0a7cd8a9411131cULL,0x609af3add26cd20ULL,0x6cb9a8876d9cb852ULL},
+  {0xaee700ea6c6ae32fULL,0xfc9adb6c57d54c9cULL,0x495ba885d9b8b819ULL,0x836ed454d94c9199ULL},
+  {0x2570d55646b8adf1ULL,0xac2b9da568d6abebULL,0xc5d624114bf1e91aULL,0xfef5a3c68059a6deULL},
+  {0xbc8f0186ccf45c5aULL,0xa25f0cbd2a296656ULL,0xdcae9bd97378bd4aULL,0xd67286b1d5716401ULL},
+  {0xe5430da0ad6c62b2ULL,0xf49ae3fa15b96623ULL,0x43d94ccc670d0f58ULL,0x1acb250f255dd61cULL},
+  {0x8cf83c556d73af84ULL,0xbf27585f4b1ac1edULL,0xdc34a72350ea5d40ULL,0x907308b0980c45ceULL},
+  {0x3e945a1216e423ULL,0x8cf0d34fd4191614ULL,0xb19f77d41c1dee01ULL,0x5f310d4b3c99b9ebULL},
+  {0x9c0b605ba95832a5ULL,0xfa92c34b1f38c89fULL,0xb1373fbba578001eULL,0xfd6381eaf29657fdULL},
+  {0x4740d098ced1f0d8ULL,0xc1d2942114e2edddULL,0xa5c440c38eccbaddULL,0x438136d603e858a3ULL},
+  {0x1f5262f7887b72afULL,0x4519a730a32e2265ULL,0x413bd16e1749ee18ULL,0xef9a8bd1525f4864ULL},
+  {0x30e2e7f463036758ULL,0x4bcf50fee51d7cebULL,0x26baf44fb84ea4d4ULL,0xcdb559eedc2d79f9ULL},
+  {0x25c560257be95bdbULL,0x1faaf5675484185ULL,0x75bb7a8e714e885eULL,0xec8598c45d39f0e0ULL},
+  {0xe924b69d84a7b375ULL,0xb3180c902875679dULL,0x23ebaf66a6db9f57ULL,0xc3b997d050ee5d4ULL},
+  {0x350d54cfe47bf50bULL,0x4f3003efe1b2802cULL,0xf4c888520bd33955ULL,0x9d0a6b077d71cc3bULL},
+  {0x70e07bfd9ccafa7dULL,0xf342c8591f1daf51ULL,0x22c2ca280c682862ULL,0x6d89ad7ba4876b0bULL},
+  {0x99951e3abc733de8ULL,0x2937844e0e25d532ULL,0x2e562e2bed4f8838ULL,0xe2b99adfec86f877ULL},
+  {0x80ef4bff637acaecULL,0xdaff7bb67b103e98ULL,0x3b15389a5f6311e9ULL,0xca5ef7d4b231c94cULL},
+  {0x9cda7f01e8bfc2bULL,0x847a414a8455218dULL,0xbd7df32296a9fc38ULL,0xe0c2821689a92635ULL},
+  {0x62a5b132fd17ddc0ULL,0xb3ee1b40d60dfe53ULL,0x84d37c6e7542006ULL,0x9731141d81fc8f8ULL},
+  {0x2dbd7a76b1b9c8b9ULL,0x7fd5a3ae8ba8b4b1ULL,0x64fe48656b101b58ULL,0x3cbf5c99286222f4ULL},
+  {0xa497237794c8753cULL,0x73bb80547ae2275bULL,0x2efc3896ee28260cULL,0xee1849f513df71e3ULL},
+  {0x48e525620a13060cULL,0x5226c0d3cf24c4afULL,0x1f8d4a3e21ace469ULL,0xf7ce91842e49e9d4ULL},
+  {0x8641abcb005cc4a4ULL,0xaddea9e36122d2beULL,0x7a62df062736eb0bULL,0xd3aa2ed71c9dd224ULL},
+  {0x2a3619ad0de244e9ULL,0x41eae9f117b3e34ULL,0x2bebede498e028d8ULL,0x15276d9145b9bcafULL},
+  {0x2390426b2edd791fULL,0x34ef0d7906631c4fULL,0xa5d01ac5e6ad3307ULL,0xc4e1020916980a4dULL},
+  {0xc90774f6baa7e834ULL,0xb25e0a780fdea14eULL,0x1da077543ce0b7f1ULL,0x3e6b5491eb5219dULL},
+  {0xbda47ae5a0852649ULL,0xc1732f2b84b4e95dULL,0x776f22c25fb8a3afULL,0x67163e903236289fULL},
+  {0x62f3b896e8369787ULL,0x81c434d346df5e0cULL,0x2ab27141690ab859ULL,0xc98998be4c613a7aULL},
+  {0x3fa20efcdfe61826ULL,0xcf71872e7d0d2a5ULL,0xb2f0ca647c718a73ULL,0xcd1bc7cb6cc407bULL},
+  {0x716409cc8bab85aeULL,0x64d28821559fcedcULL,0xb40a81e852827b8eULL,0xca7a42daf8694c62ULL},
+  {0xe09eecc69e0d38a5ULL,0x70db57da0b182259ULL,0xedf43b257004580bULL,0x299d21f9413f33b3ULL},
+  {0x6f63f4cea8c95157ULL,0x172d3056112776f0ULL,0xde776fec3b5892c1ULL,0xd313f3cdd7cdcc16ULL},
+  {0x2fc416910b3eea87ULL,0x82e14f4535359d58ULL,0x68e99016c0597077ULL,0xf9429e738b8e53b9ULL},
+  {0x2dd668c1fd617cc6ULL,0xf1f902c744e425bdULL,0xaa11b1ab6f7ec0f3ULL,0x28b6d7837004120fULL},
+  {0xc695a559eb88db7bULL,0xa878d35da70740dULL,0x8499350113bbc9b1ULL,0x462f9bce61989863ULL},
+  {0xdf02760aea9e0a2cULL,0xf80beb233dbd9df7ULL,0xdfcaef6a82b9c7cULL,0x60f803c2b44d43a0ULL},
+  {0xd5558ed72dccb9bcULL,0xb1c61090905682a0ULL,0x8573d48a74e1c655ULL,0x62188bc49d61e542ULL},
+  {0x1fca864423d1c1beULL,0xd00e3228bf1eb99dULL,0xc2a5bc741deeb71aULL,0xc130794479f2bb77ULL},
+  {0xd902a6d13037b47cULL,0xf1065224f72bb9d1ULL,0x5c71a3f9d7992038ULL,0x7c10dfb164c3425fULL},
+  {0x63add999d2f95bb3ULL,0xefdd509a19c63e56ULL,0x77559bdc7f1017d1ULL,0xb52974a37a1c5e94ULL},
+  {0xd3aea1454e3a1d5fULL,0x3b3cdc6faa3088c1ULL,0x744a655b2df8d5f8ULL,0xab8c1e086d04e813ULL},
+  {0x7dc74cec622a5995ULL,0x91930cd46322a119ULL,0x8d859b3982343deaULL,0xc8eed15dfa36bca2ULL},
+  {0x8955e8592f27447aULL,0x1693465c2240480dULL,0x111a13cc1d4dd0dbULL,0x4cb04437f391ed73ULL},
+  {0xdf71e1abdcfd8fb6ULL,0x7c0834f9544168fcULL,0x30c621e8aab586a1ULL,0xc4071fd9f1b90283ULL},
+  {0x4b10dc14d125ac46ULL,0x64f8cdd7df0aca61ULL,0x2a10f0303417c6d9ULL,0xbd1aeb21ad22ebb2ULL},
+  {0xd7f4590701e5364dULL,0x4eea355d9dabd94eULL,0x59320a356230569aULL,0xb126363aa4243d27ULL},
+  {0xb79992671ef7ca7fULL,0x26b80c61fbc97508ULL,0xdf3a311a94de062bULL,0xbfefacdb0e5d0fd7ULL},
+  {0xfb5f8ab6e7820ca8ULL,0x41dbafc6abd04730ULL,0x191ab6dcc8f0e90ULL,0xba0d2f3af20d9692ULL},
+  {0x3a5bd567f32ed03ULL,0x24ed291e0ec67087ULL,0xf2b25fe1de289aedULL,0x603c12daf3d9862eULL},
+  {0x3112844dcab0af01ULL,0xf8cba1b16a19b8f2ULL,0x58643c3feb2cfac6ULL,0x63dad3922e66cdfbULL},
+  {0xd5737fd790e0db08ULL,0x93e0968942e8c33ULL,0xd6193d83631bbea0ULL,0xcc6157ef18c9c63cULL},
+  {0x4e44de8e79598a01ULL,0x64782b5a3885ab58ULL,0x8c9cbafee51f97a0ULL,0xfc822d5ea0c68b76ULL},
+  {0x17714d9977a22ff8ULL,0x6290d0e0f19ca73fULL,0x6c8f39e7f311d317ULL,0x553e04f6b018b4faULL},
+  {0x906e54680127ff92ULL,0x60ac69c82044e8e5ULL,0x689f232541c04105ULL,0x27015dc47dbfe781ULL},
+  {0x9e2fbf2629008373ULL,0x9ffd7c8ef35a3850ULL,0x9003a3481fa7762eULL,0x712fcdd1b9053f0ULL},
+  {0xd86e5c8718a3051ULL,0xe476add5cf739174ULL,0xd2a203d8eedc863fULL,0xdd81b694ec3a60baULL},
+  {0x7b47834c1fa4b1c3ULL,0x9aefd31f4eee09eeULL,0x7d270b4878dc43c1ULL,0xed8cc9d04b29eb87ULL},
+  {0x7863ac2a068f7866ULL,0xe22e369309ac3c4eULL,0xc0ab2c94a8e89e6ULL,0x5cc678a31a3b536cULL},
+  {0x3ca4726586a6bed8ULL,0xd7efc22151346e1aULL,0xfd0b86fd2b39a868ULL,0x9852390a99507679ULL},
+  {0xb08824df1978ea2ULL,0x43590d98e54e5678ULL,0xfd37e43c0d6230c6ULL,0x1a9cf6cd7c7ad92aULL},
+  {0x5ebfa5f3f8e286c1ULL,0x3d096ccc54963e6aULL,0xb76b061927fa0414ULL,0x9e994980d9917e22ULL},
+  {0x69394d2089481e75ULL,0xc6ddcc39676e2ea1ULL,0x19cf1c838c69253cULL,0x1b33a3362bc07380ULL},
+  {0xd3394119daf408f9ULL,0x2708b26b6f5da72aULL,0x89353f77fd53de4aULL,0x4036edc931a60ae8ULL},
+  {0xd31b6eaff6e26cafULL,0x62d613ac2f7b17beULL,0x5e8256e830b60aceULL,0x11f8a8098557dfe4ULL},
+  {0x442c76e92fcf91e6ULL,0x5ee050b27bbd9681ULL,0x87f21145d9e2936bULL,0x753c8b9f9754f18dULL},
+  {0x670105671ecf4c22ULL,0x95140c110369125ULL,0xab7cb0603361373fULL,0x3074ac60fad0d25eULL},
+  {0x23abd4483aa79c64ULL,0x73b871a702b4cf61ULL,0x18b495b891d3b1b5ULL,0x86ca160d68f4d4e7ULL},
+  {0x5f020b5823776edULL,0xee73b364bc6f8821ULL,0xc7a234cb4ed191a3ULL,0x48401d84e98487a2ULL},
+  {0xc300c513c247759dULL,0xedd0f30e3c45b85dULL,0x5b57b6a3cfad6863ULL,0x8147cbf7b973fcc1ULL},
+  {0x801c5b765d3b35c8ULL,0xa759e43a8cb39a51ULL,0x255e0c1ddb7fe14ULL,0xf50879c337a4448eULL},
+  {0xdc287844f1a29574ULL,0xaf949ae650213921ULL,0x58adbe56c27b470bULL,0x31b3ca455073bea5ULL},
+  {0xf8068d673a214b38ULL,0x32796d75d322c4efULL,0xf49f4f820a9742b9ULL,0x27e8e8ae38c05bcbULL},
+  {0xcbbb893f652f50fULL,0x10bd3a60dd7a1687ULL,0x5714626d8d67d561ULL,0x57fc24472225b23fULL},
+  {0xb0b382ed77e96a61ULL,0xbf488169e80cd350ULL,0x413ab4f836f946d5ULL,0x46bed1f49f992432ULL},
+  {0xcc593fa494b33482ULL,0xee4e92e0156b3c70ULL,0x4617c73ca77040e4ULL,0x844adb5ce7d10de9ULL},
+  {0xe230590cee79327cULL,0x510f537bfa0cb158ULL,0xffb2b1cfe1233d83ULL,0x31a7bc3a4af61f84ULL},
+  {0x57ad22e2f2454a2ULL,0xa73538074b44ff27ULL,0x2f77872225627d80ULL,0xd765466c6e556e35ULL},
+  {0x5ebd43288fc1b3c0ULL,0xf35317b8a2104d98ULL,0xcdeeda144cc7bbb9ULL,0x7d155e9e6f356436ULL},
+  {0x77f53c946e7bd648ULL,0xda811844236a4c43ULL,0x812605e50d8b752cULL,0x77b1f0687cfcdbe8ULL},
+  {0x7516b51563ee2043ULL,0xb4548da9925a056aULL,0x3ce267208d0461acULL,0xb9a6c10d32c12d52ULL},
+  {0xdce94e329222550cULL,0x9bfb77d21cef371dULL,0xeb27fa26a9035b66ULL,0xc16f60c7c11fc3c9ULL},
+  {0x98bb807f8098e148ULL,0x26b1571282ccec92ULL,0xb41fbe317b921bacULL,0x67171e0ea011fe7eULL},
+  {0x4c25112a86988efdULL,0xd742e8caa6de7811ULL,0x5cf6c2437fdd94bfULL,0xe1bcfe7fc8ed8ae9ULL},
+  {0x8f0690447a9cbff2ULL,0x17466c022b7350b3ULL,0xdfab050fd5a6f8e7ULL,0xfc9302b326ceba4cULL},
+  {0x43fcae81d2d0ea0eULL,0xfe8529f7173f589ULL,0xfd8883363d37bee7ULL,0x8d6857c9d08ef7b4ULL},
+  {0x2b18f3fc3fd52680ULL,0xb1b0e979c8791662ULL,0x55991494e317ba38ULL,0x7c83a291aae1902bULL},
+  {0x54f583888917be80ULL,0x2b601bd5ed952f78ULL,0xf996bf6b96ec3496ULL,0xddf1b9fe8744ad03ULL},
+  {0x50650be0d3f64d1cULL,0xb701323c2a8577b0ULL,0x6dddd83d95565b00ULL,0x83641fc5398fcd2cULL},
+  {0x1d0e60e47298a9dULL,0x716bc5e0a6b063b3ULL,0xaf6f04dc61e7ae64ULL,0x3f27e7e1834f1a61ULL},
+  {0x2b9f0816cc2fb2cfULL,0x11b8ef2753d15ce2ULL,0xc44b46cd3e96fc29ULL,0x9ffa08d3a62870edULL},
+  {0x2416db785aaedb3fULL,0xd579517f5bdc3abULL,0x9f53fbb235eb1e89ULL,0x50bc23f3926cd0c4ULL},
+  {0xe7f18d0c73fe9d1aULL,0x60e484de8d931eb1ULL,0xbc3b0e048c47e447ULL,0x76e5d7f434fd7e3dULL},
+  {0x9ab249309a185187ULL,0x527efbce7d8b3a3ULL,0xf866c25c7ca5dd78ULL,0x6e6aee6c9625370aULL},
+  {0x4e66febd43ff0440ULL,0x150334d56c3759ddULL,0xdfd0c1bd2999fd38ULL,0x3cd961a34d4043d0ULL},
+  {0x7019bc4135174870ULL,0x5d699fcd81cf23ceULL,0x827c296504198139ULL,0x986314ef75b68fb2ULL},
+  {0x92f4cee44d1eb30dULL,0x320407d9b809ea3cULL,0xd268871d155f962fULL,0x3749971fa9407e8cULL},
+  {0x44d2ddf9e3e469c0ULL,0xe0a44d254728d2c5ULL,0x5de4b22de1be2c52ULL,0x4e31ea12ac607d07ULL},
+  {0x87c5ad1e6804caeULL,0x7863343ee7ca7dc4ULL,0x42f1dadc91e234c3ULL,0x56f002247357133fULL},
+  {0x17e94afd8e9d2bb0ULL,0x907f2636762e8d5aULL,0xe24c27926f16cad2ULL,0x94264621a5960e0eULL},
+  {0xb88f3d8d50f06cdbULL,0xb594d996f925ce68ULL,0x729be2440345537cULL,0xfed1845e2eac4276ULL},
+  {0xef87ddd65d7303c9ULL,0xff8fbd1e0682f7f1ULL,0x34e3d6beb201094fULL,0x5b5853ab7ee5de8dULL},
+  {0x66487f32c7f7496aULL,0x1263c4be5674e809ULL,0x5437818f7c84e929ULL,0x5eff56fd79831025ULL},
+  {0x9b42337a33110753ULL,0xa0afff24387d95e8ULL,0xa537ef96bf4c714ULL,0x496c944dd9875ba6ULL},
+  {0x1e1aa014f0727e31ULL,0x8820848d105aff3dULL,0xf1aba14af247f4d4ULL,0x9063fec43cb5923dULL},
+  {0x70f6ee381284c162ULL,0xb629e62e85693ba4ULL,0x899c979a02b3cc30ULL,0xf2eccac775922b50ULL},
+  {0x6bf17748d2672d0bULL,0x4721058e67765badULL,0xc3f92efd155d5b2cULL,0x11b05c2ca032acabULL},
+  {0x4d95e23f4c2e9368ULL,0xac685aabd77a8f5cULL,0xb39605d4268c2510ULL,0x44c757a542f4ea2eULL},
+  {0xfc87e9355cfa0b13ULL,0xb96477925962a7feULL,0xaf25118c667cfe50ULL,0xfa711b812c495f69ULL},
+  {0xec5383170a17fffbULL,0xc824ed8de2f48367ULL,0xd46192fc93ca03deULL,0x7421a2207ee73299ULL},
+  {0xadc035a061c9ec99ULL,0xdd0fca79fbc6122fULL,0x6f4c4aa7c0141f25ULL,0x27245902d8971e91ULL},
+  {0x22f3ea1ef69961a9ULL,0x6c8d4022ea85b8ccULL,0xfc254dad063761a2ULL,0x7d16d654f0c2aff0ULL},
+  {0x1cab284022ade206ULL,0xf9e7d9f953f8135fULL,0xeda76ef8c85a7735ULL,0x2dc383426073982ULL},
+  {0x24b035c673c9259dULL,0xa2f2e365290c498ULL,0x93a39839340ddb53ULL,0x6c9ed1f1528b0215ULL},
+  {0x4bde4567dd80f7b8ULL,0xebe8fe7c068927daULL,0xe72736b58da5441cULL,0x220fd212e68251dcULL},
+  {0x60d4bc0aadd0e24dULL,0x2effc56a922f268ULL,0xd32e20499329765fULL,0xe8bcbfe1f7f6e75ULL},
+  {0xdf16bfde36b32256ULL,0xba3e0e6fb2783de4ULL,0xd1c2ddb907e84e99ULL,0xbbfd1098eab76c67ULL},
+  {0x4f9bbdb6e9bf3916ULL,0x7da8561de4fde71dULL,0xcc9a32f695807b1cULL,0x3e18941cc3c6d297ULL},
+  {0xb0f98f6b75f42399ULL,0xa79834450ae0666eULL,0x85bbe59122518037ULL,0xbb99adcccdc1d9ddULL},
+  {0x295caaecb973c154ULL,0x1fdad0fc2f7ab155ULL,0xeca6e349b85880c6ULL,0xf60547ab6e9c5fd3ULL},
+  {0x67564fa9c4fcaf1bULL,0xf1207378f0681df2ULL,0x349a7cd0030247aaULL,0x267eb91eb5805268ULL},
+  {0xae83234bd0b5ccd5ULL,0x43762bb1b12a0daeULL,0xf6f37a80cf96ca98ULL,0x29a835f6ef7fa1e5ULL},
+  {0xca49fe9fa101a169ULL,0x5aa184af7dc7dd54ULL,0xce660f2326b64948ULL,0x9fb77d64bf06da7bULL},
+  {0x606cc1f728c2071eULL,0x35dc99ae9dc7f0e2ULL,0xb73bcfb810f5c60dULL,0x5c7bcf8b57f114e0ULL},
+  {0xf28eec35df76410bULL,0x9cdd120a88f9ecb1ULL,0xa1fdb7f6dcfca4c8ULL,0x4ec79bb67b57101cULL},
+  {0x54a90f1e83778eeeULL,0x89c86db6869aa1b5ULL,0x9689eaba6a81f044ULL,0xa286e222dfe10cfdULL},
+  {0xc2f78ea32f672dccULL,0xdbdbfa4545d159c8ULL,0x4a84229a4492d18eULL,0x1322378061c6f8edULL},
+  {0x528593bc18223188ULL,0x660b4c40ad08fd65ULL,0x1913b2e951e98a78ULL,0xc582db1a3f0f2242ULL},
+  {0xacacf0f99e8c0b97ULL,0x61f1bffc754a7fe3ULL,0x7a59fbeb7f872c17ULL,0xf6d2878e566894fcULL},
+  {0x6ea8b19f7a20350dULL,0xe4116fb9955b03b0ULL,0xe722af7f4b70e64dULL,0xe3e77c41288f2602ULL},
+  {0xc4c24426c2d6a5ULL,0x144a215214a158c6ULL,0xfe7b9a3226c68bddULL,0x833932bc6747e07aULL},
+  {0xc2dcc5139e7c4bdcULL,0xee2b59c50953fb43ULL,0x6736c0c76f3deabaULL,0xc9e33faebd8eba42ULL},
+  {0xf337c42891400283ULL,0x40d455079c90bf84ULL,0x12a9f02d8835b31cULL,0x2b0eb8522710028cULL},
+  {0xd7e81abe158e3a25ULL,0x1b87ffdee68e77f0ULL,0xf4f58c7edf4417beULL,0xf5202cf5aaeea58bULL},
+  {0x1d8e3744986dfd2dULL,0xdc575a5d9d88bf35ULL,0xa9b03d2e5c157c70ULL,0x1fef63ee32eef0a2ULL},
+  {0x4e9c5fcc12285844ULL,0xc2a96316b7009f2eULL,0x3c574f282f74a87dULL,0x61fe64cab0952caeULL},
+  {0xe514ccab4ead8875ULL,0x40fd4da8ea60b9c5ULL,0x13e0b6652777c19eULL,0xa7018d958ba47577ULL},
+  {0x8cdf6b034d730b58ULL,0x93a0c61c53969253ULL,0x80b0f20fb1f047d5ULL,0x5dcf9abba9625ed6ULL},
+  {0x71c1ba44202261c4ULL,0xa4ef96c02053dda5ULL,0x196f7a095efe39a4ULL,0x20b4ed416a1e7b44ULL},
+  {0xb5e013ad7b5d75d4ULL,0xba7cec105675f437ULL,0x4f5321c6c72fbbf4ULL,0x79a6bf4375f1469cULL},
+  {0x7890b9732cf901eULL,0xafa2968e6ad0383aULL,0x8b67a55b38b5bb6dULL,0xb9c032d256ceb53fULL},
+  {0x1cd5f918d732f63dULL,0x5bd2fe7fd179c778ULL,0xf592a35b6aa3dfe4ULL,0x7669bbd419a4d491ULL},
+  {0x74113e60a8a9c7beULL,0x3c9f7d58d37497d4ULL,0xe7fc8e69e3a73575ULL,0x8903c32501079bd8ULL},
+  {0x54e5381c1728d1c7ULL,0xbfc9ccbf49b946a9ULL,0x59b20c5c7fa62bafULL,0x308abc8df271f759ULL},
+  {0x7e646deaa92f7c31ULL,0x363fe84f5f857184ULL,0xece6a6c1bb8d03efULL,0x439c8761a2e77c7eULL},
+  {0x8b386ffc46e0ae7eULL,0x3dc0efba1e7c3baaULL,0xa3e82877cc84ed4fULL,0x9eea970ba856b2faULL},
+  {0xe7a3a5efc061b3f3ULL,0xa4fe2811c5ad63e5ULL,0xc8ad5472b59ed28bULL,0x37741ceca4048e11ULL},
+  {0x3e2d7d73dfb1030cULL,0xa30377da47bfda71ULL,0x59b2e2688ae7fd33ULL,0xa9fb1702100953b3ULL},
+  {0x73adc4937c8f23caULL,0xc7d265223d2ff985ULL,0x7c43c6ac85fabdd9ULL,0xec191fd87d0769ceULL},
+  {0xc12a2ea16edb6be6ULL,0x95f40e131714885ULL,0x7fdb7f5b2f12fa57ULL,0x22f6fe9d21749501ULL},
+  {0xc6fa1f07c4d6f1ebULL,0xb9501bcb9df23881ULL,0xdfe79eec1ec8547ULL,0xeb62f8d9fec1e3dbULL},
+  {0x18fe128795f1dd0cULL,0x5e5c31d4cd0478c1ULL,0x8b90501ccb71b671ULL,0x737ceca2c0ef7227ULL},
+  {0x6a50c9d52a7644c7ULL,0xcc0c460aa877a9d4ULL,0x8e1016ff4c994e6bULL,0xa3452e9efb6d4109ULL},
+  {0x7376feb7cbddd8fdULL,0x403fff272d47e778ULL,0xd003fd2a4f18d526ULL,0x2afc8d09b79176d8ULL},
+  {0x39a367d7c90f9ec4ULL,0xe75bff36c144fc73ULL,0x893cde54fe7d037fULL,0x3e5ac9dac3276f26ULL},
+  {0xe2195ffcf28fa758ULL,0x81f77f6d20cc1376ULL,0xa9e0ed90afa021a0ULL,0xcb13c152fd511d91ULL},
+  {0xb9ba49275398f5bfULL,0x667bf88857910a17ULL,0x4460f86f8e316a9ULL,0xf48bad8c6797711cULL},
+  {0x96daf16940023a52ULL,0xbd698a16d4f7cc85ULL,0x75cca8922647f48dULL,0x1ab4eabe5e09409dULL},
+  {0x52513a74c5cb298ULL,0x51752863cb1307fcULL,0x6dc0720485ea3ac7ULL,0xa14992cb83926259ULL},
+  {0x6e6d3ab974e88915ULL,0xdc48a4d54d712398ULL,0xa48fa422a26ab982ULL,0x95f9f4e9007e5b9fULL},
+  {0xac1719774623d24aULL,0x8f80eb5030f288e5ULL,0xacc98a87b5b2cbb8ULL,0x25fcfde9a199e500ULL},
+  {0x330e97791bc31df0ULL,0xa77cd3bdd4b8e8eULL,0x7f5b558099711757ULL,0xdce1bae1d655ba51ULL},
+  {0x4a1cd26b230cfe31ULL,0xee460872c3a3c648ULL,0xad54fff12e2b7e47ULL,0x4c112eb60b874288ULL},
+  {0xf6989f4af7625d8eULL,0x1c48d2ca71ba34fcULL,0xbed88daab081f359ULL,0xcc3636a03fddddfaULL},
+  {0x2b990fe79d1c74eeULL,0x720880e7a170ee81ULL,0x62aaa2a8fa6231a1ULL,0x80207bdc320bf5ddULL},
+  {0x974cf9844611a32dULL,0xd8b632038d4aef81ULL,0xb8eafc4a0b8a7d1cULL,0x329cf0497e15eec7ULL},
+  {0xfab139d408da08fdULL,0x86f6ca493f4d0410ULL,0xf012d3a60fabcf9ULL,0xa2be1d5ce78ff974ULL},
+  {0xd0531b7bf7e48e78ULL,0xc4d88c9a59442274ULL,0xc8296f928ac7919dULL,0x8c6f81be3fafa5eeULL},
+  {0x132eda351b0e6a8bULL,0x7548df4996fba1c7ULL,0xd7e5f7ecc00fff00ULL,0x87aecb174e5018b2ULL},
+  {0xb5acb92b73e05583ULL,0xde49d768a2ce6b07ULL,0xb2b0965a1f359a6aULL,0x7f42c0962feb2f73ULL},
+  {0x6380451a6bcf5a43ULL,0xb72392d1b4caab61ULL,0xe626a629ec2344afULL,0xadf1024980d25d7cULL},
+  {0x59a8ed387282765eULL,0x420e372ef1b25b27ULL,0x20742ce382dce3a1ULL,0xf649be278cad9764ULL},
+  {0x6a479e04959b2ba9ULL,0x28643438320c1b9aULL,0xd1a2707a8b81191cULL,0x12dc765bd76ae7e5ULL},
+  {0x4b9a05b50ce815b7ULL,0x85e2a171585aa132ULL,0xbc6284bf0299bef6ULL,0xd596adf0e8692a06ULL},
+  {0x7aed0b5fceb75d77ULL,0x3442f842381ca46bULL,0x9af16bedff84bea5ULL,0x7a74eeb77cbafd2eULL},
+  {0xdeaefc1d527a8fb4ULL,0x143f6871789e1801ULL,0x6c10dd9ef541689dULL,0xe077184b4ae8f705ULL},
+  {0xe87074eba71766c9ULL,0x9d2d97562560902cULL,0xa16aeae70726860bULL,0x989969e2da87a713ULL},
+  {0xb40634e0e75e221dULL,0x787120ceb3d3dcfbULL,0xa295407e1d6fc48aULL,0xeb4c98489093d573ULL},
+  {0xc6842a3c5d6a6f78ULL,0xaa89c2517acb3b49ULL,0xf2c193e3bff086cbULL,0xfbf40833439d5a13ULL},
+  {0x323215e1bb0b2155ULL,0xc8968b90ef134f9fULL,0xd1af1c019c372941ULL,0xea75b9b25d717861ULL},
+  {0xedc4eea88751c8e9ULL,0x8858c96d5c2ae0e1ULL,0x605f9565d0b48cbULL,0xbff9597747a99f6dULL},
+  {0x5de355371641218cULL,0x210e204ce4499809ULL,0xf39be21f20c98824ULL,0x669985206edf4ac6ULL},
+  {0xe58d69d900034bffULL,0x9e3a48e85f75e6bdULL,0x8203371f82b2d435ULL,0xe18414567d6d1e69ULL},
+  {0x8511be82bc32fefeULL,0x8846e03cf39af77ULL,0x68e68e5f65ca6e98ULL,0x70b0123774af550eULL},
+  {0x6ba1ad6779c75db1ULL,0x1b68a16b8baabd74ULL,0x96ed0253b89cad90ULL,0xcec5a252bea17421ULL},
+  {0x7c36f9ce8b75d41dULL,0xbd5e5b8983e05390ULL,0xfb85bdf98ba3985cULL,0xe115b14bef4695cfULL},
+  {0xdbdc3a7376ad092ULL,0x127c843f6aae7094ULL,0x68c8397aa72c1871ULL,0xba392b1c6b2d9fb7ULL},
+  {0xc86df5ceb0fa5270ULL,0x60fafa8dad6bd3e9ULL,0xa855d6ccbd11f480ULL,0xe9d9dbfe8cf5f5ccULL},
+  {0x645543b704c4ae95ULL,0x572c95e5a88c9f9bULL,0x90c156513a94b17eULL,0x863fde7fa15c485cULL},
+  {0x98411a4786393fb0ULL,0xd1925b91d06a7f16ULL,0x78925bd67e72cb77ULL,0xe4177ce1c3cd6ac7ULL},
+  {0x15f458116d5cdb70ULL,0x17f7f504ad913997ULL,0xf078a2b656ef3689ULL,0xf019b70ee6ec019bULL},
+  {0x742a49d2e61ed18bULL,0x1f21c4b96899781bULL,0x2d4b1f41e8e1f2cdULL,0x954a5fd857ba3acfULL},
+  {0x6d3484bd8b8f52d8ULL,0x18a4b27d0c2b67fULL,0x4f6e8c4b8c7e1da9ULL,0x661a7a5f829b6f85ULL},
+  {0xdce4bcc5dc937193ULL,0x259d3d49d4d7071aULL,0x3b1fe249298b2059ULL,0x2d5d2fb1f0c30855ULL},
+  {0x2ea84f56a6998ee1ULL,0x44a4dfd4c71e2939ULL,0xa48c6527272d216ULL,0x390d384a3bd5f0ddULL},
+  {0x49eb5472d554e0ffULL,0x27fcaeda12d8cf54ULL,0x2217267b7407e987ULL,0x9bd0178e38189569ULL},
+  {0x4caad479491151b1ULL,0x69ab2a193a119bcdULL,0x36c7d4db422413acULL,0x322f40ae5784e015ULL},
+  {0x2e7adc173584427bULL,0x691b09730f2f5a05ULL,0xf08b76929336e421ULL,0x618bd6b0d25ca70dULL},
+  {0x46f4cd5580765bb1ULL,0x749d05f7f3c6f942ULL,0x2a8043e25cc46e7aULL,0x171a5ea81577ea38ULL},
+  {0xcfb9d0fe879992cULL,0x530ed7385e5d1e33ULL,0x53b4f895dc62482cULL,0x7a981f0c21862a8ULL},
+  {0x564eda1fe8e5111dULL,0x8dd4ab7eb4eca3d5ULL,0x66cdbdd55881d95ULL,0x782742a71805f085ULL},
+  {0x233b75efb5753f28ULL,0xb2a81b7b667e934ULL,0xe83be30b2469b068ULL,0xadb23bcdb3d069c5ULL},
+  {0xf8a10313d8bfaa77ULL,0x437942cb6f143103ULL,0x664ae51927023aacULL,0xc417fc627085fa15ULL},
+  {0xcea15631b4e8dbcaULL,0x803ecf119b7b37deULL,0xede375a8a7768db4ULL,0xd8003c9ee3c842f5ULL},
+  {0xedefd3bafd63c7d4ULL,0xfcc28b6e7e05363cULL,0xff739d7224e93c3bULL,0xab1aba31eeb44621ULL},
+  {0x145c13e1370d26d0ULL,0x68e21a0c41bc83d9ULL,0x3e5bea50da005c53ULL,0x211557489fa93b88ULL},
+  {0x8d60b59b78775af0ULL,0x6145384cb45882aULL,0x869a230b9b8b234eULL,0xf0cf60b09890acfbULL},
+  {0x585404366834f189ULL,0x12ff023bc1d5723eULL,0xe214efbafbf529d3ULL,0xabb1d9f874637668ULL},
+  {0xc063df8e33d7ebe2ULL,0x187d172a2928bb5ULL,0x8727d0eee735f95cULL,0xe42009e9905a1020ULL},
+  {0xc965c33def60a55cULL,0x6a3abd23b7291b99ULL,0xb3393a895c2d6457ULL,0x5b5930f12e9c40bcULL},
+  {0x773bc21fce5a6758ULL,0x35fb355b732d54e5ULL,0xd1a390e9087063b2ULL,0x2d75e28d461d7353ULL},
+  {0xa873ceaf3d997e7aULL,0x5ced5c2587347d57ULL,0x5f82ed5650796f50ULL,0x5246a8190bbfb291ULL},
+  {0x696766880e818c97ULL,0x6051723fd13f33b1ULL,0x468b3699e56a1ccULL,0x20cdeec3c7087181ULL},
+  {0x3d2127766a791ee2ULL,0xd71dbd04093281a1ULL,0x7b97e7464850ed02ULL,0x3c83145dad9f8748ULL},
+  {0x1f43e13806774bd9ULL,0x3cd436897751b539ULL,0xda85f832b081510aULL,0x2c649b9ccbdb7371ULL},
+  {0xc89b6f279e79827cULL,0x9ab9c303a5ac3d3eULL,0x7e141041ab9a0d58ULL,0x6ce693b64a37c672ULL},
+  {0xca8064315fea15f8ULL,0x4d51dc1acc7ff3abULL,0x59af8f0ae1f2cd33ULL,0x4d0bb49a6eca0f66ULL},
+  {0xbb8701464e6f4838ULL,0xfe9f5f52e6a7f0fULL,0xd671d1bc7c1d8834ULL,0xf602c3428593a9a8ULL},
+  {0xb84bdb0b687dc1e8ULL,0x976b0a4182c2e197ULL,0x6da75836354bbd8cULL,0xce47c1ba148ad3a5ULL},
+  {0x3ea0cb81b74424a6ULL,0xbf94a7009a919f1aULL,0xf20ca036761d3e56ULL,0xb8f7c3b220701320ULL},
+  {0x3aca90fe34e4724dULL,0xac3f7e3252e864d5ULL,0x59b9de738796437dULL,0x99c193b77dd723dcULL},
+  {0x6a7b5d1f9d9fcaffULL,0x43f9cbcc9a9a5d6fULL,0xdd7f703a5c6616d1ULL,0xafb6a74d9849454eULL},
+  {0x4feee943170d78d7ULL,0xe8f4bcd445061ad5ULL,0x9e0d21008006c849ULL,0x5386576dad71615ULL},
+  {0xeaa144eb4217dacaULL,0xa3561ba02581b055ULL,0xfedd5dcdc96b04f9ULL,0xda7d67cbc1ede9d4ULL},
+  {0x201a0942b3d4c97cULL,0x2aa69ccbb27c5de3ULL,0xa03220d36dc86f1dULL,0x526a576e39f0fe5eULL},
+  {0x384fc1042d30bf01ULL,0x42b8947913733b89ULL,0x59d4f9898ae632b8ULL,0x160e1c1c13342fd4ULL},
+  {0x973510c413118ffULL,0x4ed6a4741d9f06f0ULL,0x248dfa9fc795e725ULL,0x89d449a941e0b2cULL},
+  {0xefdc40fc10b751f0ULL,0x64c4a7c57fb1783cULL,0xe3b055ff3a76ec05ULL,0x87092dcbb9c3d254ULL},
+  {0xd5e04d1257cb1f59ULL,0x947024ebadaded8eULL,0xaf23295dbbaedf94ULL,0xa6c41db92ac40552ULL},
+  {0x13132ba37855fabbULL,0xa831d46b8ee94eb6ULL,0xef679714dabd590eULL,0xfe49a6a8b5e46bf1ULL},
+  {0x9bcc260fac1f082cULL,0x1f628118790ab697ULL,0x6909b852f9e26632ULL,0xa3502b58b72173ebULL},
+  {0x15445f87e05f4513ULL,0xf6b83f0bbc20722cULL,0xdf2f14e0e6e6b47aULL,0x4521954efcc98263ULL},
+  {0xcd38216e3802dae8ULL,0x723325991479180ULL,0x896cfe14e1e232e7ULL,0xc4be917df242647bULL},
+  {0xe3e53b1c00110bf3ULL,0x122f37b4e362b4ceULL,0xd5e401f1f89a5dfULL,0xcd15abbcd744d485ULL},
+  {0x2f8276b3aa980f1dULL,0x46e9d6ddfebb2f9aULL,0xc5ff9d3fe0ff41c8ULL,0x57288a5a7ca3e422ULL},
+  {0x368ca50918e00957ULL,0x303e915ff247f131ULL,0x41fd0f367a0737adULL,0xcfd4d36beb2e11f2ULL},
+  {0xf91dd80ecf85ad77ULL,0x6dc298f2b98adc72ULL,0xd02d2bca8238bdb6ULL,0xb393f59282f351b2ULL},
+  {0x15571284d1f7c189ULL,0xb6a1294d88ce7fe9ULL,0x3332400b303c0236ULL,0x72ea16b532a7336dULL},
+  {0xb40da036510bf15ULL,0x7e4fb2920fa94642ULL,0x1d1cdff595ffa332ULL,0xbc6c2a2742507382ULL},
+  {0xf2972b26153cf7aeULL,0x3215994827a46c2ULL,0xbe59fe0efe7ba2e7ULL,0xd5e6268b30952422ULL},
+  {0xbcd7e1193d634761ULL,0xdebcad9525d3833eULL,0x5e335d7c6651c583ULL,0xd294561fae72f32dULL},
+  {0x9f80472b943f32b9ULL,0x3e258a390c6f8837ULL,0xddad6ff386d416f4ULL,0xb8241453abc44c57ULL},
+  {0x33dbddaa4c159da2ULL,0x34f8c1cf61c95517ULL,0xb9a6f2f56b25e17aULL,0xd1716223ad8aaa0ULL},
+  {0xaaf2e7fee70c4914ULL,0x3e3d5f07146daa1aULL,0xfcb8e1c5c4417c71ULL,0xc1fdac5aef4c6f0fULL},
+  {0xffd4a2378a9cac00ULL,0xaba23f53473ac509ULL,0xcb20eb5ff56a798ULL,0x84a519ddef76c5e2ULL},
+  {0xaf42cc6efd684ccULL,0x1f3695b09a737fa3ULL,0xc304752cc3ebbc51ULL,0xfd5a31976fad6aeeULL},
+  {0xc442706cb1162436ULL,0x750cdd6e478b4d53ULL,0x60e16efec6616b21ULL,0x283435f57fb604cbULL},
+  {0xfd8b44803c9c6c81ULL,0x34c5c9a55c1cbf36ULL,0x8dde31677a24f558ULL,0x563651760897632fULL},
+  {0x6d485c252aa7238eULL,0x4628c2def16ca7c5ULL,0x5c272f61469f4b51ULL,0x62331450dfc53efaULL},
+  {0x4c86d9b453abd7edULL,0xc4439820c06950cdULL,0x22cae425ccd28912ULL,0xb5ce31605d6dd9c6ULL},
+  {0x36140eca8398ec74ULL,0x2a4dd9882e577009ULL,0x6f88ae8e75ef3deeULL,0xfd8a17b404f35d09ULL},
+  {0x8fa14ccdede3b4ebULL,0xf53e37a6f779f96eULL,0x3788194aafc545e7ULL,0x933d348378a71f44ULL},
+  {0x4c0aa2c1294c972fULL,0xa53ec8949c2e2d14ULL,0x742ae5605903cbcdULL,0x690cabf4e502bb7eULL},
+  {0x80ba8c8ae7731232ULL,0xcbea83d0543b5414ULL,0xbd7c4830224ac083ULL,0x2a7d3701a8724b12ULL},
+  {0x64530205740fcb15ULL,0x38db51f5b614f7dULL,0xec3a1ae811595767ULL,0x1104e5d422b7ae5aULL},
+  {0xb29290c3823c470eULL,0x4e311dc7780ef885ULL,0xed608a7236699899ULL,0xea90f8aae214ee16ULL},
+  {0x5a8a4d093328a002ULL,0xff794376be1e0fe1ULL,0x63eebebf507b60faULL,0xb10c521209643e2ULL},
+  {0x8705125c4861d598ULL,0x796da2b12c953d0bULL,0x65bd289ea3cf3f38ULL,0xcb7571c4071c5527ULL},
+  {0xb8cfd28fcacd25dcULL,0x4798ec2cfb912159ULL,0xe9d9b4975a476a81ULL,0x86fe370e64f07ceULL},
+  {0xc989a405ad7c287bULL,0xa66d4f3b128a40beULL,0x76d87f8194d45150ULL,0x7bbbb198eb39973bULL},
+  {0xb88f4cd1c5829e7ULL,0xc850229916e8671aULL,0x3704b9fbec634584ULL,0xf6cf592cc0ba6951ULL},
+  {0x59a501e28ff7892aULL,0x51b6d3d004c81952ULL,0x3dc8b39508959ad2ULL,0xa2f2f02a8272de6eULL},
+  {0xde22126b399a6b91ULL,0xd13c1e64874d19afULL,0xda4eb8a942361149ULL,0x13761dddc6df090dULL},
+  {0x41d8f503dd32b289ULL,0xd827b6290f4956a4ULL,0x66f1e75d5b6ef44fULL,0x8613bb848398681dULL},
+  {0x9efeff947af01d02ULL,0x172f8be29125d146ULL,0xe3853a8e80679f8fULL,0x16d34f6f5c6763ddULL},
+  {0x4e62724aa5a50306ULL,0x187b403215d97cdaULL,0xcae90a62d359c339ULL,0x838e779334aa6fe6ULL},
+  {0x8684dd3a2ae4c10dULL,0xbb272eec12268d02ULL,0xe07455d6e011840aULL,0xcf758b0712ed71dULL},
+  {0xd4070243a8433047ULL,0x10fa5f5d45f9c15ULL,0xee12a3d284bd1304ULL,0x1fcabf21e19ce68ULL},
+  {0xcba457b00e5bbff3ULL,0x69124a884d11e86fULL,0xd2b82857ab89bcdfULL,0xa758410b99a599acULL},
+  {0x9f9196a00969ed71ULL,0x4851f5b4c551bec6ULL,0xd6f28d6da0443c63ULL,0xe15723eb0e0bdbe6ULL},
+  {0x2321db14ea2a5bc6ULL,0x145c3c656ef5b9ceULL,0x9aefdf2898b87830ULL,0x82db2be0286f2ba0ULL},
+  {0x64576d31ab959ab2ULL,0xf1e32c34d6287deeULL,0x78bd4e53a05a267fULL,0xffb0e211c79fbb79ULL},
+  {0x46274c194bda3dedULL,0xb781fe68678a071ULL,0xe1b31e418eebd8dfULL,0xec17549240804eadULL},
+  {0xce8421f87e94e1a4ULL,0x1ae5537d75624288ULL,0xffc844b2ec0e255aULL,0xf6a9186ff147b9b5ULL},
+  {0x7c5a9c77cf9135b7ULL,0x5a97a55507475344ULL,0x6f36cc8065919b54ULL,0xe8201f92343b36c5ULL},
+  {0x9a5e75b583bc2c2aULL,0x113335366679eb09ULL,0xb328034b88c5bbbcULL,0x8791c0007c09c94dULL},
+  {0x2bfc42f530482421ULL,0x88dfc8a3800fbd26ULL,0xe0c7410b54c44e18ULL,0x7f95abe7e7418b02ULL},
+  {0x1c034e1464877b20ULL,0x7e8fdbe1ba101d94ULL,0x7ff564d2d4649c6fULL,0x4b985b13c5499026ULL},
+  {0xd322962c0ec8d590ULL,0x337ee58ef1703cdeULL,0xfbf3dd2912d96f70ULL,0x4d00acdf2f314fafULL},
+  {0xe92d8fc281135b0dULL,0x5813015563ca5d9cULL,0xfcf8703f93696f42ULL,0x31ce61a87834f52eULL},
+  {0x9e58ddd666a37f4cULL,0xa3ace5fe00edfa09ULL,0xd08afee77c5fed50ULL,0xa66c002c286827f6ULL},
+  {0xac7cecea9251c791ULL,0x9ead5f6e1ac23fbeULL,0x317ca083c5a8b85cULL,0xbea2a060505c13bcULL},
+  {0x145e649f093cd690ULL,0x38411db97aa9e00ULL,0x775f730082b044bULL,0xb04d308bc1c2bf54ULL},
+  {0x3cdff8d0d2827928ULL,0x8850091f84dee33ULL,0x896635ea855323b6ULL,0x74962c3fed9a6e9cULL},
+  {0x2e879c39e237aefbULL,0x7fcb518a3801ae48ULL,0x9a2d3bd0cfa072c3ULL,0x78df0c044a69b534ULL},
+  {0x696b0d61f122db3aULL,0xa165c526765b09f0ULL,0x3e6ecc328653ba7aULL,0x1cbcf83ea363e0d9ULL},
+  {0x53e74fe4532e3ea1ULL,0x30973aaf2a476278ULL,0xcfb33a9b58b3ed6eULL,0xa24b0cf967e35f9ULL},
+  {0x3d3de909e9fae659ULL,0x61b0a806e7ba29c7ULL,0xcc610e2d1c3d61f4ULL,0xd10b5a637ab546bfULL},
+  {0x628e63cc35d070ffULL,0xc29537e44e2dfbcULL,0x98637931f8d174c9ULL,0xf7515a08eba21c5cULL},
+  {0x4bb5fd503cea1a19ULL,0x7b945a2cb52c448eULL,0x341ad4779342c7bcULL,0x7b148ef273e1b131ULL},
+  {0xc19452766a003e5eULL,0x575ccbc1b92846f1ULL,0xa836b1306d41386dULL,0x24aceebb582cb5d7ULL},
+  {0x650ab9e0bfcfbba7ULL,0xd916314a60126028ULL,0x5e29ea94389ee3e6ULL,0x5847f4e06c653033ULL},
+  {0x3ceb16589ab78d7ULL,0x382efa16ebd7ad8ULL,0xe6663bb13ee54477ULL,0x876a1e9190531331ULL},
+  {0x1c59e44ecd0676ffULL,0xfb2e9898141a5248ULL,0x86611eec408082fbULL,0x2cbfad4d16c07021ULL},
+  {0x1f2d683621fd51c3ULL,0xe869e35f0f5f84ceULL,0xfe5d34e85229b465ULL,0x3dd2802c5f1c8f65ULL},
+  {0x5e85110c7d7fdf1dULL,0x18db178c5b6ae97eULL,0x4abe1644bb54cc85ULL,0x328e831d2f2b162cULL},
+  {0x2ca01cf9cfa006a0ULL,0x1eff9b7b09b3e0e7ULL,0x5beb39cd9565bcd4ULL,0x5a23a7ca6a97e240ULL},
+  {0x1521f3946dd15e4eULL,0x6eba68d46c922b6aULL,0x9455941440a8b100ULL,0x627eea93c6c9b53fULL},
+  {0xb9a8ddb9f08ed1cbULL,0x1173cc47b5e77b19ULL,0xbf2212dbd1165610ULL,0x564bd4f99e6268fdULL},
+  {0xe159bc42f5740c69ULL,0xe38242fc9f565dbbULL,0x716429863bcef432ULL,0x195a6a65d3790becULL},
+  {0xe311b5e5f78f0b4dULL,0x29020ee37c6fef68ULL,0x8ec41538d195ee52ULL,0x4d9ebbcef2cc8006ULL},
+  {0xa6c56ac1b611509bULL,0x5f87644c84d670e9ULL,0xbf281615d59f06ffULL,0x177c3a61682363abULL},
+  {0xa595cb8065227081ULL,0xdb2c8e4b4ba05ff4ULL,0x2abefb8b098568fcULL,0xfef23492e8346f32ULL},
+  {0xd49b6626c5955ac8ULL,0x25443efa80f8aff3ULL,0x43204df148eb1618ULL,0x2d1a0b9c8eaba065ULL},
+  {0x519515d95da85e50ULL,0xec854514829ef9c8ULL,0x3f2fb1398c08f921ULL,0xee02ce525cebc051ULL},
+  {0x1b82796ad0461736ULL,0x4058101d74f00538ULL,0x225fade934112d3ULL,0x549b18c310feaea1ULL},
+  {0x38c42cf00c2bf1aeULL,0x56c2ebf4e697b218ULL,0xe87a2401b5853625ULL,0x7a7915802f680f1bULL},
+  {0x434e7638acb46dbdULL,0x6367d24bd545bdcbULL,0x9221f5ae9541031ULL,0xe95e050881af550dULL},
+  {0x65ea4db7f6fa955bULL,0xc0691b77afafd59dULL,0x9826f5327bfdd80eULL,0xff49e905efb16004ULL},
+  {0xc968b4fe49b8c971ULL,0x99285b8755f25512ULL,0x8f1e2e26865118b9ULL,0x62f637c67d886374ULL},
+  {0x33168355c890afd0ULL,0x212cc034812a9c40ULL,0x125db2d93d7a3c59ULL,0xf48823ac5970d4eULL},
+  {0xf56efc49dcd7ab93ULL,0x206349d541035a94ULL,0x8184265eac7e0147ULL,0xa0cbc0165e32171cULL},
+  {0x5cb4abd386bd6433ULL,0x4c2f28d222942e6dULL,0x8b331ba48ed97e73ULL,0x3ffedf0da2042946ULL},
+  {0x4d5051f9e7f0c626ULL,0x9fc499670e0e2f82ULL,0x9f4041d3aa231f2bULL,0xa532d00d35013f85ULL},
+  {0xfb57d6b50d57bc3aULL,0xf92becd5521c791dULL,0xda3d9a9e27442208ULL,0x9bad7426d55014a6ULL},
+  {0x23a8f952d8d18ddeULL,0x9926833a3f40d28fULL,0x3fe5bcaa06bdedc3ULL,0x92c20846cfdf1e8fULL},
+  {0xb1c7b6d69be933f5ULL,0x526b3399149c3a74ULL,0x7749050c003eed6ULL,0x4094b8ac751a0630ULL},
+  {0x8304a412c16ecae6ULL,0xfdc4f92f00281a14ULL,0x3dba14c124095cbULL,0x1f023f2fa2bbece7ULL},
+  {0xfdde57f00e50f833ULL,0x2a2eee650ae28544ULL,0x48732b9fd07acb6fULL,0x29c04770e713f59ULL},
+  {0x13756cf7ef4e5f1bULL,0xfe067bcf5fc29751ULL,0x83dca0e503c798f8ULL,0x2dc6cae5cac2d887ULL},
+  {0xa2f8fb20b33887f4ULL,0x588e09b215d37a10ULL,0xa4af8bdafdeec2c1ULL,0x35e531b38368c082ULL},
+};
+
@@ -0,0 +1,721 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Daemon.h"
+#include "Timer.h"
+#include <string.h>
+#include <stdlib.h>
+#ifdef WIN64
+#include <io.h>
+#else
+#include <unistd.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+// Minimal JSON reader (flat object, string/number/boolean and array values)
+
+static const char *skipSpace(const char *p) {
+  while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+  return p;
+}
+
+static bool readString(const char *&p, string &s) {
+
+  s.clear();
+  if (*p != '"') return false;
+  p++;
+  while (*p && *p != '"') {
+    if (*p == '\\') {
+      p++;
+      switch (*p) {
+      case 'n': s.push_back('\n'); break;
+      case 't': s.push_back('\t'); break;
+      case 'r': s.push_back('\r'); break;
+      case 'b': s.push_back('\b'); break;
+      case 'f': s.push_back('\f'); break;
+      case 'u':
+        // Only ASCII is expected here
+        if (strlen(p) < 5) return false;
+        s.push_back((char)strtol(string(p + 1, 4).c_str(), NULL, 16));
+        p += 4;
+        break;
+      case 0: return false;
+      default: s.push_back(*p); break;
+      }
+    } else {
+      s.push_back(*p);
+    }
+    p++;
+  }
+  if (*p != '"') return false;
+  p++;
+  return true;
+
+}
+
+// String, number, true, false or null (as text)
+static bool readScalar(const char *&p, string &s, bool &isString) {
+
+  isString = (*p == '"');
+  if (isString)
+    return readString(p, s);
+
+  s.clear();
+  while (*p && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n')
+    s.push_back(*p++);
+  return s.length() > 0;
+
+}
+
+static bool readArray(const char *&p, vector<string> &list) {
+
+  bool isString;
+  string s;
+
+  if (*p != '[') return false;
+  p = skipSpace(p + 1);
+  if (*p == ']') {
+    p++;
+    return true;
+  }
+  while (true) {
+    if (!readScalar(p, s, isString)) return false;
+    list.push_back(s);
+    p = skipSpace(p);
+    if (*p == ']') break;
+    if (*p != ',') return false;
+    p = skipSpace(p + 1);
+  }
+  p++;
+  return true;
+
+}
+
+static string escape(string s) {
+
+  string r;
+  char tmp[8];
+  for (int i = 0; i < (int)s.length(); i++) {
+    unsigned char c = (unsigned char)s[i];
+    if (c == '"' || c == '\\') {
+      r.push_back('\\');
+      r.push_back((char)c);
+    } else if (c < 0x20) {
+      sprintf(tmp, "\\u%04x", c);
+      r.append(tmp);
+    } else {
+      r.push_back((char)c);
+    }
+  }
+  return r;
+
+}
+
+// Whole line (any length) without the end of line, false at end of file
+static bool readLine(FILE *f, string &line) {
+
+  char buff[4096];
+  line.clear();
+  while (fgets(buff, sizeof(buff), f) != NULL) {
+    line.append(buff);
+    if (line[line.length() - 1] == '\n') {
+      while (line.length() > 0 && (line[line.length() - 1] == '\n' || line[line.length() - 1] == '\r'))
+        line.erase(line.length() - 1);
+      return true;
+    }
+  }
+  return line.length() > 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+Daemon::Daemon(Secp256K1 *secp, int searchMode, bool useGpu, vector<int> gpuId, vector<int> gridSize,
+               int nbCPUThread, bool useSSE, uint32_t maxFound, bool paranoiacSeed) {
+
+  this->secp = secp;
+  this->searchMode = searchMode;
+  this->useGpu = useGpu;
+  this->gpuId = gpuId;
+  this->gridSize = gridSize;
+  this->nbCPUThread = nbCPUThread;
+  this->useSSE = useSSE;
+  this->maxFound = maxFound;
+  this->paranoiacSeed = paranoiacSeed;
+  nbOrder = 0;
+  quit = false;
+  out = stdout;
+
+#ifdef WIN64
+  ghMutex = CreateMutex(NULL, FALSE, NULL);
+  outMutex = CreateMutex(NULL, FALSE, NULL);
+#else
+  pthread_mutex_init(&ghMutex, NULL);
+  pthread_mutex_init(&outMutex, NULL);
+#endif
+
+  // CPU orders are searched concurrently, GPU orders one after the other
+  // on engines initialized once
+  sched = useGpu ? NULL : new Scheduler(nbCPUThread);
+#ifdef WITHGPU
+  if (useGpu) {
+    // rekey: the input key pinned memory is kept, each order sets its keys
+    for (int i = 0; i < (int)gpuId.size(); i++)
+      gpuEngine.push_back(new GPUEngine(gridSize[2 * i], gridSize[2 * i + 1], gpuId[i], maxFound, true));
+  }
+#endif
+
+}
+
+Daemon::~Daemon() {
+
+  delete sched;
+#ifdef WITHGPU
+  for (int i = 0; i < (int)gpuEngine.size(); i++)
+    delete gpuEngine[i];
+#endif
+
+#ifdef WIN64
+  CloseHandle(ghMutex);
+  CloseHandle(outMutex);
+#else
+  pthread_mutex_destroy(&ghMutex);
+  pthread_mutex_destroy(&outMutex);
+#endif
+
+}
+
+void Daemon::lock() {
+#ifdef WIN64
+  WaitForSingleObject(ghMutex, INFINITE);
+#else
+  pthread_mutex_lock(&ghMutex);
+#endif
+}
+
+void Daemon::unlock() {
+#ifdef WIN64
+  ReleaseMutex(ghMutex);
+#else
+  pthread_mutex_unlock(&ghMutex);
+#endif
+}
+
+void Daemon::send(string msg) {
+
+#ifdef WIN64
+  WaitForSingleObject(outMutex, INFINITE);
+#else
+  pthread_mutex_lock(&outMutex);
+#endif
+
+  fprintf(out, "%s\n", msg.c_str());
+  fflush(out);
+
+#ifdef WIN64
+  ReleaseMutex(outMutex);
+#else
+  pthread_mutex_unlock(&outMutex);
+#endif
+
+}
+
+// ----------------------------------------------------------------------------
+
+bool Daemon::parseOrder(const char *line, ORDER &o, string &error) {
+
+  string key;
+  string value;
+  bool isString;
+
+  o.type = ORDER_SEARCH;
+  o.id = "";
+  o.prefixes.clear();
+  o.pubKey = "";
+  o.caseSensitive = true;
+  o.hrp = "npub";
+  o.priority = 0;
+  o.weight = 1.0;
+
+  const char *p = skipSpace(line);
+  if (*p != '{') {
+    error = "JSON object expected";
+    return false;
+  }
+  p = skipSpace(p + 1);
+
+  while (*p != '}') {
+
+    if (!readString(p, key)) {
+      error = "key expected";
+      return false;
+    }
+    p = skipSpace(p);
+    if (*p != ':') {
+      error = "':' expected";
+      return false;
+    }
+    p = skipSpace(p + 1);
+
+    if (*p == '[') {
+      vector<string> list;
+      if (!readArray(p, list)) {
+        error = "invalid array";
+        return false;
+      }
+      if (key == "prefixes")
+        o.prefixes.insert(o.prefixes.end(), list.begin(), list.end());
+    } else {
+      if (!readScalar(p, value, isString)) {
+        error = "invalid value";
+        return false;
+      }
+      if (key == "id") {
+        o.id = value;
+      } else if (key == "prefix") {
+        o.prefixes.push_back(value);
+      } else if (key == "pubkey") {
+        o.pubKey = value;
+      } else if (key == "case_sensitive") {
+        o.caseSensitive = (value != "false");
+      } else if (key == "hrp") {
+        o.hrp = value;
+      } else if (key == "priority") {
+        o.priority = atoi(value.c_str());
+      } else if (key == "weight") {
+        o.weight = atof(value.c_str());
+        if (o.weight <= 0.0) {
+          error = "invalid weight";
+          return false;
+        }
+      } else if (key == "cancel") {
+        o.type = ORDER_CANCEL;
+        o.id = value;
+      } else if (key == "query") {
+        o.type = ORDER_QUERY;
+        o.id = value;
+      }
+    }
+
+    p = skipSpace(p);
+    if (*p == ',') {
+      p = skipSpace(p + 1);
+    } else if (*p != '}') {
+      error = "',' or '}' expected";
+      return false;
+    }
+
+  }
+
+  if (o.type == ORDER_SEARCH && o.prefixes.size() == 0) {
+    error = "no prefix";
+    return false;
+  }
+
+  return true;
+
+}
+
+// ----------------------------------------------------------------------------
+
+static void _onFound(void *user, string addr, string pAddr, string pAddrHex) {
+  RUNNING *r = (RUNNING *)user;
+  r->obj->OnFound(r, addr, pAddr, pAddrHex);
+}
+
+void Daemon::OnFound(RUNNING *r, string addr, string pAddr, string pAddrHex) {
+
+  // Called by the search threads, one at a time for a given order
+  r->found++;
+
+  string msg = "{\"id\":\"" + escape(r->id) + "\",\"address\":\"" + addr + "\"";
+  if (r->split) {
+    // Final key: VanitySearch -rp
+    msg += ",\"partialpriv\":\"" + pAddr + "\"}";
+  } else {
+    string wif;
+    int type = r->v->GetSearchType();
+    if (type <= BECH32) {
+      // P2PKH, P2SH and BECH32 may be mixed, the address gives the type
+      switch (addr[0]) {
+      case '3': type = P2SH; break;
+      case 'b': type = BECH32; break;
+      default:  type = P2PKH; break;
+      }
+    }
+    switch (type) {
+    case P2SH:   wif = "p2wpkh-p2sh:" + pAddr; break;
+    case BECH32: wif = "p2wpkh:" + pAddr; break;
+    case XONLY:
+    case ETH:    wif = pAddr; break;
+    default:     wif = "p2pkh:" + pAddr; break;
+    }
+    msg += ",\"wif\":\"" + wif + "\",\"priv\":\"0x" + pAddrHex + "\"}";
+  }
+  send(msg);
+
+}
+
+RUNNING *Daemon::startOrder(ORDER &o) {
+
+  string id = escape(o.id);
+
+  // Split key search, the mode is given by the public key
+  Point startPubKey;
+  startPubKey.Clear();
+  int mode = searchMode;
+  if (o.pubKey.length() > 0) {
+    bool compressed;
+    if (!secp->ParsePublicKeyHex(o.pubKey, startPubKey, compressed)) {
+      send("{\"id\":\"" + id + "\",\"status\":\"error\",\"error\":\"invalid public key\"}");
+      return NULL;
+    }
+    mode = compressed ? SEARCH_COMPRESSED : SEARCH_UNCOMPRESSED;
+  }
+
+  // VanitySearch keeps a reference on the prefix list, it lives in the
+  // RUNNING order (scheduled searches outlive the ORDER)
+  RUNNING *r = new RUNNING;
+  r->prefixes = o.prefixes;
+  for (int i = 0; i < (int)r->prefixes.size(); i++)
+    r->prefix.push_back(&r->prefixes[i][0]);
+
+  // Each order has its own random base key
+  VanitySearch *v = new VanitySearch(secp, r->prefix, "", mode, useGpu, true, "", useSSE, maxFound, 0,
+                                     o.caseSensitive, startPubKey, paranoiacSeed, "", o.hrp, false);
+  if (!v->IsReady()) {
+    string error = v->GetError();
+    if (error.length() == 0) error = "nothing to search";
+    send("{\"id\":\"" + id + "\",\"status\":\"error\",\"error\":\"" + escape(error) + "\"}");
+    delete v;
+    delete r;
+    return NULL;
+  }
+
+  r->obj = this;
+  r->v = v;
+  r->id = o.id;
+  r->jobId = -1;
+  r->split = (o.pubKey.length() > 0);
+  r->cancelled = false;
+  r->found = 0;
+  v->SetFoundCallback(_onFound, r);
+  if (gpuEngine.size() > 0)
+    v->SetGPUEngines(&gpuEngine[0]);
+
+  lock();
+  running.push_back(r);
+  unlock();
+
+  send("{\"id\":\"" + id + "\",\"status\":\"started\"}");
+  r->t0 = Timer::get_tick();
+  if (sched != NULL)
+    r->jobId = sched->AddJob(v, o.priority, o.weight);
+
+  return r;
+
+}
+
+void Daemon::endOrder(RUNNING *r) {
+
+  lock();
+  for (int i = 0; i < (int)running.size(); i++) {
+    if (running[i] == r) {
+      running.erase(running.begin() + i);
+      break;
+    }
+  }
+  unlock();
+
+  if (sched != NULL)
+    sched->RemoveJob(r->jobId);
+  double t1 = Timer::get_tick();
+
+  char tmp[64];
+  sprintf(tmp, "\"found\":%d,\"time\":%.3f}", r->found, t1 - r->t0);
+  send("{\"id\":\"" + escape(r->id) + "\",\"status\":\"" + (r->cancelled ? "cancelled" : "done") + "\"," + tmp);
+
+  delete r->v;
+  delete r;
+
+}
+
+void Daemon::cancel(string id) {
+
+  bool found = false;
+
+  lock();
+  for (int i = 0; i < (int)running.size(); i++) {
+    if (running[i]->id == id) {
+      running[i]->cancelled = true;
+      running[i]->v->Stop();
+      found = true;
+    }
+  }
+  for (int i = 0; i < (int)orders.size(); i++) {
+    if (orders[i].id == id) {
+      orders.erase(orders.begin() + i);
+      i--;
+      found = true;
+      send("{\"id\":\"" + escape(id) + "\",\"status\":\"cancelled\"}");
+    }
+  }
+  unlock();
+
+  if (!found)
+    send("{\"id\":\"" + escape(id) + "\",\"status\":\"error\",\"error\":\"unknown order\"}");
+
+}
+
+void Daemon::query(string id) {
+
+  bool found = false;
+  char tmp[256];
+
+  lock();
+  double t = Timer::get_tick();
+  for (int i = 0; i < (int)running.size(); i++) {
+    RUNNING *r = running[i];
+    if (id.length() > 0 && r->id != id)
+      continue;
+    double count = (double)r->v->GetCount();
+    double dt = t - r->v->GetStartTime();
+    double keyRate = (dt > 0.0) ? count / dt : 0.0;
+    sprintf(tmp, "\"status\":\"running\",\"found\":%d,\"count\":%.0f,\"rate\":%.0f,\"expected\":\"",
+            r->found, count, keyRate);
+    send("{\"id\":\"" + escape(r->id) + "\"," + tmp + escape(r->v->GetExpectedTime(keyRate, count)) + "\"}");
+    found = true;
+  }
+  for (int i = 0; i < (int)orders.size(); i++) {
+    if (id.length() > 0 && orders[i].id != id)
+      continue;
+    send("{\"id\":\"" + escape(orders[i].id) + "\",\"status\":\"queued\"}");
+    found = true;
+  }
+  unlock();
+
+  if (!found && id.length() > 0)
+    send("{\"id\":\"" + escape(id) + "\",\"status\":\"error\",\"error\":\"unknown order\"}");
+
+}
+
+void Daemon::ProcessOrders() {
+
+  while (true) {
+
+    // Start the next order (at once with the scheduler, when the
+    // previous one has ended otherwise)
+    lock();
+    bool end = quit && orders.size() == 0 && running.size() == 0;
+    bool next = orders.size() > 0 && (sched != NULL || running.size() == 0);
+    ORDER o;
+    if (next) {
+      o = orders.front();
+      orders.pop_front();
+    }
+    unlock();
+
+    if (end) break;
+
+    if (next) {
+      RUNNING *r = startOrder(o);
+      if (r != NULL && sched == NULL) {
+        r->v->Search(nbCPUThread, gpuId, gridSize);
+        endOrder(r);
+      }
+      continue;
+    }
+
+    // Report ended orders
+    RUNNING *ended = NULL;
+    lock();
+    for (int i = 0; i < (int)running.size() && ended == NULL; i++) {
+      if (running[i]->v->IsEnded())
+        ended = running[i];
+    }
+    unlock();
+
+    if (ended != NULL) {
+      endOrder(ended);
+      continue;
+    }
+
+    Timer::SleepMillis(1);
+
+  }
+
+}
+
+#ifdef WIN64
+DWORD WINAPI _processOrders(LPVOID lpParam) {
+#else
+void *_processOrders(void *lpParam) {
+#endif
+  ((Daemon *)lpParam)->ProcessOrders();
+  return 0;
+}
+
+// ----------------------------------------------------------------------------
+
+void Daemon::session(FILE *in, FILE *out, bool drain) {
+
+  string line;
+  string error;
+  char tmp[32];
+
+  this->out = out;
+  quit = false;
+
+#ifdef WIN64
+  DWORD thread_id;
+  HANDLE th = CreateThread(NULL, 0, _processOrders, (void*)this, 0, &thread_id);
+#else
+  pthread_t th;
+  pthread_create(&th, NULL, &_processOrders, (void*)this);
+#endif
+
+  while (readLine(in, line)) {
+
+    if (skipSpace(line.c_str())[0] == 0)
+      continue;
+
+    ORDER o;
+    if (!parseOrder(line.c_str(), o, error)) {
+      send("{\"status\":\"error\",\"error\":\"" + escape(error) + "\"}");
+      continue;
+    }
+
+    if (o.type == ORDER_CANCEL) {
+      cancel(o.id);
+      continue;
+    }
+    if (o.type == ORDER_QUERY) {
+      query(o.id);
+      continue;
+    }
+
+    lock();
+    nbOrder++;
+    if (o.id.length() == 0) {
+      sprintf(tmp, "%u", nbOrder);
+      o.id = string(tmp);
+    }
+    orders.push_back(o);
+    send("{\"id\":\"" + escape(o.id) + "\",\"status\":\"queued\"}");
+    unlock();
+
+  }
+
+  // End of input: finish the queue (stdin) or drop it (closed connection)
+  lock();
+  if (!drain) {
+    orders.clear();
+    for (int i = 0; i < (int)running.size(); i++) {
+      running[i]->cancelled = true;
+      running[i]->v->Stop();
+    }
+  }
+  quit = true;
+  unlock();
+
+#ifdef WIN64
+  WaitForSingleObject(th, INFINITE);
+  CloseHandle(th);
+#else
+  pthread_join(th, NULL);
+#endif
+
+}
+
+void Daemon::Run(string socketName) {
+
+  if (socketName.length() == 0) {
+
+    // Results on stdout, search messages are redirected to stderr
+    fflush(stdout);
+#ifdef WIN64
+    FILE *json = _fdopen(_dup(_fileno(stdout)), "w");
+    _dup2(_fileno(stderr), _fileno(stdout));
+#else
+    FILE *json = fdopen(dup(fileno(stdout)), "w");
+    dup2(fileno(stderr), fileno(stdout));
+#endif
+    if (json == NULL) {
+      printf("Daemon: Cannot open output\n");
+      exit(-1);
+    }
+    session(stdin, json, true);
+    fclose(json);
+    return;
+
+  }
+
+#ifdef WIN64
+
+  printf("Daemon: unix socket not supported on Windows, use stdin\n");
+  exit(-1);
+
+#else
+
+  signal(SIGPIPE, SIG_IGN);
+
+  struct sockaddr_un addr;
+  if (socketName.length() >= sizeof(addr.sun_path)) {
+    printf("Daemon: Socket name too long %s\n", socketName.c_str());
+    exit(-1);
+  }
+
+  int s = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (s < 0) {
+    perror("Daemon: socket");
+    exit(-1);
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, socketName.c_str());
+  unlink(socketName.c_str());
+  if (bind(s, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(s, 4) < 0) {
+    perror("Daemon: bind");
+    exit(-1);
+  }
+
+  printf("Daemon: listening on %s\n", socketName.c_str());
+
+  // One connection at a time
+  while (true) {
+
+    int c = accept(s, NULL, NULL);
+    if (c < 0) {
+      perror("Daemon: accept");
+      continue;
+    }
+    FILE *in = fdopen(c, "r");
+    FILE *o = fdopen(dup(c), "w");
+    session(in, o, false);
+    fclose(o);
+    fclose(in);
+
+  }
+
+#endif
+
+}
@@ -0,0 +1,126 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef DAEMONH
+#define DAEMONH
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <stdio.h>
+#include "SECP256k1.h"
+#include "Vanity.h"
+#include "Scheduler.h"
+#ifdef WIN64
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define ORDER_SEARCH 0
+#define ORDER_CANCEL 1
+#define ORDER_QUERY  2
+
+class Daemon;
+
+// Order, one JSON line:
+// {"id":"a1","prefixes":["1Test","1Abc"],"pubkey":"02...","case_sensitive":true,"priority":0,"weight":1,"hrp":"npub"}
+// {"cancel":"a1"}
+// {"query":"a1"} ("" for all orders)
+typedef struct {
+
+  int type;
+  std::string id;     // Order id (search) or target id (cancel, query)
+  std::vector<std::string> prefixes;
+  std::string pubKey;
+  bool caseSensitive;
+  std::string hrp;    // X-only prefixes
+  int priority;
+  double weight;
+
+} ORDER;
+
+// Order being searched
+typedef struct {
+
+  Daemon *obj;
+  VanitySearch *v;
+  std::string id;
+  std::vector<std::string> prefixes; // Referenced by v until the order ends
+  std::vector<char *> prefix;
+  int jobId;
+  bool split;
+  bool cancelled;
+  int found;
+  double t0;
+
+} RUNNING;
+
+class Daemon {
+
+public:
+
+  Daemon(Secp256K1 *secp, int searchMode, bool useGpu, std::vector<int> gpuId, std::vector<int> gridSize,
+         int nbCPUThread, bool useSSE, uint32_t maxFound, bool paranoiacSeed);
+  ~Daemon();
+
+  // Process orders from stdin (results on stdout) or from a unix socket
+  void Run(std::string socketName);
+  void ProcessOrders();
+  void OnFound(RUNNING *r, std::string addr, std::string pAddr, std::string pAddrHex);
+
+private:
+
+  void session(FILE *in, FILE *out, bool drain);
+  bool parseOrder(const char *line, ORDER &o, std::string &error);
+  RUNNING *startOrder(ORDER &o);
+  void endOrder(RUNNING *r);
+  void cancel(std::string id);
+  void query(std::string id);
+  void send(std::string msg);
+  void lock();
+  void unlock();
+
+  Secp256K1 *secp;
+  int searchMode;
+  bool useGpu;
+  std::vector<int> gpuId;
+  std::vector<int> gridSize;
+  std::vector<GPUEngine *> gpuEngine; // Kept from one order to the next
+  int nbCPUThread;
+  bool useSSE;
+  uint32_t maxFound;
+  bool paranoiacSeed;
+
+  std::deque<ORDER> orders;
+  std::vector<RUNNING *> running;
+  Scheduler *sched;
+  uint32_t nbOrder;
+  bool quit;
+  FILE *out;
+
+#ifdef WIN64
+  HANDLE ghMutex;
+  HANDLE outMutex;
+#else
+  pthread_mutex_t ghMutex;
+  pthread_mutex_t outMutex;
+#endif
+
+};
+
+#endif // DAEMONH
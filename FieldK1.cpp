@@ -0,0 +1,401 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "FieldK1.h"
+#include "Timer.h"
+#include <stdlib.h>
+
+// ------------------------------------------------
+
+static void inline imm_umul4(uint64_t *x, uint64_t y, uint64_t *dst) {
+
+  unsigned char c = 0;
+  uint64_t h, carry;
+  dst[0] = _umul128(x[0], y, &h); carry = h;
+  c = _addcarry_u64(c, _umul128(x[1], y, &h), carry, dst + 1); carry = h;
+  c = _addcarry_u64(c, _umul128(x[2], y, &h), carry, dst + 2); carry = h;
+  c = _addcarry_u64(c, _umul128(x[3], y, &h), carry, dst + 3); carry = h;
+  _addcarry_u64(c, 0ULL, carry, dst + 4);
+
+}
+
+// 512 bits to 256 bits (mod P)
+static void inline reduceK1(uint64_t *r512, uint64_t *dst) {
+
+  unsigned char c;
+  uint64_t t[5];
+  uint64_t ah, al;
+
+  // Reduce from 512 to 320
+  imm_umul4(r512 + 4, FK1_C, t);
+  c = _addcarry_u64(0, r512[0], t[0], r512 + 0);
+  c = _addcarry_u64(c, r512[1], t[1], r512 + 1);
+  c = _addcarry_u64(c, r512[2], t[2], r512 + 2);
+  c = _addcarry_u64(c, r512[3], t[3], r512 + 3);
+
+  // Reduce from 320 to 256
+  // No overflow possible here t[4]+c<=0x1000003D1ULL
+  al = _umul128(t[4] + c, FK1_C, &ah);
+  c = _addcarry_u64(0, r512[0], al, dst + 0);
+  c = _addcarry_u64(c, r512[1], ah, dst + 1);
+  c = _addcarry_u64(c, r512[2], 0ULL, dst + 2);
+  c = _addcarry_u64(c, r512[3], 0ULL, dst + 3);
+
+  // Last carry, dst < 2^66 when it occurs
+  c = _addcarry_u64(0, dst[0], (0ULL - c) & FK1_C, dst + 0);
+  _addcarry_u64(c, dst[1], 0ULL, dst + 1);
+
+}
+
+// ------------------------------------------------
+
+void FieldK1::ModMulK1(FieldK1 *a, FieldK1 *b) {
+
+  unsigned char c;
+  uint64_t r512[8];
+  uint64_t t[5];
+
+  // 256*256 multiplier
+  imm_umul4(a->bits64, b->bits64[0], r512);
+  imm_umul4(a->bits64, b->bits64[1], t);
+  c = _addcarry_u64(0, r512[1], t[0], r512 + 1);
+  c = _addcarry_u64(c, r512[2], t[1], r512 + 2);
+  c = _addcarry_u64(c, r512[3], t[2], r512 + 3);
+  c = _addcarry_u64(c, r512[4], t[3], r512 + 4);
+  _addcarry_u64(c, 0ULL, t[4], r512 + 5);
+  imm_umul4(a->bits64, b->bits64[2], t);
+  c = _addcarry_u64(0, r512[2], t[0], r512 + 2);
+  c = _addcarry_u64(c, r512[3], t[1], r512 + 3);
+  c = _addcarry_u64(c, r512[4], t[2], r512 + 4);
+  c = _addcarry_u64(c, r512[5], t[3], r512 + 5);
+  _addcarry_u64(c, 0ULL, t[4], r512 + 6);
+  imm_umul4(a->bits64, b->bits64[3], t);
+  c = _addcarry_u64(0, r512[3], t[0], r512 + 3);
+  c = _addcarry_u64(c, r512[4], t[1], r512 + 4);
+  c = _addcarry_u64(c, r512[5], t[2], r512 + 5);
+  c = _addcarry_u64(c, r512[6], t[3], r512 + 6);
+  _addcarry_u64(c, 0ULL, t[4], r512 + 7);
+
+  reduceK1(r512, bits64);
+
+}
+
+// ------------------------------------------------
+
+void FieldK1::ModMulK1(FieldK1 *a) {
+  ModMulK1(this, a);
+}
+
+// ------------------------------------------------
+
+void FieldK1::ModSquareK1(FieldK1 *a) {
+
+  unsigned char c;
+  uint64_t r512[8];
+  uint64_t h, l, m, carry;
+  uint64_t *x = a->bits64;
+
+  // Cross products x0*(x1,x2,x3)
+  r512[1] = _umul128(x[0], x[1], &h); carry = h;
+  c = _addcarry_u64(0, _umul128(x[0], x[2], &h), carry, r512 + 2); carry = h;
+  c = _addcarry_u64(c, _umul128(x[0], x[3], &h), carry, r512 + 3); carry = h;
+  _addcarry_u64(c, 0ULL, carry, r512 + 4);
+
+  // x1*(x2,x3)
+  l = _umul128(x[1], x[2], &h); carry = h;
+  c = _addcarry_u64(0, _umul128(x[1], x[3], &h), carry, &m); carry = h;
+  _addcarry_u64(c, 0ULL, carry, &carry);
+  c = _addcarry_u64(0, r512[3], l, r512 + 3);
+  c = _addcarry_u64(c, r512[4], m, r512 + 4);
+  _addcarry_u64(c, carry, 0ULL, r512 + 5);
+
+  // x2*x3
+  l = _umul128(x[2], x[3], &h);
+  c = _addcarry_u64(0, r512[5], l, r512 + 5);
+  _addcarry_u64(c, h, 0ULL, r512 + 6);
+
+  // Double
+  r512[7] = r512[6] >> 63;
+  r512[6] = (r512[6] << 1) | (r512[5] >> 63);
+  r512[5] = (r512[5] << 1) | (r512[4] >> 63);
+  r512[4] = (r512[4] << 1) | (r512[3] >> 63);
+  r512[3] = (r512[3] << 1) | (r512[2] >> 63);
+  r512[2] = (r512[2] << 1) | (r512[1] >> 63);
+  r512[1] = r512[1] << 1;
+
+  // Squares
+  r512[0] = _umul128(x[0], x[0], &h);
+  c = _addcarry_u64(0, r512[1], h, r512 + 1);
+  l = _umul128(x[1], x[1], &h);
+  c = _addcarry_u64(c, r512[2], l, r512 + 2);
+  c = _addcarry_u64(c, r512[3], h, r512 + 3);
+  l = _umul128(x[2], x[2], &h);
+  c = _addcarry_u64(c, r512[4], l, r512 + 4);
+  c = _addcarry_u64(c, r512[5], h, r512 + 5);
+  l = _umul128(x[3], x[3], &h);
+  c = _addcarry_u64(c, r512[6], l, r512 + 6);
+  _addcarry_u64(c, r512[7], h, r512 + 7);
+
+  reduceK1(r512, bits64);
+
+}
+
+// ------------------------------------------------
+
+// Int::ModInv() (divstep62) is about twice faster than a Fermat addition
+// chain, field must be set to P (done by Secp256K1::Init())
+void FieldK1::ModInv() {
+
+  Int inv;
+  Normalize();
+  Get(&inv);
+  inv.ModInv();
+  Set(&inv);
+
+}
+
+// ------------------------------------------------
+
+FieldGroup::FieldGroup(int size, int nbChain) {
+  this->size = size;
+  this->nbChain = nbChain;
+  subp = (FieldK1 *)malloc(size * sizeof(FieldK1));
+  chainInv = (FieldK1 *)malloc(nbChain * sizeof(FieldK1));
+}
+
+FieldGroup::~FieldGroup() {
+  free(subp);
+  free(chainInv);
+}
+
+void FieldGroup::Set(FieldK1 *pts) {
+  ints = pts;
+}
+
+// Compute modular inversion of the whole group
+// Chain k holds ints[k], ints[k+nbChain], ... : the multiplications of
+// different chains are independent and the chains share a single ModInv
+void FieldGroup::ModInv() {
+
+  FieldK1 newValue;
+  FieldK1 inverse;
+  int n = nbChain;
+  int i, k;
+
+  for (k = 0; k < n; k++)
+    subp[k].Set(&ints[k]);
+  for (i = n; i < size; i++)
+    subp[i].ModMulK1(&subp[i - n], &ints[i]);
+
+  // Product of the chains
+  FieldK1 *last = subp + (size - n);
+  chainInv[0].Set(&last[0]);
+  for (k = 1; k < n; k++)
+    chainInv[k].ModMulK1(&chainInv[k - 1], &last[k]);
+
+  // Do the inversion
+  inverse.Set(&chainInv[n - 1]);
+  inverse.ModInv();
+
+  // Inverse of each chain product
+  for (k = n - 1; k > 0; k--) {
+    chainInv[k].ModMulK1(&chainInv[k - 1], &inverse);
+    inverse.ModMulK1(&last[k]);
+  }
+  chainInv[0].Set(&inverse);
+
+  for (i = size - n; i > 0; i -= n) {
+    for (k = 0; k < n; k++) {
+      newValue.ModMulK1(&subp[i + k - n], &chainInv[k]);
+      chainInv[k].ModMulK1(&ints[i + k]);
+      ints[i + k].Set(&newValue);
+    }
+  }
+
+  for (k = 0; k < n; k++)
+    ints[k].Set(&chainInv[k]);
+
+}
+
+// ------------------------------------------------
+
+#define CHECKFIELD(name,r,i) \
+  if (!fr.IsEqual(&r)) { \
+    printf("FieldK1 " name " Wrong !\n"); \
+    printf("[%d] %s\n", i, r.GetBase16().c_str()); \
+    printf("[%d] %s\n", i, fr.GetBase16().c_str()); \
+    return; \
+  }
+
+void FieldK1::Check() {
+
+  Int P;
+  Int a, b, r, fr;
+  FieldK1 fa, fb, fc;
+  double t0;
+  double t1;
+
+  P.SetBase16("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
+  Int::SetupField(&P);
+
+  // Border values
+  Int border[4];
+  border[0].SetInt32(0);
+  border[1].SetInt32(1);
+  border[2].Set(&P);
+  border[2].SubOne();
+  border[3].SetBase16("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE00000000");
+
+  for (int i = 0; i < 100000; i++) {
+
+    if (i < 16) {
+      a.Set(border + (i & 3));
+      b.Set(border + (i >> 2));
+    } else {
+      a.Rand(&P);
+      b.Rand(&P);
+    }
+    fa.Set(&a);
+    fb.Set(&b);
+
+    r.ModAdd(&a, &b);
+    fc.ModAdd(&fa, &fb); fc.Get(&fr);
+    CHECKFIELD("ModAdd()", r, i);
+
+    r.ModSub(&a, &b);
+    fc.ModSub(&fa, &fb); fc.Get(&fr);
+    CHECKFIELD("ModSub()", r, i);
+
+    r.Set(&a);
+    r.ModNeg();
+    fc.Set(&fa);
+    fc.ModNeg(); fc.Get(&fr);
+    CHECKFIELD("ModNeg()", r, i);
+
+    // Products are in [0,2^256[
+    r.ModMul(&a, &b);
+    fc.ModMulK1(&fa, &fb); fc.Get(&fr); fr.Mod(&P);
+    CHECKFIELD("ModMulK1()", r, i);
+
+    r.ModMul(&a, &a);
+    fc.ModSquareK1(&fa); fc.Get(&fr); fr.Mod(&P);
+    CHECKFIELD("ModSquareK1()", r, i);
+
+    if (i < 1000 && !a.IsZero()) {
+      r.Set(&a);
+      r.ModInv();
+      fc.Set(&fa);
+      fc.ModInv(); fc.Get(&fr); fr.Mod(&P);
+      CHECKFIELD("ModInv()", r, i);
+    }
+
+  }
+
+  // Lazy reduction, unreduced inputs (P, P+1, 2^256-1) as border values
+  Int lborder[7];
+  for (int i = 0; i < 4; i++)
+    lborder[i].Set(border + i);
+  lborder[4].Set(&P);
+  lborder[5].Set(&P);
+  lborder[5].AddOne();
+  lborder[6].SetBase16("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+
+  for (int i = 0; i < 100000; i++) {
+
+    if (i < 49) {
+      a.Set(lborder + (i % 7));
+      b.Set(lborder + (i / 7));
+    } else {
+      a.Rand(&P);
+      b.Rand(&P);
+    }
+    fa.Set(&a);
+    fb.Set(&b);
+    a.Mod(&P);
+    b.Mod(&P);
+
+    r.ModAdd(&a, &b);
+    fc.AddLazy(&fa, &fb); fc.Normalize(); fc.Get(&fr);
+    CHECKFIELD("AddLazy()", r, i);
+
+    r.ModSub(&a, &b);
+    fc.SubLazy(&fa, &fb); fc.Normalize(); fc.Get(&fr);
+    CHECKFIELD("SubLazy()", r, i);
+
+    r.Set(&a);
+    fc.Set(&fa);
+    fc.Normalize(); fc.Get(&fr);
+    CHECKFIELD("Normalize()", r, i);
+
+  }
+
+  a.Rand(&P);
+  b.Rand(&P);
+  fa.Set(&a);
+  fb.Set(&b);
+  t0 = Timer::get_tick();
+  for (int i = 0; i < 1000000; i++) {
+    fa.ModMulK1(&fb);
+  }
+  t1 = Timer::get_tick();
+
+  printf("FieldK1 ModMulK1() Results OK : ");
+  Timer::printResult("Mult", 1000000, 0, t1 - t0);
+
+  t0 = Timer::get_tick();
+  for (int i = 0; i < 1000000; i++) {
+    fa.ModSquareK1(&fa);
+  }
+  t1 = Timer::get_tick();
+
+  printf("FieldK1 ModSquareK1() Results OK : ");
+  Timer::printResult("Sqr", 1000000, 0, t1 - t0);
+
+  // FieldGroup (1, 2 and 4 chains)
+  FieldK1 m[256];
+  Int chk[256];
+  FieldGroup g(256);
+
+  for (int n = 4; n > 0; n /= 2) {
+    FieldGroup gc(256, n);
+    gc.Set(m);
+    for (int i = 0; i < 256; i++) {
+      a.Rand(&P);
+      if (a.IsZero()) a.SetInt32(1);
+      m[i].Set(&a);
+      chk[i].Set(&a);
+      chk[i].ModInv();
+    }
+    gc.ModInv();
+    for (int i = 0; i < 256; i++) {
+      m[i].Get(&fr);
+      fr.Mod(&P);
+      CHECKFIELD("FieldGroup.ModInv()", chk[i], i);
+    }
+  }
+
+  g.Set(m);
+
+  t0 = Timer::get_tick();
+  for (int j = 0; j < 1000; j++)
+    g.ModInv();
+  t1 = Timer::get_tick();
+
+  printf("FieldK1 FieldGroup.ModInv() Results OK : ");
+  Timer::printResult("Inv", 1000 * 256, 0, t1 - t0);
+
+}
@@ -0,0 +1,293 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// SecpK1 field element (4x64 bits), used by the CPU search loop.
+// Int keeps an extra block (Knuth div, signed ModInv), not needed here.
+// As for Int::ModMulK1(), results are in [0,2^256[ and may be >= P with a
+// negligible probability. The lazy routines skip the final reduction, values
+// are in [0,2^256[ and Normalize() brings them to [0,P[.
+
+#ifndef FIELDK1H
+#define FIELDK1H
+
+#include "Int.h"
+#include "Point.h"
+
+class FieldK1 {
+
+public:
+
+  void Set(FieldK1 *a);
+  void Set(Int *a);                          // a in [0,P[
+  void Get(Int *a);
+
+  void ModAdd(FieldK1 *a);                   // this <- this+a (mod P)
+  void ModAdd(FieldK1 *a, FieldK1 *b);       // this <- a+b (mod P)
+  void ModSub(FieldK1 *a);                   // this <- this-a (mod P)
+  void ModSub(FieldK1 *a, FieldK1 *b);       // this <- a-b (mod P)
+  void ModNeg();                             // this <- -this (mod P)
+  void ModMulK1(FieldK1 *a, FieldK1 *b);     // this <- a*b (mod P)
+  void ModMulK1(FieldK1 *a);                 // this <- this*a (mod P)
+  void ModSquareK1(FieldK1 *a);              // this <- a^2 (mod P)
+  void ModInv();                             // this <- this^-1 (mod P)
+
+  // Lazy reduction, inputs and results are in [0,2^256[, call Normalize()
+  // before hashing or comparing
+  void AddLazy(FieldK1 *a, FieldK1 *b);      // this <- a+b (mod P)
+  void SubLazy(FieldK1 *a, FieldK1 *b);      // this <- a-b (mod P)
+  void SubLazy(FieldK1 *a);                  // this <- this-a (mod P)
+  void Normalize();                          // this <- this (mod P), [0,P[
+
+  bool IsZero();
+  bool IsEqual(FieldK1 *a);
+  bool IsOdd();
+  bool IsEven();
+  void Get32Bytes(unsigned char *buff);
+
+  static void Check();
+
+  union {
+    uint32_t bits[8];
+    uint64_t bits64[4];
+  };
+
+};
+
+// Affine point (z = 1)
+class PointK1 {
+
+public:
+
+  void Set(Point &p);
+  void Get(Point &p);
+
+  FieldK1 x;
+  FieldK1 y;
+
+};
+
+// Grouped inversion (see IntGroup), nbChain interleaved product chains
+// (size must be a multiple of nbChain)
+class FieldGroup {
+
+public:
+
+  FieldGroup(int size, int nbChain = 1);
+  ~FieldGroup();
+  void Set(FieldK1 *pts);
+  void ModInv();
+
+private:
+
+  FieldK1 *ints;
+  FieldK1 *subp;
+  FieldK1 *chainInv;
+  int size;
+  int nbChain;
+
+};
+
+// Inline routines
+
+#define FK1_C 0x1000003D1ULL // 2^256 - P
+
+inline void FieldK1::Set(FieldK1 *a) {
+  bits64[0] = a->bits64[0];
+  bits64[1] = a->bits64[1];
+  bits64[2] = a->bits64[2];
+  bits64[3] = a->bits64[3];
+}
+
+inline void FieldK1::Set(Int *a) {
+  bits64[0] = a->bits64[0];
+  bits64[1] = a->bits64[1];
+  bits64[2] = a->bits64[2];
+  bits64[3] = a->bits64[3];
+}
+
+inline void FieldK1::Get(Int *a) {
+  a->bits64[0] = bits64[0];
+  a->bits64[1] = bits64[1];
+  a->bits64[2] = bits64[2];
+  a->bits64[3] = bits64[3];
+  a->bits64[4] = 0;
+#if NB64BLOCK > 5
+  for (int i = 5; i < NB64BLOCK; i++)
+    a->bits64[i] = 0;
+#endif
+}
+
+inline void FieldK1::ModAdd(FieldK1 *a, FieldK1 *b) {
+
+  unsigned char c, c2;
+  uint64_t s0, s1, s2, s3;
+  uint64_t t;
+
+  c = _addcarry_u64(0, a->bits64[0], b->bits64[0], &s0);
+  c = _addcarry_u64(c, a->bits64[1], b->bits64[1], &s1);
+  c = _addcarry_u64(c, a->bits64[2], b->bits64[2], &s2);
+  c = _addcarry_u64(c, a->bits64[3], b->bits64[3], &s3);
+
+  // s >= P when s + 2^256 - P overflows
+  c2 = _addcarry_u64(0, s0, FK1_C, &t);
+  c2 = _addcarry_u64(c2, s1, 0ULL, &t);
+  c2 = _addcarry_u64(c2, s2, 0ULL, &t);
+  c2 = _addcarry_u64(c2, s3, 0ULL, &t);
+
+  // Subtract P (mod 2^256)
+  uint64_t m = (0ULL - (uint64_t)(c | c2)) & FK1_C;
+  c = _addcarry_u64(0, s0, m, bits64 + 0);
+  c = _addcarry_u64(c, s1, 0ULL, bits64 + 1);
+  c = _addcarry_u64(c, s2, 0ULL, bits64 + 2);
+  _addcarry_u64(c, s3, 0ULL, bits64 + 3);
+
+}
+
+inline void FieldK1::ModAdd(FieldK1 *a) {
+  ModAdd(this, a);
+}
+
+inline void FieldK1::ModSub(FieldK1 *a, FieldK1 *b) {
+
+  unsigned char c;
+  uint64_t r0, r1, r2, r3;
+
+  c = _subborrow_u64(0, a->bits64[0], b->bits64[0], &r0);
+  c = _subborrow_u64(c, a->bits64[1], b->bits64[1], &r1);
+  c = _subborrow_u64(c, a->bits64[2], b->bits64[2], &r2);
+  c = _subborrow_u64(c, a->bits64[3], b->bits64[3], &r3);
+
+  // Borrow: add P (mod 2^256)
+  uint64_t m = (0ULL - (uint64_t)c) & FK1_C;
+  c = _subborrow_u64(0, r0, m, bits64 + 0);
+  c = _subborrow_u64(c, r1, 0ULL, bits64 + 1);
+  c = _subborrow_u64(c, r2, 0ULL, bits64 + 2);
+  _subborrow_u64(c, r3, 0ULL, bits64 + 3);
+
+}
+
+inline void FieldK1::ModSub(FieldK1 *a) {
+  ModSub(this, a);
+}
+
+inline void FieldK1::ModNeg() {
+
+  unsigned char c;
+  c = _subborrow_u64(0, 0xFFFFFFFEFFFFFC2FULL, bits64[0], bits64 + 0);
+  c = _subborrow_u64(c, 0xFFFFFFFFFFFFFFFFULL, bits64[1], bits64 + 1);
+  c = _subborrow_u64(c, 0xFFFFFFFFFFFFFFFFULL, bits64[2], bits64 + 2);
+  _subborrow_u64(c, 0xFFFFFFFFFFFFFFFFULL, bits64[3], bits64 + 3);
+
+}
+
+inline void FieldK1::AddLazy(FieldK1 *a, FieldK1 *b) {
+
+  unsigned char c;
+
+  c = _addcarry_u64(0, a->bits64[0], b->bits64[0], bits64 + 0);
+  c = _addcarry_u64(c, a->bits64[1], b->bits64[1], bits64 + 1);
+  c = _addcarry_u64(c, a->bits64[2], b->bits64[2], bits64 + 2);
+  c = _addcarry_u64(c, a->bits64[3], b->bits64[3], bits64 + 3);
+
+  // Carry: add 2^256 - P, it propagates above the first block with a
+  // probability of about 2^-31
+  c = _addcarry_u64(0, bits64[0], (0ULL - (uint64_t)c) & FK1_C, bits64 + 0);
+  if (c) {
+    c = _addcarry_u64(c, bits64[1], 0ULL, bits64 + 1);
+    c = _addcarry_u64(c, bits64[2], 0ULL, bits64 + 2);
+    c = _addcarry_u64(c, bits64[3], 0ULL, bits64 + 3);
+    bits64[0] += (0ULL - (uint64_t)c) & FK1_C;
+  }
+
+}
+
+inline void FieldK1::SubLazy(FieldK1 *a, FieldK1 *b) {
+
+  unsigned char c;
+
+  c = _subborrow_u64(0, a->bits64[0], b->bits64[0], bits64 + 0);
+  c = _subborrow_u64(c, a->bits64[1], b->bits64[1], bits64 + 1);
+  c = _subborrow_u64(c, a->bits64[2], b->bits64[2], bits64 + 2);
+  c = _subborrow_u64(c, a->bits64[3], b->bits64[3], bits64 + 3);
+
+  // Borrow: subtract 2^256 - P (see AddLazy())
+  c = _subborrow_u64(0, bits64[0], (0ULL - (uint64_t)c) & FK1_C, bits64 + 0);
+  if (c) {
+    c = _subborrow_u64(c, bits64[1], 0ULL, bits64 + 1);
+    c = _subborrow_u64(c, bits64[2], 0ULL, bits64 + 2);
+    c = _subborrow_u64(c, bits64[3], 0ULL, bits64 + 3);
+    bits64[0] -= (0ULL - (uint64_t)c) & FK1_C;
+  }
+
+}
+
+inline void FieldK1::SubLazy(FieldK1 *a) {
+  SubLazy(this, a);
+}
+
+inline void FieldK1::Normalize() {
+
+  // this >= P needs the 3 upper blocks at 0xFFFFFFFFFFFFFFFF
+  if ((bits64[3] & bits64[2] & bits64[1]) == 0xFFFFFFFFFFFFFFFFULL &&
+      bits64[0] >= 0xFFFFFFFEFFFFFC2FULL) {
+    bits64[0] += FK1_C;
+    bits64[1] = 0;
+    bits64[2] = 0;
+    bits64[3] = 0;
+  }
+
+}
+
+inline bool FieldK1::IsZero() {
+  return (bits64[0] | bits64[1] | bits64[2] | bits64[3]) == 0;
+}
+
+inline bool FieldK1::IsEqual(FieldK1 *a) {
+  return ((bits64[0] ^ a->bits64[0]) | (bits64[1] ^ a->bits64[1]) |
+          (bits64[2] ^ a->bits64[2]) | (bits64[3] ^ a->bits64[3])) == 0;
+}
+
+inline bool FieldK1::IsOdd() {
+  return (bits[0] & 0x1) == 1;
+}
+
+inline bool FieldK1::IsEven() {
+  return (bits[0] & 0x1) == 0;
+}
+
+inline void FieldK1::Get32Bytes(unsigned char *buff) {
+
+  uint64_t *ptr = (uint64_t *)buff;
+  ptr[3] = _byteswap_uint64(bits64[0]);
+  ptr[2] = _byteswap_uint64(bits64[1]);
+  ptr[1] = _byteswap_uint64(bits64[2]);
+  ptr[0] = _byteswap_uint64(bits64[3]);
+
+}
+
+inline void PointK1::Set(Point &p) {
+  x.Set(&p.x);
+  y.Set(&p.y);
+}
+
+inline void PointK1::Get(Point &p) {
+  x.Get(&p.x);
+  y.Get(&p.y);
+  p.z.SetInt32(1);
+}
+
+#endif // FIELDK1H
@@ -175,6 +175,7 @@ int _ConvertSMVer2Cores(int major, int minor) {
 GPUEngine::GPUEngine(int nbThreadGroup, int nbThreadPerGroup, int gpuId, uint32_t maxFound,bool rekey) {
 
   // Initialise CUDA
+  this->gpuId = gpuId;
   this->rekey = rekey;
   this->nbThreadPerGroup = nbThreadPerGroup;
   initialised = false;
@@ -345,6 +346,8 @@ GPUEngine::~GPUEngine() {
   cudaFree(inputKey);
   cudaFree(inputPrefix);
   if(inputPrefixLookUp) cudaFree(inputPrefixLookUp);
+  if(inputPrefixPinned) cudaFreeHost(inputPrefixPinned);
+  if(inputKeyPinned) cudaFreeHost(inputKeyPinned);
   cudaFreeHost(outputPrefixPinned);
   cudaFree(outputPrefix);
 
@@ -368,12 +371,8 @@ void GPUEngine::SetPrefix(std::vector<prefix_t> prefixes) {
   for(int i=0;i<(int)prefixes.size();i++)
     inputPrefixPinned[prefixes[i]]=1;
 
-  // Fill device memory
+  // Fill device memory (pinned memory is kept, prefixes may be updated)
   cudaMemcpy(inputPrefix, inputPrefixPinned, _64K * 2, cudaMemcpyHostToDevice);
-
-  // We do not need the input pinned memory anymore
-  cudaFreeHost(inputPrefixPinned);
-  inputPrefixPinned = NULL;
   lostWarning = false;
 
   cudaError_t err = cudaGetLastError();
@@ -387,12 +386,8 @@ void GPUEngine::SetPattern(const char *pattern) {
 
   strcpy((char *)inputPrefixPinned,pattern);
 
-  // Fill device memory
+  // Fill device memory (pinned memory is kept, the engine may be reused)
   cudaMemcpy(inputPrefix, inputPrefixPinned, _64K * 2, cudaMemcpyHostToDevice);
-
-  // We do not need the input pinned memory anymore
-  cudaFreeHost(inputPrefixPinned);
-  inputPrefixPinned = NULL;
   lostWarning = false;
 
   cudaError_t err = cudaGetLastError();
@@ -404,46 +399,37 @@ void GPUEngine::SetPattern(const char *pattern) {
 
 }
 
-void GPUEngine::SetPrefix(std::vector<LPREFIX> prefixes, uint32_t totalPrefix) {
+void GPUEngine::ResetPrefix() {
 
-  // Allocate memory for the second level of lookup tables
-  cudaError_t err = cudaMalloc((void **)&inputPrefixLookUp, (_64K+totalPrefix) * 4);
-  if (err != cudaSuccess) {
-    printf("GPUEngine: Allocate prefix lookup memory: %s\n", cudaGetErrorString(err));
-    return;
-  }
-  err = cudaHostAlloc(&inputPrefixLookUpPinned, (_64K+totalPrefix) * 4, cudaHostAllocWriteCombined | cudaHostAllocMapped);
-  if (err != cudaSuccess) {
-    printf("GPUEngine: Allocate prefix lookup pinned memory: %s\n", cudaGetErrorString(err));
-    return;
+  // New search on a running engine (daemon orders), may be called from
+  // another thread than the constructor
+  cudaSetDevice(gpuId);
+  if (inputPrefixLookUp) {
+    cudaFree(inputPrefixLookUp);
+    inputPrefixLookUp = NULL;
   }
+  hasPattern = false;
 
-  uint32_t offset = _64K;
-  memset(inputPrefixPinned, 0, _64K * 2);
-  memset(inputPrefixLookUpPinned, 0, _64K * 4);
-  for (int i = 0; i < (int)prefixes.size(); i++) {
-    int nbLPrefix = (int)prefixes[i].lPrefixes.size();
-    inputPrefixPinned[prefixes[i].sPrefix] = (uint16_t)nbLPrefix;
-    inputPrefixLookUpPinned[prefixes[i].sPrefix] = offset;
-    for (int j = 0; j < nbLPrefix; j++) {
-      inputPrefixLookUpPinned[offset++]=prefixes[i].lPrefixes[j];
-    }
-  }
+}
 
-  if (offset != (_64K+totalPrefix)) {
-    printf("GPUEngine: Wrong totalPrefix %d!=%d!\n",offset- _64K, totalPrefix);
-    return;
+void GPUEngine::SetPrefix(prefix_t *lookup16, uint32_t *lookup32, uint32_t totalPrefix) {
+
+  // lookup16[sPrefix]: number of lPrefix having the sPrefix 16bit prefix
+  // lookup32[sPrefix]: offset in lookup32 of the sorted lPrefix list
+  // Updates (pruned lookup16) keep the same lookup32
+  cudaError_t err;
+  if (inputPrefixLookUp == NULL) {
+    err = cudaMalloc((void **)&inputPrefixLookUp, (_64K+totalPrefix) * 4);
+    if (err != cudaSuccess) {
+      printf("GPUEngine: Allocate prefix lookup memory: %s\n", cudaGetErrorString(err));
+      return;
+    }
+    cudaMemcpy(inputPrefixLookUp, lookup32, (_64K+totalPrefix) * 4, cudaMemcpyHostToDevice);
   }
 
   // Fill device memory
+  memcpy(inputPrefixPinned, lookup16, _64K * 2);
   cudaMemcpy(inputPrefix, inputPrefixPinned, _64K * 2, cudaMemcpyHostToDevice);
-  cudaMemcpy(inputPrefixLookUp, inputPrefixLookUpPinned, (_64K+totalPrefix) * 4, cudaMemcpyHostToDevice);
-
-  // We do not need the input pinned memory anymore
-  cudaFreeHost(inputPrefixPinned);
-  inputPrefixPinned = NULL;
-  cudaFreeHost(inputPrefixLookUpPinned);
-  inputPrefixLookUpPinned = NULL;
   lostWarning = false;
 
   err = cudaGetLastError();
@@ -525,7 +511,8 @@ bool GPUEngine::SetKeys(Point *p) {
   cudaMemcpy(inputKey, inputKeyPinned, nbThread*32*2, cudaMemcpyHostToDevice);
 
   if (!rekey) {
-    // We do not need the input pinned memory anymore
+    // We do not need the input pinned memory anymore (keys are set once,
+    // reusable engines are created with rekey)
     cudaFreeHost(inputKeyPinned);
     inputKeyPinned = NULL;
   }
@@ -46,12 +46,6 @@ typedef struct {
   bool mode;
 } ITEM;
 
-// Second level lookup
-typedef struct {
-  prefix_t sPrefix;
-  std::vector<prefixl_t> lPrefixes;
-} LPREFIX;
-
 class GPUEngine {
 
 public:
@@ -59,11 +53,12 @@ public:
   GPUEngine(int nbThreadGroup,int nbThreadPerGroup,int gpuId,uint32_t maxFound,bool rekey);
   ~GPUEngine();
   void SetPrefix(std::vector<prefix_t> prefixes);
-  void SetPrefix(std::vector<LPREFIX> prefixes,uint32_t totalPrefix);
+  void SetPrefix(prefix_t *lookup16,uint32_t *lookup32,uint32_t totalPrefix);
   bool SetKeys(Point *p);
   void SetSearchMode(int searchMode);
   void SetSearchType(int searchType);
   void SetPattern(const char *pattern);
+  void ResetPrefix();
   bool Launch(std::vector<ITEM> &prefixFound,bool spinWait=false);
   int GetNbThread();
   int GetGroupSize();
@@ -81,12 +76,12 @@ private:
   static void Browse(FILE *f,int depth, int max, int s);
   bool CheckHash(uint8_t *h, std::vector<ITEM>& found, int tid, int incr, int endo, int *ok);
 
+  int gpuId;
   int nbThread;
   int nbThreadPerGroup;
   prefix_t *inputPrefix;
   prefix_t *inputPrefixPinned;
   uint32_t *inputPrefixLookUp;
-  uint32_t *inputPrefixLookUpPinned;
   uint64_t *inputKey;
   uint64_t *inputKeyPinned;
   uint32_t *outputPrefix;
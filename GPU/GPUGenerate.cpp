@@ -23,18 +23,15 @@ using namespace std;
 
 void GPUEngine::GenerateCode(Secp256K1 *secp, int size) {
 
-  // Compute generator table
-  Point *Gn = new Point[size];
-  Point g = secp->G;
-  Gn[0] = g;
-  g = secp->DoubleDirect(g);
-  Gn[1] = g;
-  for (int i = 2; i < size; i++) {
-    g = secp->AddDirect(g, secp->G);
-    Gn[i] = g;
-  }
-  // _2Gn = CPU_GRP_SIZE*G
-  Point _2Gn = secp->DoubleDirect(Gn[size / 2 - 1]);
+  // Compute generator table (Jacobian), Gn[size/2] = _2Gn = GRP_SIZE*G
+  Point *Gn = new Point[size / 2 + 1];
+  Gn[0] = secp->G;
+  Gn[1] = secp->DoubleJacobian(secp->G);
+  for (int i = 2; i < size / 2; i++)
+    Gn[i] = secp->AddJacobianMixed(Gn[i - 1], secp->G);
+  Gn[size / 2] = secp->DoubleJacobian(Gn[size / 2 - 1]);
+  secp->BatchNormalize(Gn + 1, size / 2);
+  Point _2Gn = Gn[size / 2];
 
   // Write file
   FILE *f = fopen("GPU/GPUGroup.h", "w");
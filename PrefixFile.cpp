@@ -0,0 +1,230 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PrefixFile.h"
+#include "Timer.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <errno.h>
+#ifdef WIN64
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+// Minimum chunk size per thread
+#define CHUNK_MIN (1024*1024)
+
+typedef struct {
+
+  char *start;
+  char *end;
+  vector<char *> lines;
+
+} PFILE_TH_PARAM;
+
+// ----------------------------------------------------------------------------
+
+static void parseChunk(PFILE_TH_PARAM *p) {
+
+  char *s = p->start;
+
+  while (s < p->end) {
+
+    char *e = (char *)memchr(s, '\n', p->end - s);
+    char *next;
+    if (e == NULL) {
+      e = p->end;
+      next = p->end;
+    } else {
+      next = e + 1;
+    }
+
+    // Remove ending \r\n and spaces
+    while (e > s && isspace((unsigned char)e[-1]))
+      e--;
+
+    if (e > s) {
+      if (e < next) {
+        *e = 0;
+        p->lines.push_back(s);
+      } else {
+        // Last line without ending character, no room for the terminator
+        char *l = (char *)malloc(e - s + 1);
+        memcpy(l, s, e - s);
+        l[e - s] = 0;
+        p->lines.push_back(l);
+      }
+    }
+
+    s = next;
+
+  }
+
+}
+
+#ifdef WIN64
+static DWORD WINAPI _parseChunk(LPVOID lpParam) {
+#else
+static void *_parseChunk(void *lpParam) {
+#endif
+  parseChunk((PFILE_TH_PARAM *)lpParam);
+  return 0;
+}
+
+// ----------------------------------------------------------------------------
+
+void *PrefixFile::Map(string fileName, size_t *size, bool copyOnWrite, string &error) {
+
+  void *map = NULL;
+  *size = 0;
+
+#ifdef WIN64
+  HANDLE hFile = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (hFile == INVALID_HANDLE_VALUE) {
+    char tmp[32];
+    sprintf(tmp, " (error %d)", (int)GetLastError());
+    error = "Cannot open " + fileName + tmp;
+    return NULL;
+  }
+  LARGE_INTEGER fSize;
+  GetFileSizeEx(hFile, &fSize);
+  *size = (size_t)fSize.QuadPart;
+  if (*size > 0) {
+    HANDLE hMap = CreateFileMappingA(hFile, NULL, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL);
+    if (hMap != NULL) {
+      map = MapViewOfFile(hMap, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+      CloseHandle(hMap);
+    }
+  }
+  CloseHandle(hFile);
+#else
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    error = "Cannot open " + fileName + " " + strerror(errno);
+    return NULL;
+  }
+  struct stat st;
+  fstat(fd, &st);
+  *size = (size_t)st.st_size;
+  if (*size > 0) {
+    map = mmap(NULL, *size, copyOnWrite ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) map = NULL;
+  }
+  close(fd);
+#endif
+
+  if (*size > 0 && map == NULL) {
+    error = "Cannot map " + fileName;
+    *size = 0;
+  }
+
+  return map;
+
+}
+
+void PrefixFile::Unmap(void *map, size_t size) {
+
+  if (map == NULL)
+    return;
+#ifdef WIN64
+  UnmapViewOfFile(map);
+#else
+  munmap(map, size);
+#endif
+
+}
+
+// ----------------------------------------------------------------------------
+
+bool PrefixFile::Load(string fileName, vector<char *> &lines, void **fileMap, size_t *fileSize,
+                      string &error) {
+
+  size_t size;
+  char *map = (char *)Map(fileName, &size, true, error);
+  *fileMap = map;
+  *fileSize = size;
+
+  if (size == 0)
+    return error.length() == 0;
+
+#ifndef WIN64
+  madvise(map, size, MADV_SEQUENTIAL);
+#endif
+
+  int nbThread = Timer::getCoreNumber();
+  if ((size_t)nbThread > size / CHUNK_MIN) nbThread = (int)(size / CHUNK_MIN);
+  if (nbThread < 1) nbThread = 1;
+
+  // Chunks start at the beginning of a line
+  PFILE_TH_PARAM *params = new PFILE_TH_PARAM[nbThread];
+  char *mapEnd = map + size;
+  char *s = map;
+  for (int i = 0; i < nbThread; i++) {
+    params[i].start = s;
+    if (i == nbThread - 1) {
+      s = mapEnd;
+    } else {
+      s = map + (size * (i + 1)) / nbThread;
+      if (s < params[i].start) s = params[i].start;
+      char *e = (char *)memchr(s, '\n', mapEnd - s);
+      s = (e == NULL) ? mapEnd : e + 1;
+    }
+    params[i].end = s;
+  }
+
+  if (nbThread == 1) {
+    parseChunk(params);
+  } else {
+#ifdef WIN64
+    HANDLE *th = new HANDLE[nbThread];
+    for (int i = 0; i < nbThread; i++) {
+      DWORD thread_id;
+      th[i] = CreateThread(NULL, 0, _parseChunk, (void*)(params + i), 0, &thread_id);
+    }
+    WaitForMultipleObjects(nbThread, th, TRUE, INFINITE);
+    for (int i = 0; i < nbThread; i++)
+      CloseHandle(th[i]);
+#else
+    pthread_t *th = new pthread_t[nbThread];
+    for (int i = 0; i < nbThread; i++)
+      pthread_create(th + i, NULL, &_parseChunk, (void*)(params + i));
+    for (int i = 0; i < nbThread; i++)
+      pthread_join(th[i], NULL);
+#endif
+    delete[] th;
+  }
+
+  size_t nbLine = lines.size();
+  for (int i = 0; i < nbThread; i++)
+    nbLine += params[i].lines.size();
+  lines.reserve(nbLine);
+  for (int i = 0; i < nbThread; i++)
+    lines.insert(lines.end(), params[i].lines.begin(), params[i].lines.end());
+
+  delete[] params;
+  return true;
+
+}
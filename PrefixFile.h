@@ -0,0 +1,43 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PREFIXFILEH
+#define PREFIXFILEH
+
+#include <string>
+#include <vector>
+
+class PrefixFile {
+
+public:
+
+  // Map fileName (copy on write) and append its non empty lines to lines.
+  // Lines are parsed in place by several threads: trailing spaces are
+  // removed and each line is null terminated inside the mapping, which is
+  // returned in map/size (Unmap() it when the lines are no longer used).
+  // Returns false and sets error on failure.
+  static bool Load(std::string fileName, std::vector<char *> &lines, void **map, size_t *size,
+                   std::string &error);
+
+  // Map the whole file (read only or copy on write). Returns NULL for an
+  // empty file, or NULL with error set on failure.
+  static void *Map(std::string fileName, size_t *size, bool copyOnWrite, std::string &error);
+  static void Unmap(void *map, size_t size);
+
+};
+
+#endif // PREFIXFILEH
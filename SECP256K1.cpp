@@ -18,14 +18,50 @@
 #include "SECP256k1.h"
 #include "hash/sha256.h"
 #include "hash/ripemd160.h"
+#include "hash/hash160.h"
+#include "hash/chacha20.h"
+#include "hash/keccak.h"
 #include "Base58.h"
 #include "Bech32.h"
+#include "IntGroup.h"
 #include <string.h>
+#include <stdlib.h>
+#ifdef WIN64
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Generator table cache file
+#define GTABLE_MAGIC   0x54475356 // "VSGT"
+#define GTABLE_VERSION 1
+
+typedef struct {
+
+  uint32_t magic;
+  uint32_t version;
+  uint32_t wBits;
+  uint32_t pointSize;  // sizeof(Point)
+  uint64_t nbPoint;
+  uint64_t checksum;   // GTableChecksum() of the point array
+  uint8_t  pad[32];    // Keep points 64 bytes aligned
+
+} GTABLE_HEADER;
 
 Secp256K1::Secp256K1() {
+  GTable = NULL;
+  gWBits = 0;
+  gWSize = 0;
+  gNbWindow = 0;
+  gTableMap = NULL;
+  gTableMapSize = 0;
 }
 
-void Secp256K1::Init() {
+void Secp256K1::Init(int gTableBits, const char *gTableFile) {
 
   // Prime for the finite field
   Int P;
@@ -42,21 +78,212 @@ void Secp256K1::Init() {
 
   Int::InitK1(&order);
 
+  InitGTable(gTableBits, gTableFile);
+
+}
+
+Secp256K1::~Secp256K1() {
+  FreeGTable();
+}
+
+void Secp256K1::InitGTable(int wBits, const char *gTableFile) {
+
+  if (wBits < GTABLE_MIN_WBITS || wBits > GTABLE_MAX_WBITS) {
+    printf("Secp256K1: Invalid generator table window size %d, [%d..%d] expected\n",
+           wBits, GTABLE_MIN_WBITS, GTABLE_MAX_WBITS);
+    exit(-1);
+  }
+
+  // Signed window: digits are in [-2^(w-1)+1,2^(w-1)], the window above the
+  // last one holds the final carry
+  gWBits = wBits;
+  gWSize = 1 << (wBits - 1);
+  gNbWindow = 256 / wBits + 1;
+
+  FreeGTable();
+
+  if (gTableFile != NULL && gTableFile[0] != 0) {
+    if (LoadGTable(gTableFile))
+      return;
+    ComputeGTable();
+    SaveGTable(gTableFile);
+  } else {
+    ComputeGTable();
+  }
+
+}
+
+void Secp256K1::ComputeGTable() {
+
+  GTable = (Point *)malloc((size_t)gNbWindow * gWSize * sizeof(Point));
+  if (GTable == NULL) {
+    printf("Secp256K1: Cannot allocate generator table (%d bits)\n", gWBits);
+    exit(-1);
+  }
+
   // Compute Generator table
-  Point N(G);
-  for(int i = 0; i < 32; i++) {
-    GTable[i * 256] = N;
-    N = DoubleDirect(N);
-    for (int j = 1; j < 255; j++) {
-      GTable[i * 256 + j] = N;
-      N = AddDirect(N, GTable[i * 256]);
+  // Points of a window are computed in Jacobian coordinates using the
+  // affine base B of the window. The base of the next window (2^w*B) is
+  // temporarily stored in W[0] so that the whole window is normalized
+  // with a single ModInv
+  Point B(G);
+  for (int i = 0; i < gNbWindow; i++) {
+    Point *W = GTable + (size_t)i * gWSize;
+    W[1] = DoubleJacobian(B);
+    for (int j = 2; j < gWSize; j++)
+      W[j] = AddJacobianMixed(W[j - 1], B);
+    W[0] = DoubleJacobian(W[gWSize - 1]);
+    BatchNormalize(W, gWSize);
+    Point next(W[0]);
+    W[0] = B;
+    B = next;
+  }
+
+}
+
+void Secp256K1::FreeGTable() {
+
+  if (gTableMap) {
+#ifdef WIN64
+    UnmapViewOfFile(gTableMap);
+#else
+    munmap(gTableMap, gTableMapSize);
+#endif
+    gTableMap = NULL;
+    gTableMapSize = 0;
+  } else {
+    free(GTable);
+  }
+  GTable = NULL;
+
+}
+
+// Fast 64bit checksum (detects corrupted or truncated files, not tampering)
+static uint64_t GTableChecksum(const uint64_t *d, size_t n) {
+
+  uint64_t h[4] = { 0x9E3779B97F4A7C15ULL,0xC2B2AE3D27D4EB4FULL,
+                    0x165667B19E3779F9ULL,0x27D4EB2F165667C5ULL };
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    for (int j = 0; j < 4; j++) {
+      h[j] = (h[j] ^ d[i + j]) * 0x9FB21C651E98DF25ULL;
+      h[j] = (h[j] << 31) | (h[j] >> 33);
     }
-    GTable[i * 256 + 255] = N; // Dummy point for check function
   }
+  for (; i < n; i++) {
+    h[0] = (h[0] ^ d[i]) * 0x9FB21C651E98DF25ULL;
+    h[0] = (h[0] << 31) | (h[0] >> 33);
+  }
+
+  return h[0] ^ ((h[1] << 17) | (h[1] >> 47)) ^
+         ((h[2] << 29) | (h[2] >> 35)) ^ ((h[3] << 43) | (h[3] >> 21)) ^ (uint64_t)n;
 
 }
 
-Secp256K1::~Secp256K1() {
+// Map the generator table from a cache file, return false if the file
+// does not exist or does not match the current settings
+bool Secp256K1::LoadGTable(const char *fileName) {
+
+  size_t nbPoint = (size_t)gNbWindow * gWSize;
+  size_t size = sizeof(GTABLE_HEADER) + nbPoint * sizeof(Point);
+  void *map = NULL;
+
+#ifdef WIN64
+  HANDLE hFile = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (hFile == INVALID_HANDLE_VALUE)
+    return false;
+  LARGE_INTEGER fSize;
+  if (!GetFileSizeEx(hFile, &fSize) || (size_t)fSize.QuadPart != size) {
+    printf("Warning: %s invalid generator table size, recomputing\n", fileName);
+    CloseHandle(hFile);
+    return false;
+  }
+  HANDLE hMap = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (hMap != NULL) {
+    map = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(hMap);
+  }
+  CloseHandle(hFile);
+#else
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size != size) {
+    printf("Warning: %s invalid generator table size, recomputing\n", fileName);
+    close(fd);
+    return false;
+  }
+  map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (map == MAP_FAILED) map = NULL;
+  close(fd);
+#endif
+
+  if (map == NULL) {
+    printf("Warning: Cannot map %s, recomputing generator table\n", fileName);
+    return false;
+  }
+
+  gTableMap = map;
+  gTableMapSize = size;
+  GTable = (Point *)((uint8_t *)map + sizeof(GTABLE_HEADER));
+
+  GTABLE_HEADER *h = (GTABLE_HEADER *)map;
+  bool ok = h->magic == GTABLE_MAGIC && h->version == GTABLE_VERSION &&
+            h->wBits == (uint32_t)gWBits && h->pointSize == sizeof(Point) &&
+            h->nbPoint == nbPoint &&
+            h->checksum == GTableChecksum((uint64_t *)GTable, nbPoint * sizeof(Point) / 8);
+
+  // Spot check: first point of each window must be on the curve
+  ok = ok && GTable[0].equals(G);
+  for (int i = 0; ok && i < gNbWindow; i++)
+    ok = EC(GTable[(size_t)i * gWSize]);
+
+  if (!ok) {
+    printf("Warning: %s invalid generator table, recomputing\n", fileName);
+    FreeGTable();
+    return false;
+  }
+
+  return true;
+
+}
+
+void Secp256K1::SaveGTable(const char *fileName) {
+
+  size_t nbPoint = (size_t)gNbWindow * gWSize;
+  GTABLE_HEADER h;
+  memset(&h, 0, sizeof(h));
+  h.magic = GTABLE_MAGIC;
+  h.version = GTABLE_VERSION;
+  h.wBits = gWBits;
+  h.pointSize = sizeof(Point);
+  h.nbPoint = nbPoint;
+  h.checksum = GTableChecksum((uint64_t *)GTable, nbPoint * sizeof(Point) / 8);
+
+  // Write to a temporary file and rename it, concurrent processes may
+  // read the cache
+  std::string tmpName = std::string(fileName) + ".tmp";
+  FILE *f = fopen(tmpName.c_str(), "wb");
+  if (f == NULL) {
+    printf("Warning: Cannot open %s for writing\n", tmpName.c_str());
+    return;
+  }
+  bool ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+            fwrite(GTable, sizeof(Point), nbPoint, f) == nbPoint;
+  ok = (fclose(f) == 0) && ok;
+
+#ifdef WIN64
+  ok = ok && MoveFileExA(tmpName.c_str(), fileName, MOVEFILE_REPLACE_EXISTING);
+#else
+  ok = ok && rename(tmpName.c_str(), fileName) == 0;
+#endif
+
+  if (!ok) {
+    printf("Warning: Cannot write generator table to %s\n", fileName);
+    remove(tmpName.c_str());
+  }
+
 }
 
 void PrintResult(bool ok) {
@@ -84,12 +311,16 @@ void CheckAddress(Secp256K1 *T,std::string address,std::string privKeyStr) {
   case 'b':
   case 'B':
     type = BECH32; break;
+  case '0':
+    type = ETH; break;
   default:
     printf("Failed ! \n%s Address format not supported\n", address.c_str());
     return;
   }
 
   std::string calcAddress = T->GetAddress(type, isCompressed, pub);
+  if (type == ETH)
+    calcAddress = Secp256K1::GetEIP55Address(calcAddress);
 
   printf("Adress : %s ", address.c_str());
 
@@ -107,11 +338,12 @@ void Secp256K1::Check() {
   printf("Check Generator :");
 
   bool ok = true;
+  int gSize = gNbWindow * gWSize;
   int i = 0;
-  while(i < 256*32 && EC(GTable[i])) {
+  while(i < gSize && EC(GTable[i])) {
     i++;
   }
-  PrintResult(i == 256*32);
+  PrintResult(i == gSize);
 
   printf("Check Double :");
   Point Pt(G);
@@ -139,6 +371,101 @@ void Secp256K1::Check() {
 
   PrintResult(pub.equals(expectedPubKey));
 
+  printf("Check GenKeys :");
+  Int keys[64];
+  Point pubs[64];
+  keys[0].SetInt32(0);
+  for (int j = 1; j < 64; j++) {
+    keys[j].Set(&privKey);
+    keys[j].Add((uint64_t)j * 0x9E3779B97F4A7C15ULL);
+  }
+  ComputePublicKeys(64, keys, pubs, &expectedPubKey, 4);
+  for (i = 0; i < 64; i++) {
+    Point p = ComputePublicKey(keys + i);
+    p = p.isZero() ? expectedPubKey : AddDirect(p, expectedPubKey);
+    if (!p.equals(pubs[i])) break;
+  }
+  PrintResult(i == 64);
+
+  printf("Check Jacobian :");
+  R1 = DoubleJacobian(G);
+  R2 = AddJacobianMixed(R1, G);     // 3G
+  R3 = AddJacobian(R2, R1);         // 5G
+  R1 = AddJacobianMixed(R1, G);     // 3G
+  R1 = AddJacobian(R1, R1);         // 6G (doubling case)
+  Point R4 = AddJacobianMixed(R2, G); // 4G
+  Point R5 = G;
+  R5.y.ModNeg();
+  Pt = DoubleJacobian(G);
+  R5 = AddJacobianMixed(Pt, R5);    // 2G-G
+  Point pts[4] = { R3, R1, R4, R5 };
+  BatchNormalize(pts, 4);
+  Point p2 = DoubleDirect(G);
+  Point p4 = DoubleDirect(p2);
+  Point p5 = AddDirect(p4, G);
+  Point p6 = AddDirect(p5, G);
+  PrintResult(pts[0].equals(p5) && pts[1].equals(p6) && pts[2].equals(p4) && pts[3].equals(G));
+
+  // RFC 8439 2.3.2 (nonce 000000090000004a00000000, block counter 1)
+  printf("Check ChaCha20 :");
+  static const uint8_t chachaRef[64] = {
+    0x10,0xf1,0xe7,0xe4,0xd1,0x3b,0x59,0x15,0x50,0x0f,0xdd,0x1f,0xa3,0x20,0x71,0xc4,
+    0xc7,0xd1,0xf4,0xc7,0x33,0xc0,0x68,0x03,0x04,0x22,0xaa,0x9a,0xc3,0xd4,0x6c,0x4e,
+    0xd2,0x82,0x64,0x46,0x07,0x9f,0xaa,0x09,0x14,0xc2,0xd7,0x05,0xd9,0x8b,0x02,0xa2,
+    0xb5,0x12,0x9c,0xd1,0xde,0x16,0x4e,0xb9,0xcb,0xd0,0x83,0xe8,0xa2,0x50,0x3c,0x4e
+  };
+  uint8_t chachaKey[32];
+  uint8_t block[64];
+  uint8_t blocks[256];
+  for (int j = 0; j < 32; j++) chachaKey[j] = (uint8_t)j;
+  uint64_t counter = 1 | (0x09000000ULL << 32);
+  chacha20_block((uint32_t *)chachaKey, counter, 0x4a000000, block);
+  ok = (memcmp(block, chachaRef, 64) == 0);
+  chacha20sse_4B((uint32_t *)chachaKey, counter - 1, 0x4a000000, blocks);
+  ok = ok && (memcmp(blocks + 64, chachaRef, 64) == 0);
+  chacha20_block((uint32_t *)chachaKey, counter + 2, 0x4a000000, block);
+  ok = ok && (memcmp(blocks + 192, block, 64) == 0);
+  PrintResult(ok);
+
+  // Keccak-256("")
+  printf("Check Keccak :");
+  static const uint8_t keccakRef[32] = {
+    0xc5,0xd2,0x46,0x01,0x86,0xf7,0x23,0x3c,0x92,0x7e,0x7d,0xb2,0xdc,0xc7,0x03,0xc0,
+    0xe5,0x00,0xb6,0x53,0xca,0x82,0x27,0x3b,0x7b,0xfa,0xd8,0x04,0x5d,0x85,0xa4,0x70
+  };
+  uint8_t kh[32];
+  keccak256((const uint8_t *)"", 0, kh);
+  ok = (memcmp(kh, keccakRef, 32) == 0);
+  // SSE vs scalar
+  uint64_t kin[4][8];
+  uint8_t kh160[4][20];
+  for (int j = 0; j < 32; j++) ((uint8_t *)kin)[j] = (uint8_t)(j * 7 + 1);
+  for (int j = 32; j < 256; j++) ((uint8_t *)kin)[j] = (uint8_t)(((uint8_t *)kin)[j - 32] * 3 + j);
+  keccak160sse_64(kin[0], kin[1], kin[2], kin[3], kh160[0], kh160[1], kh160[2], kh160[3]);
+  for (int j = 0; j < 4; j++) {
+    keccak160_64(kin[j], kh);
+    ok = ok && (memcmp(kh, kh160[j], 20) == 0);
+  }
+  PrintResult(ok);
+
+  // Fused SSE hash160 vs scalar
+  printf("Check Hash160 :");
+  Point hp[4] = { G, p2, p4, p5 };
+  uint8_t hh[4][20];
+  uint8_t sh[4][20];
+  ok = true;
+  for (int c = 0; c < 2; c++) {
+    GetHash160(P2PKH, c == 0, hp[0], hp[1], hp[2], hp[3], hh[0], hh[1], hh[2], hh[3]);
+    GetScriptHash(hh[0], hh[1], hh[2], hh[3], sh[0], sh[1], sh[2], sh[3]);
+    for (int j = 0; j < 4; j++) {
+      GetHash160(P2PKH, c == 0, hp[j], kh);
+      ok = ok && (memcmp(kh, hh[j], 20) == 0);
+      GetScriptHash(hh[j], kh);
+      ok = ok && (memcmp(kh, sh[j], 20) == 0);
+    }
+  }
+  PrintResult(ok);
+
   CheckAddress(this,"15t3Nt1zyMETkHbjJTTshxLnqPzQvAtdCe","5HqoeNmaz17FwZRqn7kCBP1FyJKSe4tt42XZB7426EJ2MVWDeqk");
   CheckAddress(this,"1BoatSLRHtKNngkdXEeobR76b53LETtpyT","5J4XJRyLVgzbXEgh8VNi4qovLzxRftzMd8a18KkdXv4EqAwX3tS");
   CheckAddress(this,"1Test6BNjSJC5qwYXsjwKVLvz7DpfLehy","5HytzR8p5hp8Cfd8jsVFnwMNXMsEW1sssFxMQYqEUjGZN72iLJ2");
@@ -147,6 +474,7 @@ void Secp256K1::Check() {
   CheckAddress(this,"3CyQYcByvcWK8BkYJabBS82yDLNWt6rWSx","KxMUSkFhEzt2eJHscv2vNSTnnV2cgAXgL4WDQBTx7Ubd9TZmACAz");
   CheckAddress(this,"31to1KQe67YjoDfYnwFJThsGeQcFhVDM5Q","KxV2Tx5jeeqLHZ1V9ufNv1doTZBZuAc5eY24e6b27GTkDhYwVad7");
   CheckAddress(this,"bc1q6tqytpg06uhmtnhn9s4f35gkt8yya5a24dptmn","L2wAVD273GwAxGuEDHvrCqPfuWg5wWLZWy6H3hjsmhCvNVuCERAQ");
+  CheckAddress(this,"0x7E5F4552091A69125d5DfCb7b8C2659029395Bdf","KwDiBf89QgGbjEhKnhXJuH7LrciVrZi3qYjgd9M7rFU73sVHnoWn");
 
   // 1ViViGLEawN27xRzGrEhhYPQrZiTKvKLo
   pub.x.SetBase16(/*04*/"75249c39f38baa6bf20ab472191292349426dc3652382cdc45f65695946653dc");
@@ -169,33 +497,150 @@ void Secp256K1::Check() {
 }
 
 
-Point Secp256K1::ComputePublicKey(Int *privKey) {
+// Return the w bits window of k starting at bit pos
+static inline int GetWindow(Int *k, int pos, int w) {
+
+  int q = pos >> 6;
+  int r = pos & 63;
+  uint64_t v = k->bits64[q] >> r;
+  if (r + w > 64 && q < NB64BLOCK - 1)
+    v |= k->bits64[q + 1] << (64 - r);
+  return (int)(v & ((1ULL << w) - 1));
+
+}
+
+// Return k*G in Jacobian coordinates (not normalized)
+Point Secp256K1::MulG(Int *k) {
 
-  int i = 0;
-  uint8_t b;
   Point Q;
+  Point T;
   Q.Clear();
+  bool first = true;
+  int carry = 0;
 
-  // Search first significant byte
-  for (i = 0; i < 32; i++) {
-    b = privKey->GetByte(i);
-    if(b)
-      break;
-  }
-  Q = GTable[256 * i + (b-1)];
-  i++;
+  for (int i = 0; i < gNbWindow; i++) {
+
+    // Signed window recoding
+    int d = GetWindow(k, i * gWBits, gWBits) + carry;
+    if (d > gWSize) {
+      d -= 2 * gWSize;
+      carry = 1;
+    } else {
+      carry = 0;
+    }
+
+    if (d == 0)
+      continue;
+
+    T = GTable[i * gWSize + abs(d) - 1];
+    if (d < 0) T.y.ModNeg();
+    if (first) {
+      Q = T;
+      first = false;
+    } else {
+      Q = AddJacobianMixed(Q, T);
+    }
 
-  for(; i < 32; i++) {
-    b = privKey->GetByte(i);
-    if(b)
-      Q = Add2(Q, GTable[256 * i + (b-1)]);
   }
 
-  Q.Reduce();
   return Q;
 
 }
 
+// Return privKey*G (+ add if specified, add must be affine)
+Point Secp256K1::ComputePublicKey(Int *privKey, Point *add) {
+
+  Point Q = MulG(privKey);
+  if (add)
+    Q = AddJacobianMixed(Q, *add);
+  Normalize(Q);
+  return Q;
+
+}
+
+// ----------------------------------------------------------------------------
+
+typedef struct {
+
+  Secp256K1 *secp;
+  int nbKey;
+  Int *privKeys;
+  Point *pubKeys;
+  Point *add;
+
+} PK_PARAM;
+
+static void ComputePublicKeysST(PK_PARAM *p) {
+
+  for (int i = 0; i < p->nbKey; i++) {
+    p->pubKeys[i] = p->secp->MulG(p->privKeys + i);
+    if (p->add)
+      p->pubKeys[i] = p->secp->AddJacobianMixed(p->pubKeys[i], *p->add);
+  }
+  p->secp->BatchNormalize(p->pubKeys, p->nbKey);
+
+}
+
+#ifdef WIN64
+DWORD WINAPI _ComputePublicKeys(LPVOID lpParam) {
+#else
+void *_ComputePublicKeys(void *lpParam) {
+#endif
+  ComputePublicKeysST((PK_PARAM *)lpParam);
+  return 0;
+}
+
+// Compute pubKeys[i] = privKeys[i]*G (+ add if specified, add must be affine).
+// Keys are split across nbThread threads, each thread reduces its points
+// using a single ModInv.
+void Secp256K1::ComputePublicKeys(int nbKey, Int *privKeys, Point *pubKeys, Point *add, int nbThread) {
+
+  if (nbKey <= 0)
+    return;
+
+  if (nbThread > nbKey / 16) nbThread = nbKey / 16;
+  if (nbThread < 1) nbThread = 1;
+
+  PK_PARAM *params = (PK_PARAM *)malloc(nbThread * sizeof(PK_PARAM));
+  int chunk = nbKey / nbThread;
+  int pos = 0;
+  for (int i = 0; i < nbThread; i++) {
+    params[i].secp = this;
+    params[i].nbKey = (i == nbThread - 1) ? (nbKey - pos) : chunk;
+    params[i].privKeys = privKeys + pos;
+    params[i].pubKeys = pubKeys + pos;
+    params[i].add = add;
+    pos += chunk;
+  }
+
+  if (nbThread == 1) {
+    ComputePublicKeysST(params);
+    free(params);
+    return;
+  }
+
+#ifdef WIN64
+  HANDLE *th = (HANDLE *)malloc(nbThread * sizeof(HANDLE));
+  for (int i = 0; i < nbThread; i++) {
+    DWORD thread_id;
+    th[i] = CreateThread(NULL, 0, _ComputePublicKeys, (void*)(params + i), 0, &thread_id);
+  }
+  WaitForMultipleObjects(nbThread, th, TRUE, INFINITE);
+  for (int i = 0; i < nbThread; i++)
+    CloseHandle(th[i]);
+#else
+  pthread_t *th = (pthread_t *)malloc(nbThread * sizeof(pthread_t));
+  for (int i = 0; i < nbThread; i++)
+    pthread_create(th + i, NULL, &_ComputePublicKeys, (void*)(params + i));
+  for (int i = 0; i < nbThread; i++)
+    pthread_join(th[i], NULL);
+#endif
+
+  free(th);
+  free(params);
+
+}
+
 Point Secp256K1::NextKey(Point &key) {
   // Input key must be reduced and different from G
   // in order to use AddDirect
@@ -273,6 +718,8 @@ Int Secp256K1::DecodePrivateKey(char *key,bool *compressed) {
 
 }
 
+// Big endian message words for hash160sse_xx(), the last one holds the 0x80
+// padding byte
 #define KEYBUFFCOMP(buff,p) \
 (buff)[0] = ((p).x.bits[7] >> 8) | ((uint32_t)(0x2 + (p).y.IsOdd()) << 24); \
 (buff)[1] = ((p).x.bits[6] >> 8) | ((p).x.bits[7] <<24); \
@@ -282,14 +729,7 @@ Int Secp256K1::DecodePrivateKey(char *key,bool *compressed) {
 (buff)[5] = ((p).x.bits[2] >> 8) | ((p).x.bits[3] <<24); \
 (buff)[6] = ((p).x.bits[1] >> 8) | ((p).x.bits[2] <<24); \
 (buff)[7] = ((p).x.bits[0] >> 8) | ((p).x.bits[1] <<24); \
-(buff)[8] = 0x00800000 | ((p).x.bits[0] <<24); \
-(buff)[9] = 0; \
-(buff)[10] = 0; \
-(buff)[11] = 0; \
-(buff)[12] = 0; \
-(buff)[13] = 0; \
-(buff)[14] = 0; \
-(buff)[15] = 0x108;
+(buff)[8] = 0x00800000 | ((p).x.bits[0] <<24);
 
 #define KEYBUFFUNCOMP(buff,p) \
 (buff)[0] = ((p).x.bits[7] >> 8) | 0x04000000; \
@@ -308,22 +748,18 @@ Int Secp256K1::DecodePrivateKey(char *key,bool *compressed) {
 (buff)[13] = ((p).y.bits[2] >> 8) | ((p).y.bits[3] <<24); \
 (buff)[14] = ((p).y.bits[1] >> 8) | ((p).y.bits[2] <<24); \
 (buff)[15] = ((p).y.bits[0] >> 8) | ((p).y.bits[1] <<24); \
-(buff)[16] = 0x00800000 | ((p).y.bits[0] <<24); \
-(buff)[17] = 0; \
-(buff)[18] = 0; \
-(buff)[19] = 0; \
-(buff)[20] = 0; \
-(buff)[21] = 0; \
-(buff)[22] = 0; \
-(buff)[23] = 0; \
-(buff)[24] = 0; \
-(buff)[25] = 0; \
-(buff)[26] = 0; \
-(buff)[27] = 0; \
-(buff)[28] = 0; \
-(buff)[29] = 0; \
-(buff)[30] = 0; \
-(buff)[31] = 0x208;
+(buff)[16] = 0x00800000 | ((p).y.bits[0] <<24);
+
+// x||y, 8 little endian words (Keccak lanes)
+#define KEYBUFFETH(buff,p) \
+(buff)[0] = _byteswap_uint64((p).x.bits64[3]); \
+(buff)[1] = _byteswap_uint64((p).x.bits64[2]); \
+(buff)[2] = _byteswap_uint64((p).x.bits64[1]); \
+(buff)[3] = _byteswap_uint64((p).x.bits64[0]); \
+(buff)[4] = _byteswap_uint64((p).y.bits64[3]); \
+(buff)[5] = _byteswap_uint64((p).y.bits64[2]); \
+(buff)[6] = _byteswap_uint64((p).y.bits64[1]); \
+(buff)[7] = _byteswap_uint64((p).y.bits64[0]);
 
 #define KEYBUFFSCRIPT(buff,h) \
 (buff)[0] = 0x00140000 | (uint32_t)h[0] << 8 | (uint32_t)h[1]; \
@@ -331,34 +767,13 @@ Int Secp256K1::DecodePrivateKey(char *key,bool *compressed) {
 (buff)[2] = (uint32_t)h[6] << 24 | (uint32_t)h[7] << 16 | (uint32_t)h[8] << 8 | (uint32_t)h[9];\
 (buff)[3] = (uint32_t)h[10] << 24 | (uint32_t)h[11] << 16 | (uint32_t)h[12] << 8 | (uint32_t)h[13];\
 (buff)[4] = (uint32_t)h[14] << 24 | (uint32_t)h[15] << 16 | (uint32_t)h[16] << 8 | (uint32_t)h[17];\
-(buff)[5] = (uint32_t)h[18] << 24 | (uint32_t)h[19] << 16 | 0x8000; \
-(buff)[6] = 0; \
-(buff)[7] = 0; \
-(buff)[8] = 0; \
-(buff)[9] = 0; \
-(buff)[10] = 0; \
-(buff)[11] = 0; \
-(buff)[12] = 0; \
-(buff)[13] = 0; \
-(buff)[14] = 0; \
-(buff)[15] = 0xB0;
+(buff)[5] = (uint32_t)h[18] << 24 | (uint32_t)h[19] << 16 | 0x8000;
 
-void Secp256K1::GetHash160(int type,bool compressed,
-  Point &k0,Point &k1,Point &k2,Point &k3,
+// Type and compression are template parameters (no switch in the search loop)
+template<int type, bool compressed>
+void Secp256K1::GetHash160(PointK1 &k0,PointK1 &k1,PointK1 &k2,PointK1 &k3,
   uint8_t *h0,uint8_t *h1,uint8_t *h2,uint8_t *h3) {
 
-#ifdef WIN64
-  __declspec(align(16)) unsigned char sh0[64];
-  __declspec(align(16)) unsigned char sh1[64];
-  __declspec(align(16)) unsigned char sh2[64];
-  __declspec(align(16)) unsigned char sh3[64];
-#else
-  unsigned char sh0[64] __attribute__((aligned(16)));
-  unsigned char sh1[64] __attribute__((aligned(16)));
-  unsigned char sh2[64] __attribute__((aligned(16)));
-  unsigned char sh3[64] __attribute__((aligned(16)));
-#endif
-
   switch (type) {
 
   case P2PKH:
@@ -367,33 +782,31 @@ void Secp256K1::GetHash160(int type,bool compressed,
 
     if (!compressed) {
 
-      uint32_t b0[32];
-      uint32_t b1[32];
-      uint32_t b2[32];
-      uint32_t b3[32];
+      uint32_t b0[17];
+      uint32_t b1[17];
+      uint32_t b2[17];
+      uint32_t b3[17];
 
       KEYBUFFUNCOMP(b0, k0);
       KEYBUFFUNCOMP(b1, k1);
       KEYBUFFUNCOMP(b2, k2);
       KEYBUFFUNCOMP(b3, k3);
 
-      sha256sse_2B(b0, b1, b2, b3, sh0, sh1, sh2, sh3);
-      ripemd160sse_32(sh0, sh1, sh2, sh3, h0, h1, h2, h3);
+      hash160sse_65(b0, b1, b2, b3, h0, h1, h2, h3);
 
     } else {
 
-      uint32_t b0[16];
-      uint32_t b1[16];
-      uint32_t b2[16];
-      uint32_t b3[16];
+      uint32_t b0[9];
+      uint32_t b1[9];
+      uint32_t b2[9];
+      uint32_t b3[9];
 
       KEYBUFFCOMP(b0, k0);
       KEYBUFFCOMP(b1, k1);
       KEYBUFFCOMP(b2, k2);
       KEYBUFFCOMP(b3, k3);
 
-      sha256sse_1B(b0, b1, b2, b3, sh0, sh1, sh2, sh3);
-      ripemd160sse_32(sh0, sh1, sh2, sh3, h0, h1, h2, h3);
+      hash160sse_33(b0, b1, b2, b3, h0, h1, h2, h3);
 
     }
 
@@ -408,21 +821,27 @@ void Secp256K1::GetHash160(int type,bool compressed,
     unsigned char kh2[20];
     unsigned char kh3[20];
 
-    GetHash160(P2PKH,compressed,k0,k1,k2,k3,kh0,kh1,kh2,kh3);
+    GetHash160<P2PKH, compressed>(k0,k1,k2,k3,kh0,kh1,kh2,kh3);
+    GetScriptHash(kh0,kh1,kh2,kh3,h0,h1,h2,h3);
+
+  }
+  break;
+
+  case ETH:
+  {
 
-    // Redeem Script (1 to 1 P2SH)
-    uint32_t b0[16];
-    uint32_t b1[16];
-    uint32_t b2[16];
-    uint32_t b3[16];
+    // Always the full public key (without 04)
+    uint64_t b0[8];
+    uint64_t b1[8];
+    uint64_t b2[8];
+    uint64_t b3[8];
 
-    KEYBUFFSCRIPT(b0, kh0);
-    KEYBUFFSCRIPT(b1, kh1);
-    KEYBUFFSCRIPT(b2, kh2);
-    KEYBUFFSCRIPT(b3, kh3);
+    KEYBUFFETH(b0, k0);
+    KEYBUFFETH(b1, k1);
+    KEYBUFFETH(b2, k2);
+    KEYBUFFETH(b3, k3);
 
-    sha256sse_1B(b0, b1, b2, b3, sh0, sh1, sh2, sh3);
-    ripemd160sse_32(sh0, sh1, sh2, sh3, h0, h1, h2, h3);
+    keccak160sse_64(b0, b1, b2, b3, h0, h1, h2, h3);
 
   }
   break;
@@ -431,7 +850,53 @@ void Secp256K1::GetHash160(int type,bool compressed,
 
 }
 
-uint8_t Secp256K1::GetByte(std::string &str, int idx) {
+void Secp256K1::GetHash160(int type,bool compressed,
+  Point &k0,Point &k1,Point &k2,Point &k3,
+  uint8_t *h0,uint8_t *h1,uint8_t *h2,uint8_t *h3) {
+
+  PointK1 p0, p1, p2, p3;
+  p0.Set(k0);
+  p1.Set(k1);
+  p2.Set(k2);
+  p3.Set(k3);
+
+  switch (type) {
+  case P2PKH:
+  case BECH32:
+    if (compressed) GetHash160<P2PKH, true>(p0, p1, p2, p3, h0, h1, h2, h3);
+    else            GetHash160<P2PKH, false>(p0, p1, p2, p3, h0, h1, h2, h3);
+    break;
+  case P2SH:
+    if (compressed) GetHash160<P2SH, true>(p0, p1, p2, p3, h0, h1, h2, h3);
+    else            GetHash160<P2SH, false>(p0, p1, p2, p3, h0, h1, h2, h3);
+    break;
+  case ETH:
+    if (compressed) GetHash160<ETH, true>(p0, p1, p2, p3, h0, h1, h2, h3);
+    else            GetHash160<ETH, false>(p0, p1, p2, p3, h0, h1, h2, h3);
+    break;
+  }
+
+}
+
+void Secp256K1::GetScriptHash(uint8_t *kh0,uint8_t *kh1,uint8_t *kh2,uint8_t *kh3,
+  uint8_t *h0,uint8_t *h1,uint8_t *h2,uint8_t *h3) {
+
+  // Redeem Script (1 to 1 P2SH)
+  uint32_t b0[6];
+  uint32_t b1[6];
+  uint32_t b2[6];
+  uint32_t b3[6];
+
+  KEYBUFFSCRIPT(b0, kh0);
+  KEYBUFFSCRIPT(b1, kh1);
+  KEYBUFFSCRIPT(b2, kh2);
+  KEYBUFFSCRIPT(b3, kh3);
+
+  hash160sse_22(b0, b1, b2, b3, h0, h1, h2, h3);
+
+}
+
+bool Secp256K1::GetByte(std::string &str, int idx, uint8_t *b) {
 
   char tmp[3];
   int  val;
@@ -442,74 +907,82 @@ uint8_t Secp256K1::GetByte(std::string &str, int idx) {
 
   if (sscanf(tmp, "%X", &val) != 1) {
     printf("ParsePublicKeyHex: Error invalid public key specified (unexpected hexadecimal digit)\n");
-    exit(-1);
+    return false;
   }
 
-  return (uint8_t)val;
+  *b = (uint8_t)val;
+  return true;
 
 }
 
 Point Secp256K1::ParsePublicKeyHex(std::string str,bool &isCompressed) {
 
   Point ret;
+  if (!ParsePublicKeyHex(str, ret, isCompressed))
+    exit(-1);
+  return ret;
+
+}
+
+bool Secp256K1::ParsePublicKeyHex(std::string str, Point &ret, bool &isCompressed) {
+
+  uint8_t b;
   ret.Clear();
 
   if (str.length() < 2) {
     printf("ParsePublicKeyHex: Error invalid public key specified (66 or 130 character length)\n");
-    exit(-1);
+    return false;
   }
 
-  uint8_t type = GetByte(str, 0);
+  uint8_t type;
+  if (!GetByte(str, 0, &type))
+    return false;
 
   switch (type) {
 
     case 0x02:
-      if (str.length() != 66) {
-        printf("ParsePublicKeyHex: Error invalid public key specified (66 character length)\n");
-        exit(-1);
-      }
-      for (int i = 0; i < 32; i++)
-        ret.x.SetByte(31 - i, GetByte(str, i + 1));
-      ret.y = GetY(ret.x, true);
-      isCompressed = true;
-      break;
-
     case 0x03:
       if (str.length() != 66) {
         printf("ParsePublicKeyHex: Error invalid public key specified (66 character length)\n");
-        exit(-1);
+        return false;
       }
-      for (int i = 0; i < 32; i++)
-        ret.x.SetByte(31 - i, GetByte(str, i + 1));
-      ret.y = GetY(ret.x, false);
+      for (int i = 0; i < 32; i++) {
+        if (!GetByte(str, i + 1, &b)) return false;
+        ret.x.SetByte(31 - i, b);
+      }
+      ret.y = GetY(ret.x, type == 0x02);
       isCompressed = true;
       break;
 
     case 0x04:
       if (str.length() != 130) {
         printf("ParsePublicKeyHex: Error invalid public key specified (130 character length)\n");
-        exit(-1);
+        return false;
+      }
+      for (int i = 0; i < 32; i++) {
+        if (!GetByte(str, i + 1, &b)) return false;
+        ret.x.SetByte(31 - i, b);
+      }
+      for (int i = 0; i < 32; i++) {
+        if (!GetByte(str, i + 33, &b)) return false;
+        ret.y.SetByte(31 - i, b);
       }
-      for (int i = 0; i < 32; i++)
-        ret.x.SetByte(31 - i, GetByte(str, i + 1));
-      for (int i = 0; i < 32; i++)
-        ret.y.SetByte(31 - i, GetByte(str, i + 33));
       isCompressed = false;
       break;
 
     default:
       printf("ParsePublicKeyHex: Error invalid public key specified (Unexpected prefix (only 02,03 or 04 allowed)\n");
-      exit(-1);
+      return false;
   }
 
   ret.z.SetInt32(1);
 
   if (!EC(ret)) {
     printf("ParsePublicKeyHex: Error invalid public key specified (Not lie on elliptic curve)\n");
-    exit(-1);
+    return false;
   }
 
-  return ret;
+  return true;
 
 }
 
@@ -548,7 +1021,8 @@ std::string Secp256K1::GetPublicKeyHex(bool compressed, Point &pubKey) {
 
 }
 
-void Secp256K1::GetHash160(int type, bool compressed, Point &pubKey, unsigned char *hash) {
+template<int type, bool compressed>
+void Secp256K1::GetHash160(PointK1 &pubKey, unsigned char *hash) {
 
   unsigned char shapk[64];
 
@@ -583,16 +1057,18 @@ void Secp256K1::GetHash160(int type, bool compressed, Point &pubKey, unsigned ch
   case P2SH:
   {
 
-    // Redeem Script (1 to 1 P2SH)
-    unsigned char script[64];
+    unsigned char kh[20];
+    GetHash160<P2PKH, compressed>(pubKey, kh);
+    GetScriptHash(kh, hash);
 
-    script[0] = 0x00;  // OP_0
-    script[1] = 0x14;  // PUSH 20 bytes
-    GetHash160(P2PKH, compressed, pubKey, script + 2);
-
-    sha256(script, 22, shapk);
-    ripemd160_32(shapk, hash);
+  }
+  break;
 
+  case ETH:
+  {
+    uint64_t b[8];
+    KEYBUFFETH(b, pubKey);
+    keccak160_64(b, hash);
   }
   break;
 
@@ -600,6 +1076,56 @@ void Secp256K1::GetHash160(int type, bool compressed, Point &pubKey, unsigned ch
 
 }
 
+void Secp256K1::GetHash160(int type, bool compressed, Point &pubKey, unsigned char *hash) {
+
+  PointK1 p;
+  p.Set(pubKey);
+
+  switch (type) {
+  case P2PKH:
+  case BECH32:
+    if (compressed) GetHash160<P2PKH, true>(p, hash);
+    else            GetHash160<P2PKH, false>(p, hash);
+    break;
+  case P2SH:
+    if (compressed) GetHash160<P2SH, true>(p, hash);
+    else            GetHash160<P2SH, false>(p, hash);
+    break;
+  case ETH:
+    if (compressed) GetHash160<ETH, true>(p, hash);
+    else            GetHash160<ETH, false>(p, hash);
+    break;
+  }
+
+}
+
+// Instances used by the search kernels
+#define HASH160_INSTANCE(type,compressed) \
+template void Secp256K1::GetHash160<type, compressed>(PointK1 &, PointK1 &, PointK1 &, PointK1 &, uint8_t *, uint8_t *, uint8_t *, uint8_t *); \
+template void Secp256K1::GetHash160<type, compressed>(PointK1 &, unsigned char *);
+
+HASH160_INSTANCE(P2PKH, true)
+HASH160_INSTANCE(P2PKH, false)
+HASH160_INSTANCE(P2SH, true)
+HASH160_INSTANCE(P2SH, false)
+HASH160_INSTANCE(ETH, true)
+HASH160_INSTANCE(ETH, false)
+
+void Secp256K1::GetScriptHash(uint8_t *kh, uint8_t *hash) {
+
+  // Redeem Script (1 to 1 P2SH)
+  unsigned char script[64];
+  unsigned char shapk[64];
+
+  script[0] = 0x00;  // OP_0
+  script[1] = 0x14;  // PUSH 20 bytes
+  memcpy(script + 2, kh, 20);
+
+  sha256(script, 22, shapk);
+  ripemd160_32(shapk, hash);
+
+}
+
 std::string Secp256K1::GetPrivAddress(bool compressed,Int &privKey) {
 
   unsigned char address[38];
@@ -642,6 +1168,39 @@ std::string Secp256K1::GetPrivAddress(bool compressed,Int &privKey) {
 (buff)[14] = 0; \
 (buff)[15] = 0xA8;
 
+static std::string ethAddress(unsigned char *hash) {
+
+  static const char *digits = "0123456789abcdef";
+  char addr[43];
+  addr[0] = '0';
+  addr[1] = 'x';
+  for (int i = 0; i < 20; i++) {
+    addr[2 + 2 * i] = digits[hash[i] >> 4];
+    addr[3 + 2 * i] = digits[hash[i] & 0xF];
+  }
+  addr[42] = 0;
+  return std::string(addr);
+
+}
+
+std::string Secp256K1::GetEIP55Address(std::string address) {
+
+  // Letters are upper case when the corresponding nibble of
+  // Keccak-256(lower case hex address) is >= 8
+  uint8_t h[32];
+  std::string hex = address.substr(2);
+  for (int i = 0; i < (int)hex.length(); i++)
+    hex[i] = (char)tolower(hex[i]);
+  keccak256((uint8_t *)hex.c_str(), hex.length(), h);
+  for (int i = 0; i < (int)hex.length(); i++) {
+    int n = (i & 1) ? (h[i / 2] & 0xF) : (h[i / 2] >> 4);
+    if (hex[i] >= 'a' && n >= 8)
+      hex[i] = (char)toupper(hex[i]);
+  }
+  return "0x" + hex;
+
+}
+
 std::vector<std::string> Secp256K1::GetAddress(int type, bool compressed, unsigned char *h1, unsigned char *h2, unsigned char *h3, unsigned char *h4) {
 
   std::vector<std::string> ret;
@@ -685,6 +1244,13 @@ std::vector<std::string> Secp256K1::GetAddress(int type, bool compressed, unsign
     return ret;
   }
   break;
+
+  case ETH:
+    ret.push_back(ethAddress(h1));
+    ret.push_back(ethAddress(h2));
+    ret.push_back(ethAddress(h3));
+    ret.push_back(ethAddress(h4));
+    return ret;
   }
 
   memcpy(add1 + 1, h1, 20);
@@ -727,6 +1293,9 @@ std::string Secp256K1::GetAddress(int type, bool compressed,unsigned char *hash1
       return std::string(output);
     }
     break;
+
+    case ETH:
+      return ethAddress(hash160);
   }
   memcpy(address + 1, hash160,20);
   sha256_checksum(address,21,address+21);
@@ -765,6 +1334,13 @@ std::string Secp256K1::GetAddress(int type, bool compressed, Point &pubKey) {
     }
     address[0] = 0x05;
     break;
+
+  case ETH:
+  {
+    uint8_t h160[20];
+    GetHash160(type, compressed, pubKey, h160);
+    return ethAddress(h160);
+  }
   }
 
   GetHash160(type,compressed,pubKey, address + 1);
@@ -1032,6 +1608,251 @@ Point Secp256K1::Double(Point &p) {
   return r;
 }
 
+// ----------------------------------------------------------------------------
+// Jacobian coordinates: (X,Y,Z) represents the affine point (X/Z^2,Y/Z^3)
+// Z = 0 is the point at infinity
+
+Point Secp256K1::DoubleJacobian(Point &p) {
+
+  /*
+    A = X1^2, B = Y1^2, C = B^2
+    D = 2*((X1+B)^2-A-C)
+    E = 3*A, F = E^2
+    X3 = F-2*D
+    Y3 = E*(D-X3)-8*C
+    Z3 = 2*Y1*Z1
+  */
+
+  Int a;
+  Int b;
+  Int c;
+  Int d;
+  Int e;
+  Point r;
+
+  if (p.z.IsZero() || p.y.IsZero()) {
+    r.Clear();
+    return r;
+  }
+
+  a.ModSquareK1(&p.x);
+  b.ModSquareK1(&p.y);
+  c.ModSquareK1(&b);
+  d.ModAdd(&p.x, &b);
+  d.ModSquareK1(&d);
+  d.ModSub(&a);
+  d.ModSub(&c);
+  d.ModDouble();
+  e.ModAdd(&a, &a);
+  e.ModAdd(&a);
+
+  r.x.ModSquareK1(&e);
+  r.x.ModSub(&d);
+  r.x.ModSub(&d);
+
+  c.ModDouble();
+  c.ModDouble();
+  c.ModDouble();
+  r.y.ModSub(&d, &r.x);
+  r.y.ModMulK1(&e);
+  r.y.ModSub(&c);
+
+  r.z.ModMulK1(&p.y, &p.z);
+  r.z.ModDouble();
+
+  return r;
+
+}
+
+Point Secp256K1::AddJacobianMixed(Point &p1, Point &p2) {
+
+  // p2 is affine (p2.z = 1)
+  /*
+    Z1Z1 = Z1^2
+    U2 = X2*Z1Z1, S2 = Y2*Z1*Z1Z1
+    H = U2-X1, HH = H^2, I = 4*HH, J = H*I
+    r = 2*(S2-Y1), V = X1*I
+    X3 = r^2-J-2*V
+    Y3 = r*(V-X3)-2*Y1*J
+    Z3 = 2*Z1*H
+  */
+
+  Int z1z1;
+  Int u2;
+  Int s2;
+  Int h;
+  Int i;
+  Int j;
+  Int rr;
+  Int v;
+  Point r;
+
+  if (p1.z.IsZero())
+    return p2;
+
+  z1z1.ModSquareK1(&p1.z);
+  u2.ModMulK1(&p2.x, &z1z1);
+  s2.ModMulK1(&p2.y, &p1.z);
+  s2.ModMulK1(&z1z1);
+  h.ModSub(&u2, &p1.x);
+  rr.ModSub(&s2, &p1.y);
+
+  if (h.IsZero()) {
+    if (rr.IsZero())
+      return DoubleJacobian(p1);
+    r.Clear();
+    return r;
+  }
+
+  rr.ModDouble();
+  i.ModSquareK1(&h);
+  i.ModDouble();
+  i.ModDouble();
+  j.ModMulK1(&h, &i);
+  v.ModMulK1(&p1.x, &i);
+
+  r.x.ModSquareK1(&rr);
+  r.x.ModSub(&j);
+  r.x.ModSub(&v);
+  r.x.ModSub(&v);
+
+  j.ModMulK1(&p1.y);
+  j.ModDouble();
+  r.y.ModSub(&v, &r.x);
+  r.y.ModMulK1(&rr);
+  r.y.ModSub(&j);
+
+  r.z.ModMulK1(&p1.z, &h);
+  r.z.ModDouble();
+
+  return r;
+
+}
+
+Point Secp256K1::AddJacobian(Point &p1, Point &p2) {
+
+  /*
+    Z1Z1 = Z1^2, Z2Z2 = Z2^2
+    U1 = X1*Z2Z2, U2 = X2*Z1Z1
+    S1 = Y1*Z2*Z2Z2, S2 = Y2*Z1*Z1Z1
+    H = U2-U1, I = (2*H)^2, J = H*I
+    r = 2*(S2-S1), V = U1*I
+    X3 = r^2-J-2*V
+    Y3 = r*(V-X3)-2*S1*J
+    Z3 = 2*Z1*Z2*H
+  */
+
+  Int z1z1;
+  Int z2z2;
+  Int u1;
+  Int u2;
+  Int s1;
+  Int s2;
+  Int h;
+  Int i;
+  Int j;
+  Int rr;
+  Int v;
+  Point r;
+
+  if (p1.z.IsZero())
+    return p2;
+  if (p2.z.IsZero())
+    return p1;
+
+  z1z1.ModSquareK1(&p1.z);
+  z2z2.ModSquareK1(&p2.z);
+  u1.ModMulK1(&p1.x, &z2z2);
+  u2.ModMulK1(&p2.x, &z1z1);
+  s1.ModMulK1(&p1.y, &p2.z);
+  s1.ModMulK1(&z2z2);
+  s2.ModMulK1(&p2.y, &p1.z);
+  s2.ModMulK1(&z1z1);
+  h.ModSub(&u2, &u1);
+  rr.ModSub(&s2, &s1);
+
+  if (h.IsZero()) {
+    if (rr.IsZero())
+      return DoubleJacobian(p1);
+    r.Clear();
+    return r;
+  }
+
+  rr.ModDouble();
+  i.ModAdd(&h, &h);
+  i.ModSquareK1(&i);
+  j.ModMulK1(&h, &i);
+  v.ModMulK1(&u1, &i);
+
+  r.x.ModSquareK1(&rr);
+  r.x.ModSub(&j);
+  r.x.ModSub(&v);
+  r.x.ModSub(&v);
+
+  j.ModMulK1(&s1);
+  j.ModDouble();
+  r.y.ModSub(&v, &r.x);
+  r.y.ModMulK1(&rr);
+  r.y.ModSub(&j);
+
+  r.z.ModMulK1(&p1.z, &p2.z);
+  r.z.ModMulK1(&h);
+  r.z.ModDouble();
+
+  return r;
+
+}
+
+// Convert a set of Jacobian points to affine using a single ModInv
+// Points at infinity (z=0) are left unchanged
+void Secp256K1::BatchNormalize(Point *pts, int nbPoint) {
+
+  if (nbPoint <= 0)
+    return;
+
+  Int *zi = new Int[nbPoint];
+  for (int i = 0; i < nbPoint; i++) {
+    if (pts[i].z.IsZero())
+      zi[i].SetInt32(1);
+    else
+      zi[i].Set(&pts[i].z);
+  }
+
+  IntGroup grp(nbPoint);
+  grp.Set(zi);
+  grp.ModInv();
+
+  Int zi2;
+  for (int i = 0; i < nbPoint; i++) {
+    if (pts[i].z.IsZero())
+      continue;
+    zi2.ModSquareK1(&zi[i]);
+    pts[i].x.ModMulK1(&zi2);
+    pts[i].y.ModMulK1(&zi2);
+    pts[i].y.ModMulK1(&zi[i]);
+    pts[i].z.SetInt32(1);
+  }
+
+  delete[] zi;
+
+}
+
+void Secp256K1::Normalize(Point &p) {
+
+  if (p.z.IsZero())
+    return;
+
+  Int zi(&p.z);
+  Int zi2;
+  zi.ModInv();
+  zi2.ModSquareK1(&zi);
+  p.x.ModMulK1(&zi2);
+  p.y.ModMulK1(&zi2);
+  p.y.ModMulK1(&zi);
+  p.z.SetInt32(1);
+
+}
+
 Int Secp256K1::GetY(Int x,bool isEven) {
 
   Int _s;
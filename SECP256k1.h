@@ -19,6 +19,7 @@
 #define SECP256K1H
 
 #include "Point.h"
+#include "FieldK1.h"
 #include <string>
 #include <vector>
 
@@ -26,6 +27,13 @@
 #define P2PKH  0
 #define P2SH   1
 #define BECH32 2
+#define XONLY  3 // Bech32 of the x coordinate (e.g. npub), VanitySearch only
+#define ETH    4 // Last 20 bytes of Keccak-256(x||y), "0x" + hex
+
+// Generator table window size (bits)
+#define GTABLE_MIN_WBITS 4
+#define GTABLE_MAX_WBITS 16
+#define GTABLE_DEF_WBITS 12
 
 class Secp256K1 {
 
@@ -33,8 +41,11 @@ public:
 
   Secp256K1();
   ~Secp256K1();
-  void Init();
-  Point ComputePublicKey(Int *privKey);
+  void Init(int gTableBits = GTABLE_DEF_WBITS, const char *gTableFile = NULL);
+  void InitGTable(int wBits, const char *gTableFile = NULL);
+  Point ComputePublicKey(Int *privKey, Point *add = NULL);
+  void  ComputePublicKeys(int nbKey, Int *privKeys, Point *pubKeys, Point *add = NULL, int nbThread = 1);
+  Point MulG(Int *k);
   Point NextKey(Point &key);
   void Check();
   bool  EC(Point &p);
@@ -45,14 +56,29 @@ public:
 
   void GetHash160(int type,bool compressed, Point &pubKey, unsigned char *hash);
 
+  // Search kernels (type: P2PKH, P2SH or ETH)
+  template<int type, bool compressed>
+  void GetHash160(PointK1 &k0, PointK1 &k1, PointK1 &k2, PointK1 &k3,
+    uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3);
+  template<int type, bool compressed>
+  void GetHash160(PointK1 &pubKey, unsigned char *hash);
+
+  // P2SH hash of the 1 to 1 redeem script of a key hash160
+  void GetScriptHash(uint8_t *kh0, uint8_t *kh1, uint8_t *kh2, uint8_t *kh3,
+    uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3);
+
+  void GetScriptHash(uint8_t *kh, uint8_t *hash);
+
   std::string GetAddress(int type, bool compressed, Point &pubKey);
   std::string GetAddress(int type, bool compressed, unsigned char *hash160);
   std::vector<std::string> GetAddress(int type, bool compressed, unsigned char *h1, unsigned char *h2, unsigned char *h3, unsigned char *h4);
   std::string GetPrivAddress(bool compressed, Int &privKey );
   std::string GetPublicKeyHex(bool compressed, Point &p);
   Point ParsePublicKeyHex(std::string str, bool &isCompressed);
+  bool  ParsePublicKeyHex(std::string str, Point &p, bool &isCompressed);
 
   bool CheckPudAddress(std::string address);
+  static std::string GetEIP55Address(std::string address);
 
   static Int DecodePrivateKey(char *key,bool *compressed);
 
@@ -62,15 +88,35 @@ public:
   Point Double(Point &p);
   Point DoubleDirect(Point &p);
 
+  // Jacobian coordinates
+  Point AddJacobian(Point &p1, Point &p2);
+  Point AddJacobianMixed(Point &p1, Point &p2);
+  Point DoubleJacobian(Point &p);
+  void  Normalize(Point &p);
+  void  BatchNormalize(Point *pts, int nbPoint);
+
   Point G;                 // Generator
   Int   order;             // Curve order
 
 private:
 
-  uint8_t GetByte(std::string &str,int idx);
+  bool GetByte(std::string &str, int idx, uint8_t *b);
 
   Int GetY(Int x, bool isEven);
-  Point GTable[256*32];       // Generator table
+
+  void ComputeGTable();
+  bool LoadGTable(const char *fileName);
+  void SaveGTable(const char *fileName);
+  void FreeGTable();
+
+  // Generator table (signed window)
+  // GTable[i*gWSize + j] = (j+1)*2^(i*gWBits)*G
+  Point *GTable;
+  int   gWBits;       // Window size (bits)
+  int   gWSize;       // Number of point per window
+  int   gNbWindow;    // Number of window
+  void  *gTableMap;   // File mapping (when loaded from cache)
+  size_t gTableMapSize;
 
 };
 
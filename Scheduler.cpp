@@ -0,0 +1,265 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Scheduler.h"
+#include "Timer.h"
+#include <string.h>
+#include <stdlib.h>
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+
+#ifdef WIN64
+DWORD WINAPI _schedWorker(LPVOID lpParam) {
+#else
+void *_schedWorker(void *lpParam) {
+#endif
+  SCHED_TH_PARAM *p = (SCHED_TH_PARAM *)lpParam;
+  p->obj->Worker(p->threadId);
+  return 0;
+}
+
+Scheduler::Scheduler(int nbThread) {
+
+  // Thread ids index the search counters (GPU ids start at 0x80)
+  if (nbThread < 1) nbThread = 1;
+  if (nbThread > 0x80) nbThread = 0x80;
+  this->nbThread = nbThread;
+  nbJob = 0;
+  quit = false;
+  nbAlive = nbThread;
+
+#ifdef WIN64
+  ghMutex = CreateMutex(NULL, FALSE, NULL);
+#else
+  pthread_mutex_init(&ghMutex, NULL);
+#endif
+
+  params = (SCHED_TH_PARAM *)malloc(nbThread * sizeof(SCHED_TH_PARAM));
+  for (int i = 0; i < nbThread; i++) {
+    params[i].obj = this;
+    params[i].threadId = i;
+#ifdef WIN64
+    DWORD thread_id;
+    CloseHandle(CreateThread(NULL, 0, _schedWorker, (void*)(params+i), 0, &thread_id));
+#else
+    pthread_t thread_id;
+    pthread_create(&thread_id, NULL, &_schedWorker, (void*)(params+i));
+    pthread_detach(thread_id);
+#endif
+  }
+
+}
+
+Scheduler::~Scheduler() {
+
+  for (int i = 0; i < (int)jobs.size(); i++)
+    jobs[i]->search->Stop();
+  quit = true;
+  while (nbAlive > 0)
+    Timer::SleepMillis(1);
+
+  for (int i = 0; i < (int)jobs.size(); i++) {
+    delete[] jobs[i]->keys;
+    delete jobs[i];
+  }
+  free(params);
+
+#ifdef WIN64
+  CloseHandle(ghMutex);
+#else
+  pthread_mutex_destroy(&ghMutex);
+#endif
+
+}
+
+void Scheduler::lock() {
+#ifdef WIN64
+  WaitForSingleObject(ghMutex, INFINITE);
+#else
+  pthread_mutex_lock(&ghMutex);
+#endif
+}
+
+void Scheduler::unlock() {
+#ifdef WIN64
+  ReleaseMutex(ghMutex);
+#else
+  pthread_mutex_unlock(&ghMutex);
+#endif
+}
+
+int Scheduler::GetNbThread() {
+  return nbThread;
+}
+
+// ----------------------------------------------------------------------------
+
+int Scheduler::AddJob(VanitySearch *search, int priority, double weight) {
+
+  JOB *j = new JOB;
+  j->search = search;
+  j->priority = priority;
+  j->weight = (weight > 0.0) ? weight : 1.0;
+  j->nbRunning = 0;
+  j->removed = false;
+  j->lastRekey = 0;
+  j->rekeyId = 0;
+  j->keys = new JOB_KEY[nbThread];
+  for (int i = 0; i < nbThread; i++)
+    j->keys[i].started = false;
+
+  search->StartJob(nbThread);
+
+  lock();
+
+  // A new job starts at the current virtual time of its class so that
+  // it does not take all the threads until it has caught up
+  bool first = true;
+  j->pass = 0.0;
+  for (int i = 0; i < (int)jobs.size(); i++) {
+    if (jobs[i]->priority == priority && !jobs[i]->removed && (first || jobs[i]->pass < j->pass)) {
+      j->pass = jobs[i]->pass;
+      first = false;
+    }
+  }
+  j->id = nbJob++;
+  jobs.push_back(j);
+
+  unlock();
+
+  return j->id;
+
+}
+
+void Scheduler::RemoveJob(int jobId) {
+
+  JOB *j = NULL;
+
+  lock();
+  for (int i = 0; i < (int)jobs.size() && j == NULL; i++) {
+    if (jobs[i]->id == jobId) {
+      j = jobs[i];
+      j->removed = true;
+    }
+  }
+  unlock();
+
+  if (j == NULL)
+    return;
+
+  // Wait for the threads working on it to finish their slice
+  j->search->Stop();
+  while (true) {
+    lock();
+    int nbRunning = j->nbRunning;
+    if (nbRunning == 0) {
+      for (int i = 0; i < (int)jobs.size(); i++) {
+        if (jobs[i] == j) {
+          jobs.erase(jobs.begin() + i);
+          break;
+        }
+      }
+    }
+    unlock();
+    if (nbRunning == 0) break;
+    Timer::SleepMillis(1);
+  }
+
+  delete[] j->keys;
+  delete j;
+
+}
+
+// ----------------------------------------------------------------------------
+
+JOB *Scheduler::pick() {
+
+  // Highest priority, then lowest virtual time
+  JOB *best = NULL;
+  for (int i = 0; i < (int)jobs.size(); i++) {
+    JOB *j = jobs[i];
+    if (j->removed || j->search->IsEnded())
+      continue;
+    if (best == NULL || j->priority > best->priority ||
+        (j->priority == best->priority && j->pass < best->pass))
+      best = j;
+  }
+  return best;
+
+}
+
+void Scheduler::Worker(int thId) {
+
+  CPU_GROUP *g = new CPU_GROUP;
+  g->grp = new FieldGroup(CPU_GRP_STREAM * (CPU_GRP_SIZE / 2 + 1), CPU_GRP_STREAM);
+  g->grp->Set(g->dx);
+
+  while (!quit) {
+
+    lock();
+    JOB *j = pick();
+    int rekeyId = 0;
+    if (j != NULL) {
+      j->nbRunning++;
+      j->pass += 1.0 / j->weight;
+      rekeyId = j->rekeyId;
+    }
+    unlock();
+
+    if (j == NULL) {
+      Timer::SleepMillis(10);
+      continue;
+    }
+
+    // Each thread keeps its own key range in each job
+    JOB_KEY *k = j->keys + thId;
+    if (!k->started) {
+      j->search->InitKeyCPU(thId, k->key, k->startP);
+      k->started = true;
+      k->rekeyId = rekeyId;
+    } else if (k->rekeyId != rekeyId) {
+      j->search->RekeyCPU(thId, k->key, k->startP);
+      k->rekeyId = rekeyId;
+    }
+    for (int i = 0; i < SCHED_SLICE && !j->search->IsEnded(); i++)
+      j->search->SearchGroupCPU(thId, k->key, k->startP, g);
+
+    lock();
+    j->nbRunning--;
+    // Rekey request (see VanitySearch::Search())
+    uint64_t rekey = j->search->GetRekey();
+    if (rekey > 0) {
+      uint64_t count = j->search->GetCount();
+      if (count - j->lastRekey > 1000000 * rekey) {
+        j->lastRekey = count;
+        j->rekeyId++;
+      }
+    }
+    unlock();
+
+  }
+
+  delete g->grp;
+  delete g;
+
+  lock();
+  nbAlive--;
+  unlock();
+
+}
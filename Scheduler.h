@@ -0,0 +1,100 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SCHEDULERH
+#define SCHEDULERH
+
+#include <vector>
+#include "Vanity.h"
+#ifdef WIN64
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Number of groups searched by a thread before the next scheduling decision
+#define SCHED_SLICE 4
+
+class Scheduler;
+
+typedef struct {
+
+  Int key;
+  Point startP[CPU_GRP_STREAM];
+  bool started;
+  int rekeyId;          // JOB rekeyId of the current key
+
+} JOB_KEY;
+
+typedef struct {
+
+  int id;
+  VanitySearch *search;
+  int priority;         // Jobs with the highest priority run first
+  double weight;        // Share of the threads among jobs of the same priority
+  double pass;          // Virtual time: slices / weight
+  int nbRunning;        // Threads working on this job
+  bool removed;
+  JOB_KEY *keys;        // One key per thread
+  uint64_t lastRekey;   // Count at the last rekey
+  int rekeyId;          // Incremented every rekey Mkeys
+
+} JOB;
+
+typedef struct {
+
+  Scheduler *obj;
+  int threadId;
+
+} SCHED_TH_PARAM;
+
+// Run several searches on a CPU thread pool, weighted fair sharing
+// (stride scheduling) between jobs of the same priority
+class Scheduler {
+
+public:
+
+  Scheduler(int nbThread);
+  ~Scheduler();
+
+  int AddJob(VanitySearch *search, int priority, double weight);
+  void RemoveJob(int jobId);
+  int GetNbThread();
+  void Worker(int thId);
+
+private:
+
+  JOB *pick();
+  void lock();
+  void unlock();
+
+  int nbThread;
+  int nbJob;
+  std::vector<JOB *> jobs;
+  SCHED_TH_PARAM *params;
+  volatile bool quit;
+  volatile int nbAlive;
+
+#ifdef WIN64
+  HANDLE ghMutex;
+#else
+  pthread_mutex_t ghMutex;
+#endif
+
+};
+
+#endif // SCHEDULERH
@@ -0,0 +1,246 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Suffix.h"
+#include "SECP256k1.h"
+#include "Bech32.h"
+#include "hash/sha256.h"
+#include <algorithm>
+#include <string.h>
+#include <ctype.h>
+
+using namespace std;
+
+static const char *b58Digits = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+static const char *b32Digits = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+static const uint64_t pow58[SUFFIX_B58_DIGITS + 1] = { 1ULL, 58ULL, 3364ULL, 195112ULL, 11316496ULL, 656356768ULL };
+
+#define B58_MOD 656356768ULL // 58^5
+
+#define CHECKSUM(buff,A) \
+(buff)[0] = (uint32_t)A[0] << 24 | (uint32_t)A[1] << 16 | (uint32_t)A[2] << 8 | (uint32_t)A[3];\
+(buff)[1] = (uint32_t)A[4] << 24 | (uint32_t)A[5] << 16 | (uint32_t)A[6] << 8 | (uint32_t)A[7];\
+(buff)[2] = (uint32_t)A[8] << 24 | (uint32_t)A[9] << 16 | (uint32_t)A[10] << 8 | (uint32_t)A[11];\
+(buff)[3] = (uint32_t)A[12] << 24 | (uint32_t)A[13] << 16 | (uint32_t)A[14] << 8 | (uint32_t)A[15];\
+(buff)[4] = (uint32_t)A[16] << 24 | (uint32_t)A[17] << 16 | (uint32_t)A[18] << 8 | (uint32_t)A[19];\
+(buff)[5] = (uint32_t)A[20] << 24 | 0x800000;\
+(buff)[6] = 0; \
+(buff)[7] = 0; \
+(buff)[8] = 0; \
+(buff)[9] = 0; \
+(buff)[10] = 0; \
+(buff)[11] = 0; \
+(buff)[12] = 0; \
+(buff)[13] = 0; \
+(buff)[14] = 0; \
+(buff)[15] = 0xA8;
+
+// ----------------------------------------------------------------------------
+
+Suffix::Suffix() {
+  type = P2PKH;
+  bech32Chk = 1;
+}
+
+void Suffix::SetType(int type) {
+
+  this->type = type;
+
+  // hrp expansion of "bc" followed by the witness version 0
+  const char *hrp = "bc";
+  uint32_t chk = 1;
+  for (int i = 0; hrp[i]; i++)
+    chk = bech32_polymod_step(chk) ^ (hrp[i] >> 5);
+  chk = bech32_polymod_step(chk);
+  for (int i = 0; hrp[i]; i++)
+    chk = bech32_polymod_step(chk) ^ (hrp[i] & 0x1f);
+  bech32Chk = bech32_polymod_step(chk);
+
+}
+
+void Suffix::addTarget(int length, uint64_t v) {
+
+  vector<uint64_t> &t = targets[length];
+  vector<uint64_t>::iterator it = lower_bound(t.begin(), t.end(), v);
+  if (it != t.end() && *it == v)
+    return;
+  t.insert(it, v);
+  if (find(lengths.begin(), lengths.end(), length) == lengths.end())
+    lengths.push_back(length);
+
+}
+
+bool Suffix::Add(const char *pattern, bool caseSensitive) {
+
+  int len = (int)strlen(pattern);
+  int st = len;
+  while (st > 0 && pattern[st - 1] != '*' && pattern[st - 1] != '?')
+    st--;
+  if (st == len)
+    return false;
+
+  bool b32 = (type == BECH32);
+  int maxLength = b32 ? SUFFIX_B32_CHARS : SUFFIX_B58_DIGITS;
+  if (len - st > maxLength)
+    st = len - maxLength;
+  int n = len - st;
+
+  // Possible digits at each position (both cases for case unsensitive search)
+  vector<int> digits[SUFFIX_B32_CHARS];
+  for (int i = 0; i < n; i++) {
+    char c = pattern[st + i];
+    const char *p;
+    if (b32) {
+      p = strchr(b32Digits, tolower(c));
+      if (p) digits[i].push_back((int)(p - b32Digits));
+    } else {
+      char cc[2] = { c, caseSensitive ? c : (char)(isupper(c) ? tolower(c) : toupper(c)) };
+      for (int j = 0; j < 2; j++) {
+        p = strchr(b58Digits, cc[j]);
+        if (p && cc[j] && (j == 0 || cc[1] != cc[0]))
+          digits[i].push_back((int)(p - b58Digits));
+      }
+    }
+    // Not in the alphabet, the pattern cannot match
+    if (digits[i].size() == 0)
+      return true;
+  }
+
+  // Enumerate combinations
+  int idx[SUFFIX_B32_CHARS];
+  memset(idx, 0, sizeof(idx));
+  bool end = false;
+  while (!end) {
+
+    uint64_t v = 0;
+    for (int i = 0; i < n; i++)
+      v = b32 ? (v << 5) | (uint64_t)digits[i][idx[i]] : v * 58 + (uint64_t)digits[i][idx[i]];
+    addTarget(n, v);
+
+    int i = n - 1;
+    while (i >= 0 && ++idx[i] == (int)digits[i].size()) {
+      idx[i] = 0;
+      i--;
+    }
+    end = (i < 0);
+
+  }
+
+  return true;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint64_t Suffix::base58Value(uint8_t *payload) {
+
+  // 25 bytes payload mod 58^5, 32 bits at a time
+  uint64_t r = payload[0];
+  for (int i = 1; i < 25; i += 4) {
+    uint64_t w = (uint64_t)payload[i] << 24 | (uint64_t)payload[i + 1] << 16 |
+                 (uint64_t)payload[i + 2] << 8 | (uint64_t)payload[i + 3];
+    r = ((r << 32) | w) % B58_MOD;
+  }
+  return r;
+
+}
+
+uint64_t Suffix::bech32Value(uint8_t *h) {
+
+  // Checksum of the 32 5-bit groups
+  uint32_t chk = bech32Chk;
+  for (int i = 0; i < 20; i += 5) {
+    uint64_t b = (uint64_t)h[i] << 32 | (uint64_t)h[i + 1] << 24 | (uint64_t)h[i + 2] << 16 |
+                 (uint64_t)h[i + 3] << 8 | (uint64_t)h[i + 4];
+    for (int j = 35; j >= 0; j -= 5)
+      chk = bech32_polymod_step(chk) ^ (uint32_t)((b >> j) & 0x1F);
+  }
+  for (int i = 0; i < 6; i++)
+    chk = bech32_polymod_step(chk);
+  chk ^= 1;
+
+  // Last 6 data characters followed by the checksum
+  uint64_t low = ((uint64_t)h[16] << 24 | (uint64_t)h[17] << 16 | (uint64_t)h[18] << 8 | (uint64_t)h[19]) & 0x3FFFFFFF;
+  return (low << 30) | chk;
+
+}
+
+bool Suffix::matchValue(uint64_t v) {
+
+  for (int i = 0; i < (int)lengths.size(); i++) {
+    int k = lengths[i];
+    uint64_t r;
+    if (type == BECH32)
+      r = v & ((1ULL << (5 * k)) - 1);
+    else
+      r = (k == SUFFIX_B58_DIGITS) ? v : v % pow58[k];
+    if (binary_search(targets[k].begin(), targets[k].end(), r))
+      return true;
+  }
+  return false;
+
+}
+
+bool Suffix::Match(uint8_t *h) {
+
+  if (type == BECH32)
+    return matchValue(bech32Value(h));
+
+  uint8_t payload[25];
+  payload[0] = (type == P2SH) ? 0x05 : 0x00;
+  memcpy(payload + 1, h, 20);
+  sha256_checksum(payload, 21, payload + 21);
+  return matchValue(base58Value(payload));
+
+}
+
+void Suffix::Match(uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3, bool *m) {
+
+  if (type == BECH32) {
+    m[0] = matchValue(bech32Value(h0));
+    m[1] = matchValue(bech32Value(h1));
+    m[2] = matchValue(bech32Value(h2));
+    m[3] = matchValue(bech32Value(h3));
+    return;
+  }
+
+  uint8_t p0[25];
+  uint8_t p1[25];
+  uint8_t p2[25];
+  uint8_t p3[25];
+  uint32_t b0[16];
+  uint32_t b1[16];
+  uint32_t b2[16];
+  uint32_t b3[16];
+
+  p0[0] = p1[0] = p2[0] = p3[0] = (type == P2SH) ? 0x05 : 0x00;
+  memcpy(p0 + 1, h0, 20);
+  memcpy(p1 + 1, h1, 20);
+  memcpy(p2 + 1, h2, 20);
+  memcpy(p3 + 1, h3, 20);
+  CHECKSUM(b0, p0);
+  CHECKSUM(b1, p1);
+  CHECKSUM(b2, p2);
+  CHECKSUM(b3, p3);
+  sha256sse_checksum(b0, b1, b2, b3, p0 + 21, p1 + 21, p2 + 21, p3 + 21);
+
+  m[0] = matchValue(base58Value(p0));
+  m[1] = matchValue(base58Value(p1));
+  m[2] = matchValue(base58Value(p2));
+  m[3] = matchValue(base58Value(p3));
+
+}
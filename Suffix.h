@@ -0,0 +1,64 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SUFFIXH
+#define SUFFIXH
+
+#include <stdint.h>
+#include <vector>
+
+// Last characters compared as integers
+#define SUFFIX_B58_DIGITS 5   // payload mod 58^5 (< 2^32)
+#define SUFFIX_B32_CHARS  12  // 6 data + 6 checksum characters (60 bits)
+
+// Suffix filter for wildcard patterns ending with a literal (e.g. 1*Cafe).
+// The last digits of a base58 address are the payload (with checksum) modulo
+// 58^k, the last characters of a bech32 address are the low bits of the
+// hash160 followed by the polymod checksum: candidates are rejected without
+// encoding the address. Remaining ones must be checked with Wildcard::match().
+class Suffix {
+
+public:
+
+  Suffix();
+
+  // Address type (P2PKH, P2SH or BECH32), must be set before Add()
+  void SetType(int type);
+
+  // Add the literal tail of a pattern (characters after the last wildcard),
+  // returns false if the pattern does not end with a literal
+  bool Add(const char *pattern, bool caseSensitive);
+
+  // False if no pattern can match
+  bool Match(uint8_t *h);
+  void Match(uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3, bool *m);
+
+private:
+
+  bool matchValue(uint64_t v);
+  uint64_t base58Value(uint8_t *payload);
+  uint64_t bech32Value(uint8_t *h);
+  void addTarget(int length, uint64_t v);
+
+  int type;
+  uint32_t bech32Chk;  // Polymod state after the hrp and the witness version
+  std::vector<int> lengths;
+  std::vector<uint64_t> targets[SUFFIX_B32_CHARS + 1]; // Sorted, per length
+
+};
+
+#endif // SUFFIXH
@@ -62,11 +62,7 @@ double Timer::get_tick() {
 
 }
 
-std::string Timer::getSeed(int size) {
-
-  std::string ret;
-  char tmp[3];
-  unsigned char *buff = (unsigned char *)malloc(size);
+void Timer::getSeed(uint8_t *buff, int size) {
 
 #ifdef WIN64
 
@@ -123,6 +119,16 @@ std::string Timer::getSeed(int size) {
 
 #endif
 
+}
+
+std::string Timer::getSeed(int size) {
+
+  std::string ret;
+  char tmp[3];
+  unsigned char *buff = (unsigned char *)malloc(size);
+
+  getSeed(buff, size);
+
   for (int i = 0; i < size; i++) {
     sprintf(tmp,"%02X",buff[i]);
     ret.append(tmp);
@@ -164,8 +170,8 @@ int Timer::getCoreNumber() {
   GetSystemInfo(&sysinfo);
   return sysinfo.dwNumberOfProcessors;
 #else
-  // TODO
-  return 1;
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return (n > 0) ? (int)n : 1;
 #endif
 
 }
@@ -20,95 +20,816 @@
 #include "Bech32.h"
 #include "hash/sha256.h"
 #include "hash/sha512.h"
-#include "IntGroup.h"
+#include "FieldK1.h"
 #include "Wildcard.h"
 #include "Timer.h"
+#include "PrefixFile.h"
 #include "hash/ripemd160.h"
+#include "CPUGroup.h"
 #include <string.h>
+#include <errno.h>
+#include <stdarg.h>
 #include <math.h>
 #include <algorithm>
+#include <xmmintrin.h>
 #ifndef WIN64
 #include <pthread.h>
+#include <sys/mman.h>
 #endif
 
 using namespace std;
 
-Point Gn[CPU_GRP_SIZE / 2];
-Point _2Gn;
+#if CPU_GRP_SIZE != CPU_GRP_GEN_SIZE
+#error "CPUGroup.h does not match CPU_GRP_SIZE, use VanitySearch::GenerateCode()"
+#endif
+
+PointK1 Gn[CPU_GRP_SIZE / 2];
+PointK1 _SGn;
+
+// ----------------------------------------------------------------------------
+
+// Load Generator table G[n] = (n+1)*G (precomputed in CPUGroup.h)
+// Shared by all instances, called once by vs_init() before any search
+void VanitySearch::InitGenerator(Secp256K1 *secp) {
+
+  for (int i = 0; i < CPU_GRP_SIZE/2; i++) {
+    memcpy(Gn[i].x.bits64, cpuGx[i], 32);
+    memcpy(Gn[i].y.bits64, cpuGy[i], 32);
+  }
+  // _SGn = CPU_GRP_STREAM*CPU_GRP_SIZE*G (next center point of a stream)
+  Int sk((uint64_t)CPU_GRP_STREAM * CPU_GRP_SIZE);
+  Point sg = secp->ComputePublicKey(&sk);
+  _SGn.Set(sg);
+
+}
 
 // ----------------------------------------------------------------------------
 
-VanitySearch::VanitySearch(Secp256K1 *secp, vector<std::string> &inputPrefixes,string seed,int searchMode,
+VanitySearch::VanitySearch(Secp256K1 *secp, vector<char *> &inputPrefixes,string seed,int searchMode,
                            bool useGpu, bool stop, string outputFile, bool useSSE, uint32_t maxFound,
-                           uint64_t rekey, bool caseSensitive, Point &startPubKey, bool paranoiacSeed)
+                           uint64_t rekey, bool caseSensitive, Point &startPubKey, bool paranoiacSeed,
+                           string prefixDB, string hrp, bool quiet)
   :inputPrefixes(inputPrefixes) {
 
   this->secp = secp;
   this->searchMode = searchMode;
   this->useGpu = useGpu;
   this->stopWhenFound = stop;
+  this->quiet = quiet;
   this->outputFile = outputFile;
   this->useSSE = useSSE;
   this->nbGPUThread = 0;
   this->maxFound = maxFound;
   this->rekey = rekey;
   this->searchType = -1;
+  this->typeMask = 0;
   this->startPubKey = startPubKey;
   this->hasPattern = false;
+  this->suffixSearch = false;
+  this->groupKernel = NULL;
   this->caseSensitive = caseSensitive;
   this->startPubKeySpecified = !startPubKey.isZero();
+  this->hrp = hrp;
+  for (int i = 0; i < (int)this->hrp.length(); i++)
+    this->hrp[i] = (char)tolower(this->hrp[i]);
+
+  lastRekey = 0;
+  ready = false;
+  endOfSearch = false;
+  startTime = Timer::get_tick();
+  nbFoundKey = 0;
+  memset(counters, 0, sizeof(counters));
+  nbCPUThread = 0;
+  nbGPUThread = 0;
+  foundCallback = NULL;
+  foundUser = NULL;
+  gpuEngine = NULL;
+  patternFound = NULL;
+  rng = NULL;
+  prefixDBMap = NULL;
+  prefixDBSize = 0;
+  prefixEntries = NULL;
+  nbEntry = 0;
+  prefixData = NULL;
+  prefixDataSize = 0;
+  prefixFound = NULL;
+  entryDead = NULL;
+  nbInputLeft = 0;
+  nbPruned = 0;
+  prefixDifficulty = NULL;
+  nbInput = 0;
+  lookup16 = NULL;
+  lookup32 = NULL;
+  nbLookup32 = 0;
+
+  // Create a 65536 items lookup table
+  PREFIX_TABLE_ITEM t;
+  t.offset = 0;
+  t.count = 0;
+  t.live = 0;
+  prefixes.assign(65536, t);
+
+  // Check is inputPrefixes contains wildcard character
+  for (int i = 0; i < (int)inputPrefixes.size() && !hasPattern; i++) {
+    hasPattern = ((strchr(inputPrefixes[i], '*') != NULL) ||
+                   (strchr(inputPrefixes[i], '?') != NULL) );
+  }
+
+  if (prefixDB.length() > 0 && (hasPattern || inputPrefixes.size() > 0)) {
+    setError("A prefix database cannot be used with other prefixes");
+    return;
+  }
+
+  if (!hasPattern) {
+
+    // No wildcard used, standard search
+    if (prefixDB.length() > 0) {
+
+      if (!loadPrefixes(prefixDB))
+        return;
+
+    } else {
+
+      // The search type is given by the first prefix having a known type
+      for (int i = 0; i < (int)inputPrefixes.size() && searchType == -1; i++)
+        searchType = getPrefixType(inputPrefixes[i]);
+
+      if (!buildPrefixes())
+        return;
+
+    }
+
+    initFound();
+    if (error.length() > 0)
+      return;
+
+    //dumpPrefixes();
+
+    if (!caseSensitive && ((typeMask & (1 << BECH32)) || searchType == XONLY)) {
+      setError("Case unsensitive search with BECH32 not allowed");
+      return;
+    }
+
+    if (nbPrefix == 0) {
+      setError("Nothing to search");
+      return;
+    }
+
+    uint32_t unique_sPrefix = (uint32_t)usedPrefix.size();
+    uint32_t minI = 0xFFFFFFFF;
+    uint32_t maxI = 0;
+    for (int i = 0; i < (int)usedPrefix.size(); i++) {
+      uint32_t c = prefixes[usedPrefix[i]].count;
+      if (c > maxI) maxI = c;
+      if (c < minI) minI = c;
+    }
+
+    _difficulty = getDiffuclty();
+    string seachInfo = getSearchInfo();
+    if (nbPrefix == 1 && inputPrefixes.size() > 0) {
+      if (!caseSensitive) {
+        // Case unsensitive search
+        message("Difficulty: %.0f\n", _difficulty);
+        message("Search: %s [%s, Case unsensitive] (Lookup size %d)\n", inputPrefixes[0], seachInfo.c_str(), unique_sPrefix);
+      } else {
+        message("Difficulty: %.0f\n", _difficulty);
+        message("Search: %s [%s]\n", inputPrefixes[0], seachInfo.c_str());
+      }
+    } else {
+      if (onlyFull) {
+        message("Search: %d addresses (Lookup size %d,[%d,%d]) [%s]\n", nbPrefix, unique_sPrefix, minI, maxI, seachInfo.c_str());
+      } else {
+        message("Search: %d prefixes (Lookup size %d) [%s]\n", nbPrefix, unique_sPrefix, seachInfo.c_str());
+      }
+    }
+
+  } else {
+
+    // Wild card search
+    switch (inputPrefixes[0][0]) {
+
+    case '1':
+      searchType = P2PKH;
+      break;
+    case '3':
+      searchType = P2SH;
+      break;
+    case 'b':
+    case 'B':
+      searchType = BECH32;
+      break;
+
+    default:
+      searchType = getPrefixType(inputPrefixes[0]);
+      if (searchType == XONLY || searchType == ETH)
+        break;
+      setError("Invalid start character 1,3,b,0x or %s1, expected", this->hrp.c_str());
+      return;
+
+    }
+
+    string searchInfo = getSearchInfo();
+    if (inputPrefixes.size() == 1) {
+      message("Search: %s [%s]\n", inputPrefixes[0], searchInfo.c_str());
+    } else {
+      message("Search: %d patterns [%s]\n", (int)inputPrefixes.size(), searchInfo.c_str());
+    }
+
+    // Patterns ending with a literal: integer filter on the last characters
+    if (searchType <= BECH32) {
+      suffix.SetType(searchType);
+      suffixSearch = true;
+      for (int i = 0; i < (int)inputPrefixes.size() && suffixSearch; i++)
+        suffixSearch = suffix.Add(inputPrefixes[i], caseSensitive);
+    }
+
+    patternFound = (bool *)malloc(inputPrefixes.size()*sizeof(bool));
+    memset(patternFound,0, inputPrefixes.size() * sizeof(bool));
+    typeMask = 1 << searchType;
+
+  }
+
+  // Mixed P2PKH, P2SH and BECH32 search: the hash160 is computed once per
+  // key, P2SH prefixes are checked on the script hash of the hash160
+  hashType = searchType;
+  if (searchType <= BECH32 && (typeMask & (typeMask - 1)))
+    hashType = P2PKH;
+  mixedP2SH = (hashType != P2SH) && (typeMask & (1 << P2SH));
+
+  if (mixedP2SH && useGpu) {
+    setError("P2SH mixed with other types not supported on GPU");
+    return;
+  }
+
+  if (searchType == XONLY) {
+    // The compression mode does not change x
+    if (useGpu) {
+      setError("X-only search not supported on GPU");
+      return;
+    }
+    if (startPubKeySpecified) {
+      setError("X-only search with a partial public key not supported");
+      return;
+    }
+    if (hrp.length() > 31) {
+      setError("HRP too long (max 31 characters)");
+      return;
+    }
+    this->searchMode = SEARCH_COMPRESSED;
+  }
+
+  if (searchType == ETH) {
+    // Keccak of x||y, the mode only gives the WIF compression flag
+    if (useGpu) {
+      setError("ETH search not supported on GPU");
+      return;
+    }
+    if (this->searchMode == SEARCH_BOTH)
+      this->searchMode = SEARCH_COMPRESSED;
+  }
+
+  // Constant for endomorphism
+  // if a is a nth primitive root of unity, a^-1 is also a nth primitive root.
+  // beta^3 = 1 mod p implies also beta^2 = beta^-1 mop (by multiplying both side by beta^-1)
+  // (beta^3 = 1 mod p),  beta2 = beta^-1 = beta^2
+  // (lambda^3 = 1 mod n), lamba2 = lamba^-1 = lamba^2
+  beta.SetBase16("7ae96a2b657c07106e64479eac3434e99cf0497512f58995c1396c28719501ee");
+  lambda.SetBase16("5363ad4cc05c30e0a5261c028812645a122e22ea20816678df02967c1b23bd72");
+  beta2.SetBase16("851695d49a83f8ef919bb86153cbcb16630fb68aed0a766a3ec693d68e6afa40");
+  lambda2.SetBase16("ac9c52b33fa3cf1f5ad9e3fd77ed9ba4a880b9fc8ec739c2e0cfc810b51283ce");
+  betaK1.Set(&beta);
+  beta2K1.Set(&beta2);
+
+  // Seed
+  if (seed.length() == 0) {
+    // Default seed
+    seed = Timer::getSeed(32);
+  }
+
+  if (paranoiacSeed) {
+    seed += Timer::getSeed(32);
+  }
+
+  // Protect seed against "seed search attack" using pbkdf2_hmac_sha512
+  string salt = "VanitySearch";
+  unsigned char hseed[64];
+  pbkdf2_hmac_sha512(hseed, 64, (const uint8_t *)seed.c_str(), seed.length(),
+    (const uint8_t *)salt.c_str(), salt.length(),
+    2048);
+  startKey.SetInt32(0);
+  sha256(hseed, 64, (unsigned char *)startKey.bits64);
+
+  // Rekey: one DRBG per thread (CPU 0..0x7F, GPU 0x80..) seeded from the OS
+  if (rekey > 0) {
+    uint8_t rngSeed[32];
+    Timer::getSeed(rngSeed, 32);
+    rng = (CHACHA20_DRBG *)malloc(256 * sizeof(CHACHA20_DRBG));
+    for (int i = 0; i < 256; i++)
+      chacha20_drbg_init(rng + i, rngSeed, (uint64_t)i);
+    memset(rngSeed, 0, sizeof(rngSeed));
+  }
+
+#ifdef WIN64
+  ghMutex = CreateMutex(NULL, FALSE, NULL);
+#else
+  pthread_mutex_init(&ghMutex, NULL);
+#endif
+
+  groupKernel = selectKernel();
+  ready = true;
+
+}
+
+VanitySearch::~VanitySearch() {
+
+  for (int i = 0; i < (int)arenas.size(); i++) {
+#ifdef WIN64
+    VirtualFree(arenas[i].ptr, 0, MEM_RELEASE);
+#else
+    munmap(arenas[i].ptr, arenas[i].size);
+#endif
+  }
+  if (prefixDBMap)
+    PrefixFile::Unmap(prefixDBMap, prefixDBSize);
+  if (patternFound)
+    free(patternFound);
+  if (rng) {
+    memset(rng, 0, 256 * sizeof(CHACHA20_DRBG));
+    free(rng);
+  }
+
+  if (ready) {
+#ifdef WIN64
+    CloseHandle(ghMutex);
+#else
+    pthread_mutex_destroy(&ghMutex);
+#endif
+  }
+
+}
+
+bool VanitySearch::IsReady() {
+  return ready;
+}
+
+std::string VanitySearch::GetError() {
+  return error;
+}
+
+// Console output, muted in quiet mode
+void VanitySearch::message(const char *fmt, ...) {
+
+  if (quiet)
+    return;
+  va_list args;
+  va_start(args, fmt);
+  vprintf(fmt, args);
+  va_end(args);
+
+}
+
+// Keep the first error for GetError() and print it
+void VanitySearch::setError(const char *fmt, ...) {
+
+  char tmp[1024];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(tmp, sizeof(tmp), fmt, args);
+  va_end(args);
+
+  if (error.length() == 0)
+    error = string(tmp);
+  if (!quiet)
+    printf("Error: %s\n", tmp);
+
+}
+
+void VanitySearch::Stop() {
+  endOfSearch = true;
+}
+
+void VanitySearch::SetFoundCallback(FOUND_CALLBACK callback, void *user) {
+  foundCallback = callback;
+  foundUser = user;
+}
+
+void VanitySearch::SetGPUEngines(GPUEngine **engines) {
+  gpuEngine = engines;
+}
+
+// ----------------------------------------------------------------------------
+
+void VanitySearch::StartJob(int nbThread) {
+
+  nbCPUThread = nbThread;
+  nbGPUThread = 0;
+  nbFoundKey = 0;
+  memset(counters, 0, sizeof(counters));
+  startTime = Timer::get_tick();
+
+}
+
+void VanitySearch::InitKeyCPU(int thId, Int &key, Point *startP) {
+  counters[thId] = 0;
+  getCPUStartingKey(thId, key, startP);
+}
+
+void VanitySearch::RekeyCPU(int thId, Int &key, Point *startP) {
+  getCPUStartingKey(thId, key, startP);
+}
+
+uint64_t VanitySearch::GetRekey() {
+  return rekey;
+}
+
+bool VanitySearch::IsEnded() {
+  return endOfSearch;
+}
+
+uint64_t VanitySearch::GetCount() {
+  return getCPUCount() + getGPUCount();
+}
+
+int VanitySearch::GetNbFound() {
+  return nbFoundKey;
+}
+
+double VanitySearch::GetStartTime() {
+  return startTime;
+}
+
+int VanitySearch::GetSearchType() {
+  return searchType;
+}
+
+string VanitySearch::getSearchInfo() {
+
+  string info;
+  switch (searchType) {
+  case XONLY: info = "X-only"; break;
+  case ETH:   info = "ETH"; break;
+  default:    info = searchModes[searchMode]; break;
+  }
+  if (searchType <= BECH32 && (typeMask & (typeMask - 1))) {
+    // Mixed search
+    string types;
+    if (typeMask & (1 << P2PKH)) types += "P2PKH ";
+    if (typeMask & (1 << P2SH)) types += "P2SH ";
+    if (typeMask & (1 << BECH32)) types += "BECH32 ";
+    types[types.length() - 1] = ',';
+    info = types + " " + info;
+  }
+  return info + (startPubKeySpecified ? ", with public key" : "");
+
+}
+
+// ----------------------------------------------------------------------------
+
+#ifdef WIN64
+DWORD WINAPI _BuildPrefixes(LPVOID lpParam) {
+#else
+void *_BuildPrefixes(void *lpParam) {
+#endif
+  PREFIX_TH_PARAM *p = (PREFIX_TH_PARAM *)lpParam;
+  p->obj->BuildPrefixes(p);
+  return 0;
+}
+
+#define STEP_PARSE   0
+#define STEP_SCATTER 1
+#define STEP_SORT    2
+
+void VanitySearch::launchPrefixThreads(PREFIX_TH_PARAM *params, int nbThread, int step) {
+
+  for (int i = 0; i < nbThread; i++)
+    params[i].step = step;
+
+  if (nbThread == 1) {
+    BuildPrefixes(params);
+    return;
+  }
+
+#ifdef WIN64
+  HANDLE *th = new HANDLE[nbThread];
+  for (int i = 0; i < nbThread; i++) {
+    DWORD thread_id;
+    th[i] = CreateThread(NULL, 0, _BuildPrefixes, (void*)(params + i), 0, &thread_id);
+  }
+  WaitForMultipleObjects(nbThread, th, TRUE, INFINITE);
+  for (int i = 0; i < nbThread; i++)
+    CloseHandle(th[i]);
+#else
+  pthread_t *th = new pthread_t[nbThread];
+  for (int i = 0; i < nbThread; i++)
+    pthread_create(th + i, NULL, &_BuildPrefixes, (void*)(params + i));
+  for (int i = 0; i < nbThread; i++)
+    pthread_join(th[i], NULL);
+#endif
+  delete[] th;
+
+}
+
+// Prefix text comparison, ETH prefixes keep their case (EIP-55) and the hex
+// digits are compared case unsensitively (fold)
+static int prefixCompare(const char *a, const char *b, size_t n, bool fold) {
+  if (!fold)
+    return strncmp(a, b, n);
+  for (size_t i = 0; i < n; i++) {
+    int ca = tolower((unsigned char)a[i]);
+    int cb = tolower((unsigned char)b[i]);
+    if (ca != cb || ca == 0)
+      return ca - cb;
+  }
+  return 0;
+}
+
+// Prefixes first (by text), then full addresses (by lPrefix)
+struct EntryLower {
+  uint8_t *data;
+  bool fold;
+  bool operator()(const PREFIX_ENTRY &a, const PREFIX_ENTRY &b) const {
+    if (a.isFull != b.isFull) return b.isFull;
+    if (a.isFull) return a.lPrefix < b.lPrefix;
+    return prefixCompare((char *)(data + a.data), (char *)(data + b.data), (size_t)-1, fold) < 0;
+  }
+};
+
+// Large prefix arrays are allocated outside the heap, using huge pages when
+// possible (zero initialized)
+void *VanitySearch::allocArena(size_t size) {
+
+  if (size == 0)
+    return NULL;
+
+#ifdef WIN64
+  void *ptr = VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+  void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) ptr = NULL;
+#ifdef MADV_HUGEPAGE
+  if (ptr != NULL && size >= 2 * 1024 * 1024)
+    madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+#endif
+
+  if (ptr == NULL) {
+    setError("Cannot allocate %.1f MB for prefix lookup", (double)size / (1024.0*1024.0));
+    return NULL;
+  }
+
+  // Released by the destructor
+  ARENA_ITEM a;
+  a.ptr = ptr;
+  a.size = size;
+  arenas.push_back(a);
+
+  return ptr;
+
+}
+
+// Prefix shorter than 16 bits (x-only, ETH): one entry in each bucket
+// starting with its bits (sPrefix is big endian)
+static int getNbBucket(PREFIX_ITEM *it) {
+  return 1 << (16 - it->sPrefixBits);
+}
+
+static prefix_t getBucket(PREFIX_ITEM *it, int b) {
+  if (it->sPrefixBits >= 16)
+    return it->sPrefix;
+  uint16_t bb = (((uint16_t)((uint8_t *)&it->sPrefix)[0] << 8) | ((uint8_t *)&it->sPrefix)[1]) | (uint16_t)b;
+  return (prefix_t)((bb >> 8) | (bb << 8));
+}
+
+void VanitySearch::addEntry(PREFIX_TH_PARAM *p, PREFIX_ITEM *it, uint32_t input) {
+
+  // Full address: hash160, prefix: null terminated text (4 bytes aligned)
+  // Shared by the bucket copies
+  uint32_t data = (uint32_t)p->data.size();
+  if (it->isFull) {
+    p->data.insert(p->data.end(), it->hash160, it->hash160 + 20);
+  } else {
+    p->data.insert(p->data.end(), (uint8_t *)it->prefix, (uint8_t *)it->prefix + it->prefixLength);
+    p->data.resize((p->data.size() + 4) & ~(size_t)3, 0);
+  }
+
+  int nbBucket = getNbBucket(it);
+  for (int b = 0; b < nbBucket; b++) {
+
+    PREFIX_ENTRY e;
+    e.lPrefix = it->lPrefix;
+    e.data = data;
+    e.input = input;
+    e.sPrefix = getBucket(it, b);
+    e.length = (uint8_t)it->prefixLength;
+    e.isFull = it->isFull;
+    e.type = (uint8_t)it->type;
+
+    p->items.push_back(e);
+    p->bucketPos[e.sPrefix]++;
+
+  }
+
+  p->onlyFull &= it->isFull;
+  p->typeMask |= 1 << it->type;
+
+}
+
+static uint32_t atomicAdd(uint32_t *v, int32_t d) {
+#ifdef WIN64
+  return (uint32_t)(InterlockedExchangeAdd((volatile LONG *)v, d) + d);
+#else
+  return __sync_add_and_fetch(v, d);
+#endif
+}
+
+static bool atomicSetBit(uint64_t *bits, uint32_t idx) {
+  // Several threads may update the same word, returns true if the bit was clear
+  uint64_t mask = 1ULL << (idx & 63);
+#ifdef WIN64
+  uint64_t old = (uint64_t)InterlockedOr64((volatile LONG64 *)(bits + (idx >> 6)), (LONG64)mask);
+#else
+  uint64_t old = __sync_fetch_and_or(bits + (idx >> 6), mask);
+#endif
+  return (old & mask) == 0;
+}
+
+bool VanitySearch::isFound(uint32_t input) {
+  return (prefixFound[input >> 6] >> (input & 63)) & 1;
+}
+
+bool VanitySearch::setFound(uint32_t input) {
+  return atomicSetBit(prefixFound, input);
+}
+
+void VanitySearch::initFound() {
+
+  // Inputs without entry (ignored prefixes) are never searched
+  memset(prefixFound, 0xFF, ((nbInput + 63) / 64) * sizeof(uint64_t));
+  for (uint32_t i = 0; i < nbEntry; i++) {
+    uint32_t input = prefixEntries[i].input;
+    prefixFound[input >> 6] &= ~(1ULL << (input & 63));
+  }
+
+  // Remaining inputs per difficulty (few distinct values)
+  nbInputLeft = 0;
+  difficulties.clear();
+  for (uint32_t i = 0; i < nbInput; i++) {
+    if (isFound(i))
+      continue;
+    nbInputLeft++;
+    if (onlyFull)
+      continue;
+    double d = prefixDifficulty[i];
+    int st = 0;
+    int ed = (int)difficulties.size();
+    while (st < ed) {
+      int mi = (st + ed) / 2;
+      if (difficulties[mi].difficulty < d) st = mi + 1;
+      else                                 ed = mi;
+    }
+    if (st == (int)difficulties.size() || difficulties[st].difficulty != d) {
+      DIFFICULTY_ITEM di;
+      di.difficulty = d;
+      di.left = 0;
+      difficulties.insert(difficulties.begin() + st, di);
+    }
+    difficulties[st].left++;
+  }
+
+  for (int b = 0; b < 65536; b++)
+    prefixes[b].live = prefixes[b].count;
+  nbPruned = 0;
+
+  // Found entries are pruned from the lookup table only with -stop
+  if (stopWhenFound)
+    entryDead = (uint64_t *)allocArena(((nbEntry + 63) / 64) * sizeof(uint64_t));
+
+}
+
+void VanitySearch::killEntry(uint32_t entry) {
+
+  if (!atomicSetBit(entryDead, entry))
+    return;
+
+  // No more live entry, remove the bucket from the lookup table
+  PREFIX_TABLE_ITEM *t = &prefixes[prefixEntries[entry].sPrefix];
+  if (atomicAdd(&t->live, -1) == 0) {
+    t->count = 0;
+    atomicAdd(&nbPruned, 1);
+  }
+
+}
+
+void VanitySearch::foundInput(uint32_t input, uint32_t entry) {
+
+  atomicAdd(&nbInputLeft, -1);
+
+  if (!onlyFull) {
+    double d = prefixDifficulty[input];
+    int st = 0;
+    int ed = (int)difficulties.size();
+    while (st < ed) {
+      int mi = (st + ed) / 2;
+      if (difficulties[mi].difficulty < d) st = mi + 1;
+      else                                 ed = mi;
+    }
+    if (st < (int)difficulties.size())
+      atomicAdd(&difficulties[st].left, -1);
+  }
 
-  lastRekey = 0;
-  prefixes.clear();
+  if (!stopWhenFound)
+    return;
 
-  // Create a 65536 items lookup table
-  PREFIX_TABLE_ITEM t;
-  t.found = true;
-  t.items = NULL;
-  for(int i=0;i<65536;i++)
-    prefixes.push_back(t);
+  killEntry(entry);
 
-  // Check is inputPrefixes contains wildcard character
-  for (int i = 0; i < (int)inputPrefixes.size() && !hasPattern; i++) {
-    hasPattern = ((inputPrefixes[i].find('*') != std::string::npos) ||
-                   (inputPrefixes[i].find('?') != std::string::npos) );
+  if (prefixEntries[entry].isFull)
+    return;
+
+  // Entries of the other case combinations and copies of short prefixes
+  // are in other buckets
+  vector<string> subList;
+  PREFIX_ITEM it;
+  string text = string((char *)(prefixData + prefixEntries[entry].data));
+  if (!caseSensitive && searchType != ETH)
+    enumCaseUnsentivePrefix(text, subList);
+  else
+    subList.push_back(text);
+
+  for (int j = 0; j < (int)subList.size(); j++) {
+    if (!initPrefix(&subList[j][0], &it))
+      continue;
+    int nbBucket = getNbBucket(&it);
+    if (nbBucket == 1 && caseSensitive)
+      continue;
+    for (int b = 0; b < nbBucket; b++) {
+      prefix_t sp = getBucket(&it, b);
+      uint32_t offset = prefixes[sp].offset;
+      uint32_t count = prefixes[sp].count;
+      for (uint32_t k = offset; k < offset + count; k++) {
+        if (prefixEntries[k].input == input)
+          killEntry(k);
+      }
+    }
   }
 
-  if (!hasPattern) {
+}
 
-    // No wildcard used, standard search
-    // Insert prefixes
-    bool loadingProgress = (inputPrefixes.size() > 1000);
-    if (loadingProgress)
-      printf("[Building lookup16   0.0%%]\r");
+void VanitySearch::BuildPrefixes(PREFIX_TH_PARAM *p) {
 
-    nbPrefix = 0;
-    onlyFull = true;
-    for (int i = 0; i < (int)inputPrefixes.size(); i++) {
+  switch (p->step) {
+
+  case STEP_PARSE:
+
+    // Parse prefixes [startIdx,endIdx[ and count items per bucket
+    p->nbPrefix = 0;
+    p->onlyFull = true;
+    p->typeMask = 0;
+    p->bucketPos.assign(65536, 0);
+    p->data.clear();
+    if (caseSensitive) {
+      // One entry per input, 20 bytes hash160 or padded text
+      p->items.reserve(p->endIdx - p->startIdx);
+      p->data.reserve((size_t)(p->endIdx - p->startIdx) * 24);
+    }
+
+    for (int i = p->startIdx; i < p->endIdx; i++) {
 
       PREFIX_ITEM it;
       std::vector<PREFIX_ITEM> itPrefixes;
 
-      if (!caseSensitive) {
+      if (!caseSensitive && searchType != ETH) {
 
-        // For caseunsensitive search, loop through all possible combination
-        // and fill up lookup table
+        // For caseunsensitive search, only the case combinations of the
+        // leading characters give different lookup prefixes. Add one entry
+        // per lookup prefix, matched against the case folded address.
         vector<string> subList;
-        enumCaseUnsentivePrefix(inputPrefixes[i], subList);
-
-        bool *found = new bool;
-        *found = false;
+        double nbOther = enumCaseUnsentivePrefix(string(inputPrefixes[i]), subList);
 
         for (int j = 0; j < (int)subList.size(); j++) {
-          if (initPrefix(subList[j], &it)) {
-            it.found = found;
-            it.prefix = strdup(it.prefix); // We need to allocate here, subList will be destroyed
+          if (initPrefix(&subList[j][0], &it))
             itPrefixes.push_back(it);
-          }
         }
 
         if (itPrefixes.size() > 0) {
 
+          string folded = string(inputPrefixes[i]);
+          for (int j = 0; j < (int)folded.length(); j++)
+            folded[j] = (char)tolower(folded[j]);
+
+          for (int j = 0; j < (int)itPrefixes.size(); j++) {
+            bool newBucket = true;
+            for (int k = 0; k < j && newBucket; k++)
+              newBucket = itPrefixes[k].sPrefix != itPrefixes[j].sPrefix;
+            if (newBucket) {
+              it = itPrefixes[j];
+              it.prefix = &folded[0];
+              it.prefixLength = (int)folded.length();
+              it.isFull = false;
+              it.lPrefix = 0;
+              addEntry(p, &it, i);
+            }
+          }
+
           // Compute difficulty for case unsensitive search
           // Not obvious to perform the right calculation here using standard double
           // Improvement are welcome
@@ -126,208 +847,380 @@ VanitySearch::VanitySearch(Secp256K1 *secp, vector<std::string> &inputPrefixes,s
             }
           }
 
-          dMin /= (double)nbMin;
+          dMin /= (double)nbMin * nbOther;
 
-          // Updates
-          for (int j = 0; j < (int)itPrefixes.size(); j++)
-            itPrefixes[j].difficulty = dMin;
+          prefixDifficulty[i] = dMin;
 
         }
 
       } else {
 
         if (initPrefix(inputPrefixes[i], &it)) {
-          bool *found = new bool;
-          *found = false;
-          it.found = found;
+          addEntry(p, &it, i);
+          prefixDifficulty[i] = it.difficulty;
           itPrefixes.push_back(it);
         }
 
       }
 
-      if (itPrefixes.size() > 0) {
+      if (itPrefixes.size() > 0)
+        p->nbPrefix++;
 
-        // Add the item to all correspoding prefixes in the lookup table
-        for (int j = 0; j < (int)itPrefixes.size(); j++) {
+    }
+    break;
 
-          prefix_t p = itPrefixes[j].sPrefix;
+  case STEP_SCATTER:
 
-          if (prefixes[p].items == NULL) {
-            prefixes[p].items = new vector<PREFIX_ITEM>();
-            prefixes[p].found = false;
-            usedPrefix.push_back(p);
-          }
-          (*prefixes[p].items).push_back(itPrefixes[j]);
+    // Copy entries to their bucket, bucketPos holds the first free slot of
+    // this thread in each bucket (input order is kept within a bucket)
+    for (int i = 0; i < (int)p->items.size(); i++) {
+      PREFIX_ENTRY *e = &p->items[i];
+      e->data += p->dataOffset;
+      prefixEntries[p->bucketPos[e->sPrefix]++] = *e;
+    }
+    if (p->data.size())
+      memcpy(prefixData + p->dataOffset, p->data.data(), p->data.size());
+    p->items.clear();
+    p->items.shrink_to_fit();
+    p->data.clear();
+    p->data.shrink_to_fit();
+    p->bucketPos.clear();
+    p->bucketPos.shrink_to_fit();
+    break;
 
-        }
+  case STEP_SORT:
+
+    // Sort buckets (stable, duplicates keep input order) and link each
+    // prefix to the closest previous one it starts with. The candidates
+    // are the previous prefix and its enclosing prefixes.
+    for (int i = p->startIdx; i < p->endIdx; i++) {
+      PREFIX_ENTRY *pe = prefixEntries + prefixes[i].offset;
+      int nb = (int)prefixes[i].count;
+      if (nb > 1) {
+        EntryLower lower;
+        lower.data = prefixData;
+        lower.fold = (searchType == ETH);
+        std::stable_sort(pe, pe + nb, lower);
+      }
+      for (int j = 0; j < nb && !pe[j].isFull; j++) {
+        char *t = (char *)(prefixData + pe[j].data);
+        int k = j - 1;
+        while (k >= 0 && !(pe[k].length <= pe[j].length &&
+                           prefixCompare((char *)(prefixData + pe[k].data), t, pe[k].length, searchType == ETH) == 0))
+          k = (pe[k].parent == 0) ? -1 : k - (int)pe[k].parent;
+        pe[j].parent = (k >= 0) ? (uint32_t)(j - k) : 0;
+      }
+    }
+    break;
 
-        onlyFull &= it.isFull;
-        nbPrefix++;
+  }
 
-      }
+}
 
-      if (loadingProgress && i % 1000 == 0)
-        printf("[Building lookup16 %5.1f%%]\r", (((double)i) / (double)(inputPrefixes.size() - 1)) * 100.0);
-    }
+bool VanitySearch::buildPrefixes() {
 
-    if (loadingProgress)
-      printf("\n");
+  nbInput = (uint32_t)inputPrefixes.size();
 
-    //dumpPrefixes();
+  // Small lists are built on a single thread (keeps messages ordered)
+  int nbThread = Timer::getCoreNumber();
+  if (nbThread > (int)(nbInput / 1024)) nbThread = (int)(nbInput / 1024);
+  if (nbThread < 1) nbThread = 1;
 
-    if (!caseSensitive && searchType == BECH32) {
-      printf("Error, case unsensitive search with BECH32 not allowed.\n");
-      exit(1);
-    }
+  prefixFound = (uint64_t *)allocArena(((nbInput + 63) / 64) * sizeof(uint64_t));
+  prefixDifficulty = (double *)allocArena(nbInput * sizeof(double));
+  if (error.length() > 0)
+    return false;
 
-    if (nbPrefix == 0) {
-      printf("VanitySearch: nothing to search !\n");
-      exit(1);
-    }
+  PREFIX_TH_PARAM *params = new PREFIX_TH_PARAM[nbThread];
+  for (int i = 0; i < nbThread; i++) {
+    params[i].obj = this;
+    params[i].threadId = i;
+    params[i].nbThread = nbThread;
+    params[i].startIdx = (int)(((int64_t)nbInput * i) / nbThread);
+    params[i].endIdx = (int)(((int64_t)nbInput * (i + 1)) / nbThread);
+  }
 
-    // Second level lookup
-    uint32_t unique_sPrefix = 0;
-    uint32_t minI = 0xFFFFFFFF;
-    uint32_t maxI = 0;
-    for (int i = 0; i < (int)prefixes.size(); i++) {
-      if (prefixes[i].items) {
-        LPREFIX lit;
-        lit.sPrefix = i;
-        if (prefixes[i].items) {
-          for (int j = 0; j < (int)prefixes[i].items->size(); j++) {
-            lit.lPrefixes.push_back((*prefixes[i].items)[j].lPrefix);
-          }
-        }
-        sort(lit.lPrefixes.begin(), lit.lPrefixes.end());
-        usedPrefixL.push_back(lit);
-        if ((uint32_t)lit.lPrefixes.size() > maxI) maxI = (uint32_t)lit.lPrefixes.size();
-        if ((uint32_t)lit.lPrefixes.size() < minI) minI = (uint32_t)lit.lPrefixes.size();
-        unique_sPrefix++;
-      }
-      if (loadingProgress)
-        printf("[Building lookup32 %.1f%%]\r", ((double)i*100.0) / (double)prefixes.size());
+  // Parse
+  launchPrefixThreads(params, nbThread, STEP_PARSE);
+
+  // Bucket offsets (CSR), each thread gets its own range in each bucket
+  nbPrefix = 0;
+  onlyFull = true;
+  for (int i = 0; i < nbThread; i++) {
+    nbPrefix += params[i].nbPrefix;
+    onlyFull &= params[i].onlyFull;
+    typeMask |= params[i].typeMask;
+  }
+
+  usedPrefix.clear();
+
+  uint32_t offset = 0;
+  for (int b = 0; b < 65536; b++) {
+    prefixes[b].offset = offset;
+    for (int i = 0; i < nbThread; i++) {
+      uint32_t c = params[i].bucketPos[b];
+      params[i].bucketPos[b] = offset;
+      offset += c;
     }
+    prefixes[b].count = offset - prefixes[b].offset;
+    if (prefixes[b].count)
+      usedPrefix.push_back((prefix_t)b);
+  }
 
-    if (loadingProgress)
-      printf("\n");
+  // Prefix data, each thread gets its own range
+  size_t dataSize = 0;
+  for (int i = 0; i < nbThread; i++) {
+    params[i].dataOffset = (uint32_t)dataSize;
+    dataSize += params[i].data.size();
+  }
+  if (dataSize > 0xFFFFFFFFULL) {
+    setError("Too much prefixes (%.1f MB of prefix data)", (double)dataSize / (1024.0*1024.0));
+    delete[] params;
+    return false;
+  }
 
-    _difficulty = getDiffuclty();
-    string seachInfo = string(searchModes[searchMode]) + (startPubKeySpecified ? ", with public key" : "");
-    if (nbPrefix == 1) {
-      if (!caseSensitive) {
-        // Case unsensitive search
-        printf("Difficulty: %.0f\n", _difficulty);
-        printf("Search: %s [%s, Case unsensitive] (Lookup size %d)\n", inputPrefixes[0].c_str(), seachInfo.c_str(), unique_sPrefix);
-      } else {
-        printf("Difficulty: %.0f\n", _difficulty);
-        printf("Search: %s [%s]\n", inputPrefixes[0].c_str(), seachInfo.c_str());
-      }
-    } else {
-      if (onlyFull) {
-        printf("Search: %d addresses (Lookup size %d,[%d,%d]) [%s]\n", nbPrefix, unique_sPrefix, minI, maxI, seachInfo.c_str());
-      } else {
-        printf("Search: %d prefixes (Lookup size %d) [%s]\n", nbPrefix, unique_sPrefix, seachInfo.c_str());
+  nbEntry = offset;
+  prefixDataSize = (uint32_t)dataSize;
+  prefixEntries = (PREFIX_ENTRY *)allocArena(nbEntry * sizeof(PREFIX_ENTRY));
+  prefixData = (uint8_t *)allocArena(prefixDataSize);
+  if (error.length() > 0) {
+    delete[] params;
+    return false;
+  }
+  launchPrefixThreads(params, nbThread, STEP_SCATTER);
+
+  for (int i = 0; i < nbThread; i++) {
+    params[i].startIdx = (65536 * i) / nbThread;
+    params[i].endIdx = (65536 * (i + 1)) / nbThread;
+  }
+  launchPrefixThreads(params, nbThread, STEP_SORT);
+  delete[] params;
+
+  // GPU lookup tables (full addresses)
+  // lookup16[b]: number of distinct lPrefix in bucket b
+  // lookup32[b]: offset of the bucket lPrefix list, followed by the lists
+  if (onlyFull) {
+    lookup16 = (prefix_t *)allocArena(65536 * sizeof(prefix_t));
+    lookup32 = (uint32_t *)allocArena((65536 + (size_t)nbEntry) * sizeof(uint32_t));
+    if (error.length() > 0)
+      return false;
+    nbLookup32 = 65536;
+    for (int b = 0; b < 65536; b++) {
+      uint32_t start = nbLookup32;
+      PREFIX_ENTRY *pe = prefixEntries + prefixes[b].offset;
+      for (uint32_t j = 0; j < prefixes[b].count; j++) {
+        if (j == 0 || pe[j].lPrefix != pe[j - 1].lPrefix)
+          lookup32[nbLookup32++] = pe[j].lPrefix;
       }
+      lookup16[b] = (prefix_t)(nbLookup32 - start);
+      lookup32[b] = (nbLookup32 > start) ? start : 0;
     }
+  }
 
-  } else {
+  return true;
 
-    // Wild card search
-    switch (inputPrefixes[0].data()[0]) {
+}
 
-    case '1':
-      searchType = P2PKH;
-      break;
-    case '3':
-      searchType = P2SH;
-      break;
-    case 'b':
-    case 'B':
-      searchType = BECH32;
-      break;
+// ----------------------------------------------------------------------------
 
-    default:
-      printf("Invalid start character 1,3 or b, expected");
-      exit(1);
+bool VanitySearch::IsPrefixDB(std::string fileName) {
 
-    }
+  uint32_t magic = 0;
+  FILE *f = fopen(fileName.c_str(), "rb");
+  if (f == NULL)
+    return false;
+  bool ok = fread(&magic, sizeof(magic), 1, f) == 1;
+  fclose(f);
+  return ok && magic == PREFIXDB_MAGIC;
 
-    string searchInfo = string(searchModes[searchMode]) + (startPubKeySpecified ? ", with public key" : "");
-    if (inputPrefixes.size() == 1) {
-      printf("Search: %s [%s]\n", inputPrefixes[0].c_str(), searchInfo.c_str());
-    } else {
-      printf("Search: %d patterns [%s]\n", (int)inputPrefixes.size(), searchInfo.c_str());
-    }
+}
 
-    patternFound = (bool *)malloc(inputPrefixes.size()*sizeof(bool));
-    memset(patternFound,0, inputPrefixes.size() * sizeof(bool));
+bool VanitySearch::SavePrefixes(std::string fileName) {
 
+  if (hasPattern) {
+    setError("Wildcard patterns cannot be compiled");
+    return false;
+  }
+
+  PREFIXDB_HEADER h;
+  memset(&h, 0, sizeof(h));
+  h.magic = PREFIXDB_MAGIC;
+  h.version = PREFIXDB_VERSION;
+  h.entrySize = sizeof(PREFIX_ENTRY);
+  h.searchType = searchType;
+  h.caseSensitive = caseSensitive;
+  h.onlyFull = onlyFull;
+  h.nbInput = nbInput;
+  h.nbPrefix = nbPrefix;
+  h.nbEntry = nbEntry;
+  h.dataSize = prefixDataSize;
+  h.nbLookup32 = nbLookup32;
+  h.typeMask = typeMask;
+
+  uint32_t *buckets = new uint32_t[65536 * 2];
+  for (int b = 0; b < 65536; b++) {
+    buckets[2 * b] = prefixes[b].offset;
+    buckets[2 * b + 1] = prefixes[b].count;
   }
+  size_t nbLookup16 = onlyFull ? 65536 : 0;
+
+  // Write to a temporary file and rename it, running searches may use
+  // the previous version
+  string tmpName = fileName + ".tmp";
+  FILE *f = fopen(tmpName.c_str(), "wb");
+  if (f == NULL) {
+    setError("Cannot open %s for writing %s", tmpName.c_str(), strerror(errno));
+    delete[] buckets;
+    return false;
+  }
+  bool ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+            fwrite(buckets, sizeof(uint32_t), 65536 * 2, f) == 65536 * 2 &&
+            fwrite(prefixDifficulty, sizeof(double), nbInput, f) == nbInput &&
+            fwrite(prefixEntries, sizeof(PREFIX_ENTRY), nbEntry, f) == nbEntry &&
+            fwrite(lookup32, sizeof(uint32_t), nbLookup32, f) == nbLookup32 &&
+            fwrite(lookup16, sizeof(prefix_t), nbLookup16, f) == nbLookup16 &&
+            fwrite(prefixData, 1, prefixDataSize, f) == prefixDataSize;
+  ok = (fclose(f) == 0) && ok;
+  delete[] buckets;
 
-  // Compute Generator table G[n] = (n+1)*G
+#ifdef WIN64
+  ok = ok && MoveFileExA(tmpName.c_str(), fileName.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+  ok = ok && rename(tmpName.c_str(), fileName.c_str()) == 0;
+#endif
 
-  Point g = secp->G;
-  Gn[0] = g;
-  g = secp->DoubleDirect(g);
-  Gn[1] = g;
-  for (int i = 2; i < CPU_GRP_SIZE/2; i++) {
-    g = secp->AddDirect(g,secp->G);
-    Gn[i] = g;
+  if (!ok) {
+    setError("Cannot write prefix database to %s", fileName.c_str());
+    remove(tmpName.c_str());
+    return false;
   }
-  // _2Gn = CPU_GRP_SIZE*G
-  _2Gn = secp->DoubleDirect(Gn[CPU_GRP_SIZE/2-1]);
 
-  // Constant for endomorphism
-  // if a is a nth primitive root of unity, a^-1 is also a nth primitive root.
-  // beta^3 = 1 mod p implies also beta^2 = beta^-1 mop (by multiplying both side by beta^-1)
-  // (beta^3 = 1 mod p),  beta2 = beta^-1 = beta^2
-  // (lambda^3 = 1 mod n), lamba2 = lamba^-1 = lamba^2
-  beta.SetBase16("7ae96a2b657c07106e64479eac3434e99cf0497512f58995c1396c28719501ee");
-  lambda.SetBase16("5363ad4cc05c30e0a5261c028812645a122e22ea20816678df02967c1b23bd72");
-  beta2.SetBase16("851695d49a83f8ef919bb86153cbcb16630fb68aed0a766a3ec693d68e6afa40");
-  lambda2.SetBase16("ac9c52b33fa3cf1f5ad9e3fd77ed9ba4a880b9fc8ec739c2e0cfc810b51283ce");
+  message("Prefix database: %s (%d entries, %.1f MB)\n", fileName.c_str(), nbEntry,
+    (double)(sizeof(h) + 65536 * 8 + nbInput * sizeof(double) + nbEntry * sizeof(PREFIX_ENTRY) +
+     (size_t)nbLookup32 * 4 + nbLookup16 * 2 + prefixDataSize) / (1024.0*1024.0));
+  return true;
 
-  // Seed
-  if (seed.length() == 0) {
-    // Default seed
-    seed = Timer::getSeed(32);
+}
+
+bool VanitySearch::loadPrefixes(std::string fileName) {
+
+  size_t size;
+  string mapError;
+  uint8_t *map = (uint8_t *)PrefixFile::Map(fileName, &size, false, mapError);
+  if (mapError.length() > 0) {
+    setError("%s", mapError.c_str());
+    return false;
   }
+  prefixDBMap = map;
+  prefixDBSize = size;
+  PREFIXDB_HEADER *h = (PREFIXDB_HEADER *)map;
 
-  if (paranoiacSeed) {
-    seed += Timer::getSeed(32);
+  if (size < sizeof(PREFIXDB_HEADER) || h->magic != PREFIXDB_MAGIC) {
+    setError("%s is not a prefix database", fileName.c_str());
+    return false;
+  }
+  if (h->version != PREFIXDB_VERSION || h->entrySize != sizeof(PREFIX_ENTRY)) {
+    setError("%s wrong prefix database version, please recompile it", fileName.c_str());
+    return false;
   }
 
-  // Protect seed against "seed search attack" using pbkdf2_hmac_sha512
-  string salt = "VanitySearch";
-  unsigned char hseed[64];
-  pbkdf2_hmac_sha512(hseed, 64, (const uint8_t *)seed.c_str(), seed.length(),
-    (const uint8_t *)salt.c_str(), salt.length(),
-    2048);
-  startKey.SetInt32(0);
-  sha256(hseed, 64, (unsigned char *)startKey.bits64);
+  size_t nbLookup16 = h->onlyFull ? 65536 : 0;
+  size_t expected = sizeof(PREFIXDB_HEADER) + 65536 * 8 + (size_t)h->nbInput * sizeof(double) +
+                    (size_t)h->nbEntry * sizeof(PREFIX_ENTRY) + (size_t)h->nbLookup32 * 4 + nbLookup16 * 2 +
+                    h->dataSize;
+  if (size != expected) {
+    setError("%s invalid prefix database size", fileName.c_str());
+    return false;
+  }
 
-  char *ctimeBuff;
-  time_t now = time(NULL);
-  ctimeBuff = ctime(&now);
-  printf("Start %s", ctimeBuff);
+  searchType = h->searchType;
+  typeMask = h->typeMask;
+  onlyFull = h->onlyFull != 0;
+  nbInput = h->nbInput;
+  nbPrefix = h->nbPrefix;
+  nbEntry = h->nbEntry;
+  prefixDataSize = h->dataSize;
+  nbLookup32 = h->nbLookup32;
+  if (caseSensitive != (h->caseSensitive != 0)) {
+    message("Warning: %s was compiled %s\n", fileName.c_str(),
+      h->caseSensitive ? "case sensitive" : "case unsensitive (-c)");
+    caseSensitive = h->caseSensitive != 0;
+  }
 
-  if (rekey > 0) {
-    printf("Base Key: Randomly changed every %.0f Mkeys\n",(double)rekey);
-  } else {
-    printf("Base Key: %s\n", startKey.GetBase16().c_str());
+  // Sections are used in place
+  uint8_t *ptr = map + sizeof(PREFIXDB_HEADER);
+  uint32_t *buckets = (uint32_t *)ptr;
+  ptr += 65536 * 8;
+  prefixDifficulty = (double *)ptr;
+  ptr += (size_t)nbInput * sizeof(double);
+  prefixEntries = (PREFIX_ENTRY *)ptr;
+  ptr += (size_t)nbEntry * sizeof(PREFIX_ENTRY);
+  lookup32 = nbLookup32 ? (uint32_t *)ptr : NULL;
+  ptr += (size_t)nbLookup32 * 4;
+  lookup16 = nbLookup16 ? (prefix_t *)ptr : NULL;
+  ptr += nbLookup16 * 2;
+  prefixData = ptr;
+
+  usedPrefix.clear();
+  for (int b = 0; b < 65536; b++) {
+    prefixes[b].offset = buckets[2 * b];
+    prefixes[b].count = buckets[2 * b + 1];
+    if ((uint64_t)prefixes[b].offset + prefixes[b].count > nbEntry) {
+      setError("%s corrupted prefix database", fileName.c_str());
+      return false;
+    }
+    if (prefixes[b].count)
+      usedPrefix.push_back((prefix_t)b);
+  }
+
+  // Found flags are the only writable part
+  prefixFound = (uint64_t *)allocArena(((nbInput + 63) / 64) * sizeof(uint64_t));
+  return error.length() == 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+int VanitySearch::getPrefixType(char *prefix) {
+
+  if (prefix[0] == 0 || prefix[1] == 0)
+    return -1;
+
+  // X-only first, the HRP is chosen by the user
+  int hLength = (int)hrp.length();
+  int j = 0;
+  while (j < hLength && tolower(prefix[j]) == hrp[j]) j++;
+  if (hLength > 0 && j == hLength && prefix[j] == '1')
+    return XONLY;
+
+  if (prefix[0] == '0' && tolower(prefix[1]) == 'x')
+    return ETH;
+
+  switch (prefix[0]) {
+  case '1':
+    return P2PKH;
+  case '3':
+    return P2SH;
+  case 'b':
+  case 'B':
+    if (tolower(prefix[1]) == 'c' && prefix[2] == '1' && tolower(prefix[3]) == 'q')
+      return BECH32;
+    break;
   }
 
+  return -1;
+
 }
 
 // ----------------------------------------------------------------------------
 
-bool VanitySearch::isSingularPrefix(std::string pref) {
+bool VanitySearch::isSingularPrefix(char *pref) {
 
   // check is the given prefix contains only 1
   bool only1 = true;
   int i=0;
-  while (only1 && i < (int)pref.length()) {
-    only1 = pref.data()[i] == '1';
+  while (only1 && pref[i] != 0) {
+    only1 = pref[i] == '1';
     i++;
   }
   return only1;
@@ -335,22 +1228,32 @@ bool VanitySearch::isSingularPrefix(std::string pref) {
 }
 
 // ----------------------------------------------------------------------------
-bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
+bool VanitySearch::initPrefix(char *prefix,PREFIX_ITEM *it) {
 
   std::vector<unsigned char> result;
-  string dummy1 = prefix;
+  int length = (int)strlen(prefix);
   int nbDigit = 0;
   bool wrong = false;
 
-  if (prefix.length() < 2) {
-    printf("Ignoring prefix \"%s\" (too short)\n",prefix.c_str());
+  if (length < 2) {
+    message("Ignoring prefix \"%s\" (too short)\n",prefix);
     return false;
   }
 
   int aType = -1;
+  it->sPrefixBits = 16;
 
+  if (getPrefixType(prefix) == XONLY) {
 
-  switch (prefix.data()[0]) {
+    for (int i = 0; i < length; i++)
+      prefix[i] = (char)tolower(prefix[i]);
+    aType = XONLY;
+
+  } else if (getPrefixType(prefix) == ETH) {
+
+    aType = ETH;
+
+  } else switch (prefix[0]) {
   case '1':
     aType = P2PKH;
     break;
@@ -359,22 +1262,137 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
     break;
   case 'b':
   case 'B':
-    std::transform(prefix.begin(), prefix.end(), prefix.begin(), ::tolower);
-    if(strncmp(prefix.c_str(), "bc1q", 4) == 0)
+    for (int i = 0; i < length; i++)
+      prefix[i] = (char)tolower(prefix[i]);
+    if(strncmp(prefix, "bc1q", 4) == 0)
       aType = BECH32;
     break;
   }
 
   if (aType==-1) {
-    printf("Ignoring prefix \"%s\" (must start with 1 or 3 or bc1q)\n", prefix.c_str());
+    message("Ignoring prefix \"%s\" (must start with 1 or 3 or bc1q or %s1 or 0x)\n", prefix, hrp.c_str());
     return false;
   }
 
   if (searchType == -1) searchType = aType;
-  if (aType != searchType) {
-    printf("Ignoring prefix \"%s\" (P2PKH, P2SH or BECH32 allowed at once)\n", prefix.c_str());
+  if (aType != searchType && (aType > BECH32 || searchType > BECH32)) {
+    message("Ignoring prefix \"%s\" (X-only or ETH cannot be mixed with other types)\n", prefix);
     return false;
   }
+  it->type = aType;
+
+  if (aType == ETH) {
+
+    // Hex, the case is the EIP-55 checksum (case sensitive search only)
+    int nbChar = length - 2;
+    int nbLetter = 0;
+    bool hasUpper = false;
+    uint8_t data[20];
+    memset(data, 0, 20);
+
+    if (nbChar < 1) {
+      message("Ignoring prefix \"%s\" (too short)\n", prefix);
+      return false;
+    }
+
+    if (nbChar > 40) {
+      message("Ignoring prefix \"%s\" (too long)\n", prefix);
+      return false;
+    }
+
+    for (int i = 0; i < nbChar; i++) {
+      char c = prefix[2 + i];
+      int n;
+      if (c >= '0' && c <= '9') {
+        n = c - '0';
+      } else if (tolower(c) >= 'a' && tolower(c) <= 'f') {
+        n = tolower(c) - 'a' + 10;
+        nbLetter++;
+        hasUpper |= (c <= 'F');
+      } else {
+        message("Ignoring prefix \"%s\" (Only hex digits allowed)\n", prefix);
+        return false;
+      }
+      data[i / 2] |= (uint8_t)((i & 1) ? n : (n << 4));
+    }
+
+    // Full address ?
+    if (nbChar == 40) {
+
+      it->difficulty = pow(2, 160);
+      it->isFull = true;
+      memcpy(it->hash160, data, 20);
+      it->sPrefix = *(prefix_t *)(it->hash160);
+      it->lPrefix = *(prefixl_t *)(it->hash160);
+      it->prefix = prefix;
+      it->prefixLength = length;
+      return true;
+
+    }
+
+    // Difficulty (4 bits per digit, 1 bit per letter for EIP-55)
+    it->sPrefix = *(prefix_t *)data;
+    it->sPrefixBits = (nbChar < 4) ? 4 * nbChar : 16;
+    it->difficulty = pow(2, 4 * nbChar);
+    if (caseSensitive && hasUpper)
+      it->difficulty *= pow(2, nbLetter);
+    it->isFull = false;
+    it->lPrefix = 0;
+    it->prefix = prefix;
+    it->prefixLength = length;
+    return true;
+
+  }
+
+  if (aType == XONLY) {
+
+    // Bech32 of the 32 bytes of x, no hash
+    int hLength = (int)hrp.length() + 1;
+    uint8_t data[64];
+    size_t data_length;
+
+    // Full key ? (lookup on the first 20 bytes of x)
+    if (bech32_decode_bytes(data, &data_length, hrp.c_str(), prefix) && data_length == 32) {
+
+      it->difficulty = pow(2, 256);
+      it->isFull = true;
+      memcpy(it->hash160, data, 20);
+      it->sPrefix = *(prefix_t *)(it->hash160);
+      it->lPrefix = *(prefixl_t *)(it->hash160);
+      it->prefix = prefix;
+      it->prefixLength = length;
+      return true;
+
+    }
+
+    int nbChar = length - hLength;
+    if (nbChar < 1) {
+      message("Ignoring prefix \"%s\" (too short)\n", prefix);
+      return false;
+    }
+
+    if (nbChar > 51) {
+      message("Ignoring prefix \"%s\" (too long)\n", prefix);
+      return false;
+    }
+
+    memset(data, 0, 64);
+    if (!bech32_decode_nocheck(data, &data_length, prefix + hLength)) {
+      message("Ignoring prefix \"%s\" (Only \"023456789acdefghjklmnpqrstuvwxyz\" allowed)\n", prefix);
+      return false;
+    }
+
+    // Difficulty (5 bits per character)
+    it->sPrefix = *(prefix_t *)data;
+    it->sPrefixBits = (nbChar < 4) ? 5 * nbChar : 16;
+    it->difficulty = pow(2, 5 * nbChar);
+    it->isFull = false;
+    it->lPrefix = 0;
+    it->prefix = prefix;
+    it->prefixLength = length;
+    return true;
+
+  }
 
   if (aType == BECH32) {
 
@@ -384,7 +1402,7 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
     int witver;
     const char* hrp = "bc";
 
-    int ret = segwit_addr_decode(&witver, witprog, &witprog_len, hrp, prefix.c_str());
+    int ret = segwit_addr_decode(&witver, witprog, &witprog_len, hrp, prefix);
 
     // Try to attack a full address ?
     if (ret && witprog_len==20) {
@@ -395,37 +1413,37 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
       memcpy(it->hash160, witprog, 20);
       it->sPrefix = *(prefix_t *)(it->hash160);
       it->lPrefix = *(prefixl_t *)(it->hash160);
-      it->prefix = (char *)prefix.c_str();
-      it->prefixLength = (int)prefix.length();
+      it->prefix = prefix;
+      it->prefixLength = length;
       return true;
 
     }
 
-    if (prefix.length() < 5) {
-      printf("Ignoring prefix \"%s\" (too short, length<5 )\n", prefix.c_str());
+    if (length < 5) {
+      message("Ignoring prefix \"%s\" (too short, length<5 )\n", prefix);
       return false;
     }
 
-    if (prefix.length() >= 36) {
-      printf("Ignoring prefix \"%s\" (too long, length>36 )\n", prefix.c_str());
+    if (length >= 36) {
+      message("Ignoring prefix \"%s\" (too long, length>36 )\n", prefix);
       return false;
     }
 
     uint8_t data[64];
     memset(data,0,64);
     size_t data_length;
-    if(!bech32_decode_nocheck(data,&data_length,prefix.c_str()+4)) {
-      printf("Ignoring prefix \"%s\" (Only \"023456789acdefghjklmnpqrstuvwxyz\" allowed)\n", prefix.c_str());
+    if(!bech32_decode_nocheck(data,&data_length,prefix+4)) {
+      message("Ignoring prefix \"%s\" (Only \"023456789acdefghjklmnpqrstuvwxyz\" allowed)\n", prefix);
       return false;
     }
 
     // Difficulty
     it->sPrefix = *(prefix_t *)data;
-    it->difficulty = pow(2, 5*(prefix.length()-4));
+    it->difficulty = pow(2, 5*(length-4));
     it->isFull = false;
     it->lPrefix = 0;
-    it->prefix = (char *)prefix.c_str();
-    it->prefixLength = (int)prefix.length();
+    it->prefix = prefix;
+    it->prefixLength = length;
 
     return true;
 
@@ -437,7 +1455,7 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
 
     if (wrong) {
       if (caseSensitive)
-        printf("Ignoring prefix \"%s\" (0, I, O and l not allowed)\n", prefix.c_str());
+        message("Ignoring prefix \"%s\" (0, I, O and l not allowed)\n", prefix);
       return false;
     }
 
@@ -446,15 +1464,15 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
 
       // mamma mia !
       //if (!secp.CheckPudAddress(prefix)) {
-      //  printf("Warning, \"%s\" (address checksum may never match)\n", prefix.c_str());
+      //  message("Warning, \"%s\" (address checksum may never match)\n", prefix);
       //}
       it->difficulty = pow(2, 160);
       it->isFull = true;
       memcpy(it->hash160, result.data() + 1, 20);
       it->sPrefix = *(prefix_t *)(it->hash160);
       it->lPrefix = *(prefixl_t *)(it->hash160);
-      it->prefix = (char *)prefix.c_str();
-      it->prefixLength = (int)prefix.length();
+      it->prefix = prefix;
+      it->prefixLength = length;
       return true;
 
     }
@@ -462,23 +1480,24 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
     // Prefix containing only '1'
     if (isSingularPrefix(prefix)) {
 
-      if (prefix.length() > 21) {
-        printf("Ignoring prefix \"%s\" (Too much 1)\n", prefix.c_str());
+      if (length > 21) {
+        message("Ignoring prefix \"%s\" (Too much 1)\n", prefix);
         return false;
       }
 
       // Difficulty
-      it->difficulty = pow(256, prefix.length() - 1);
+      it->difficulty = pow(256, length - 1);
       it->isFull = false;
       it->sPrefix = 0;
       it->lPrefix = 0;
-      it->prefix = (char *)prefix.c_str();
-      it->prefixLength = (int)prefix.length();
+      it->prefix = prefix;
+      it->prefixLength = length;
       return true;
 
     }
 
     // Search for highest hash160 16bit prefix (most probable)
+    string dummy1 = string(prefix);
 
     while (result.size() < 25) {
       DecodeBase58(dummy1, result);
@@ -488,16 +1507,16 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
       }
     }
 
-    if (searchType == P2SH) {
+    if (aType == P2SH) {
       if (result.data()[0] != 5) {
         if(caseSensitive)
-          printf("Ignoring prefix \"%s\" (Unreachable, 31h1 to 3R2c only)\n", prefix.c_str());
+          message("Ignoring prefix \"%s\" (Unreachable, 31h1 to 3R2c only)\n", prefix);
         return false;
       }
     }
 
     if (result.size() != 25) {
-      printf("Ignoring prefix \"%s\" (Invalid size)\n", prefix.c_str());
+      message("Ignoring prefix \"%s\" (Invalid size)\n", prefix);
       return false;
     }
 
@@ -517,8 +1536,8 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
     it->difficulty = pow(2, 192) / pow(58, nbDigit);
     it->isFull = false;
     it->lPrefix = 0;
-    it->prefix = (char *)prefix.c_str();
-    it->prefixLength = (int)prefix.length();
+    it->prefix = prefix;
+    it->prefixLength = length;
 
     return true;
 
@@ -530,12 +1549,18 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
 void VanitySearch::dumpPrefixes() {
 
   for (int i = 0; i < 0xFFFF; i++) {
-    if (prefixes[i].items) {
+    if (prefixes[i].count) {
       printf("%04X\n", i);
-      for (int j = 0; j < (int)prefixes[i].items->size(); j++) {
-        printf("  %d\n", (*prefixes[i].items)[j].sPrefix);
-        printf("  %g\n", (*prefixes[i].items)[j].difficulty);
-        printf("  %s\n", (*prefixes[i].items)[j].prefix);
+      PREFIX_ENTRY *pe = prefixEntries + prefixes[i].offset;
+      for (int j = 0; j < (int)prefixes[i].count; j++) {
+        printf("  %d\n", pe[j].sPrefix);
+        printf("  %g\n", prefixDifficulty[pe[j].input]);
+        if (pe[j].isFull) {
+          vector<unsigned char> h(prefixData + pe[j].data, prefixData + pe[j].data + 20);
+          printf("  %s\n", GetHex(h).c_str());
+        } else {
+          printf("  %s\n", (char *)(prefixData + pe[j].data));
+        }
       }
     }
   }
@@ -543,19 +1568,25 @@ void VanitySearch::dumpPrefixes() {
 }
 // ----------------------------------------------------------------------------
 
-void VanitySearch::enumCaseUnsentivePrefix(std::string s, std::vector<std::string> &list) {
+double VanitySearch::enumCaseUnsentivePrefix(std::string s, std::vector<std::string> &list) {
 
-  char letter[64];
-  int letterpos[64];
+  // Letters which are not in the base58 alphabet in one case
+  // (i, o and l) have a single combination
+  int letterpos[CASE_LEADING_LENGTH];
   int nbLetter = 0;
+  double nbOther = 1.0;
   int length = (int)s.length();
 
   for (int i = 1; i < length; i++) {
-    char c = s.data()[i];
-    if( (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ) {
-      letter[nbLetter] = tolower(c);
-      letterpos[nbLetter] = i;
-      nbLetter++;
+    char c = (char)tolower(s[i]);
+    if (c >= 'a' && c <= 'z') {
+      bool lowerOk = (c != 'l');
+      bool upperOk = (c != 'i' && c != 'o');
+      s[i] = lowerOk ? c : (char)toupper(c);
+      if (lowerOk && upperOk) {
+        if (i < CASE_LEADING_LENGTH) letterpos[nbLetter++] = i;
+        else                         nbOther *= 2.0;
+      }
     }
   }
 
@@ -563,19 +1594,18 @@ void VanitySearch::enumCaseUnsentivePrefix(std::string s, std::vector<std::strin
 
   for (int i = 0; i < total; i++) {
 
-    char tmp[64];
-    strcpy(tmp, s.c_str());
+    string tmp = s;
 
     for (int j = 0; j < nbLetter; j++) {
-      int mask = 1 << j;
-      if (mask&i) tmp[letterpos[j]] = toupper(letter[j]);
-      else         tmp[letterpos[j]] = letter[j];
+      if (i & (1 << j)) tmp[letterpos[j]] = (char)toupper(tmp[letterpos[j]]);
     }
 
-    list.push_back(string(tmp));
+    list.push_back(tmp);
 
   }
 
+  return nbOther;
+
 }
 
 // ----------------------------------------------------------------------------
@@ -587,16 +1617,10 @@ double VanitySearch::getDiffuclty() {
   if (onlyFull)
     return min;
 
-  for (int i = 0; i < (int)usedPrefix.size(); i++) {
-    int p = usedPrefix[i];
-    if (prefixes[p].items) {
-      for (int j = 0; j < (int)prefixes[p].items->size(); j++) {
-        if (!*((*prefixes[p].items)[j].found)) {
-          if ((*prefixes[p].items)[j].difficulty < min)
-            min = (*prefixes[p].items)[j].difficulty;
-        }
-      }
-    }
+  // Sorted by difficulty
+  for (int i = 0; i < (int)difficulties.size(); i++) {
+    if (difficulties[i].left)
+      return difficulties[i].difficulty;
   }
 
   return min;
@@ -666,7 +1690,7 @@ string VanitySearch::GetExpectedTime(double keyRate,double keyCount) {
 
 // ----------------------------------------------------------------------------
 
-void VanitySearch::output(string addr,string pAddr,string pAddrHex) {
+void VanitySearch::output(int type,string addr,string pAddr,string pAddrHex) {
 
 #ifdef WIN64
    WaitForSingleObject(ghMutex,INFINITE);
@@ -674,13 +1698,26 @@ void VanitySearch::output(string addr,string pAddr,string pAddrHex) {
   pthread_mutex_lock(&ghMutex);
 #endif
 
+  if (type == ETH)
+    addr = Secp256K1::GetEIP55Address(addr);
+
+  if (foundCallback) {
+    foundCallback(foundUser, addr, pAddr, pAddrHex);
+#ifdef WIN64
+    ReleaseMutex(ghMutex);
+#else
+    pthread_mutex_unlock(&ghMutex);
+#endif
+    return;
+  }
+
   FILE *f = stdout;
   bool needToClose = false;
 
   if (outputFile.length() > 0) {
     f = fopen(outputFile.c_str(), "a");
     if (f == NULL) {
-      printf("Cannot open %s for writing\n", outputFile.c_str());
+      message("Cannot open %s for writing\n", outputFile.c_str());
       f = stdout;
     } else {
       needToClose = true;
@@ -698,7 +1735,7 @@ void VanitySearch::output(string addr,string pAddr,string pAddrHex) {
 
   } else {
 
-    switch (searchType) {
+    switch (type) {
     case P2PKH:
       fprintf(f, "Priv (WIF): p2pkh:%s\n", pAddr.c_str());
       break;
@@ -708,6 +1745,19 @@ void VanitySearch::output(string addr,string pAddr,string pAddrHex) {
     case BECH32:
       fprintf(f, "Priv (WIF): p2wpkh:%s\n", pAddr.c_str());
       break;
+    case XONLY:
+      fprintf(f, "Priv (WIF): %s\n", pAddr.c_str());
+      if (hrp == "npub") {
+        // Nostr secret key
+        Int k;
+        uint8_t b[32];
+        char nsec[128];
+        k.SetBase16((char *)pAddrHex.c_str());
+        k.Get32Bytes(b);
+        if (bech32_encode_bytes(nsec, "nsec", b, 32))
+          fprintf(f, "Priv (NSEC): %s\n", nsec);
+      }
+      break;
     }
     fprintf(f, "Priv (HEX): 0x%s\n", pAddrHex.c_str());
 
@@ -742,21 +1792,7 @@ void VanitySearch::updateFound() {
 
     } else {
 
-      bool allFound = true;
-      for (int i = 0; i < (int)usedPrefix.size(); i++) {
-        bool iFound = true;
-        prefix_t p = usedPrefix[i];
-        if (!prefixes[p].found) {
-          if (prefixes[p].items) {
-            for (int j = 0; j < (int)prefixes[p].items->size(); j++) {
-              iFound &= *((*prefixes[p].items)[j].found);
-            }
-          }
-          prefixes[usedPrefix[i]].found = iFound;
-        }
-        allFound &= iFound;
-      }
-      endOfSearch = allFound;
+      endOfSearch = (nbInputLeft == 0);
 
       // Update difficulty to the next most probable item
       _difficulty = getDiffuclty();
@@ -769,7 +1805,7 @@ void VanitySearch::updateFound() {
 
 // ----------------------------------------------------------------------------
 
-bool VanitySearch::checkPrivKey(string addr, Int &key, int32_t incr, int endomorphism, bool mode) {
+bool VanitySearch::checkPrivKey(int type, string addr, Int &key, int32_t incr, int endomorphism, bool mode) {
 
   Int k(&key);
   Point sp = startPubKey;
@@ -796,32 +1832,28 @@ bool VanitySearch::checkPrivKey(string addr, Int &key, int32_t incr, int endomor
   }
 
   // Check addresses
-  Point p = secp->ComputePublicKey(&k);
-  if (startPubKeySpecified) p = secp->AddDirect(p, sp);
+  Point p = secp->ComputePublicKey(&k, startPubKeySpecified ? &sp : NULL);
 
-  string chkAddr = secp->GetAddress(searchType, mode, p);
+  string chkAddr = getAddress(type, mode, p);
   if (chkAddr != addr) {
 
     //Key may be the opposite one (negative zero or compressed key)
+    // (n-k)*G - sp = -(k*G + sp)
     k.Neg();
-    k.Add(&secp->order);
-    p = secp->ComputePublicKey(&k);
-    if (startPubKeySpecified) {
-      sp.y.ModNeg();
-      p = secp->AddDirect(p, sp);
-    }
-    string chkAddr = secp->GetAddress(searchType, mode, p);
+    k.Add(&secp->order);
+    p.y.ModNeg();
+    string chkAddr = getAddress(type, mode, p);
     if (chkAddr != addr) {
-      printf("\nWarning, wrong private key generated !\n");
-      printf("  Addr :%s\n", addr.c_str());
-      printf("  Check:%s\n", chkAddr.c_str());
-      printf("  Endo:%d incr:%d comp:%d\n", endomorphism, incr, mode);
+      message("\nWarning, wrong private key generated !\n");
+      message("  Addr :%s\n", addr.c_str());
+      message("  Check:%s\n", chkAddr.c_str());
+      message("  Endo:%d incr:%d comp:%d\n", endomorphism, incr, mode);
       return false;
     }
 
   }
 
-  output(addr, secp->GetPrivAddress(mode ,k), k.GetBase16());
+  output(type, addr, secp->GetPrivAddress(mode ,k), k.GetBase16());
 
   return true;
 
@@ -835,11 +1867,11 @@ void VanitySearch::checkAddrSSE(uint8_t *h1, uint8_t *h2, uint8_t *h3, uint8_t *
 
   for (int i = 0; i < (int)inputPrefixes.size(); i++) {
 
-    if (Wildcard::match(addr[0].c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+    if (Wildcard::match(addr[0].c_str(), inputPrefixes[i], caseSensitive)) {
 
       // Found it !
       //*((*pi)[i].found) = true;
-      if (checkPrivKey(addr[0], key, incr1, endomorphism, mode)) {
+      if (checkPrivKey(searchType, addr[0], key, incr1, endomorphism, mode)) {
         nbFoundKey++;
         patternFound[i] = true;
         updateFound();
@@ -847,11 +1879,11 @@ void VanitySearch::checkAddrSSE(uint8_t *h1, uint8_t *h2, uint8_t *h3, uint8_t *
 
     }
 
-    if (Wildcard::match(addr[1].c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+    if (Wildcard::match(addr[1].c_str(), inputPrefixes[i], caseSensitive)) {
 
       // Found it !
       //*((*pi)[i].found) = true;
-      if (checkPrivKey(addr[1], key, incr2, endomorphism, mode)) {
+      if (checkPrivKey(searchType, addr[1], key, incr2, endomorphism, mode)) {
         nbFoundKey++;
         patternFound[i] = true;
         updateFound();
@@ -859,11 +1891,11 @@ void VanitySearch::checkAddrSSE(uint8_t *h1, uint8_t *h2, uint8_t *h3, uint8_t *
 
     }
 
-    if (Wildcard::match(addr[2].c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+    if (Wildcard::match(addr[2].c_str(), inputPrefixes[i], caseSensitive)) {
 
       // Found it !
       //*((*pi)[i].found) = true;
-      if (checkPrivKey(addr[2], key, incr3, endomorphism, mode)) {
+      if (checkPrivKey(searchType, addr[2], key, incr3, endomorphism, mode)) {
         nbFoundKey++;
         patternFound[i] = true;
         updateFound();
@@ -871,11 +1903,11 @@ void VanitySearch::checkAddrSSE(uint8_t *h1, uint8_t *h2, uint8_t *h3, uint8_t *
 
     }
 
-    if (Wildcard::match(addr[3].c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+    if (Wildcard::match(addr[3].c_str(), inputPrefixes[i], caseSensitive)) {
 
       // Found it !
       //*((*pi)[i].found) = true;
-      if (checkPrivKey(addr[3], key, incr4, endomorphism, mode)) {
+      if (checkPrivKey(searchType, addr[3], key, incr4, endomorphism, mode)) {
         nbFoundKey++;
         patternFound[i] = true;
         updateFound();
@@ -890,18 +1922,34 @@ void VanitySearch::checkAddrSSE(uint8_t *h1, uint8_t *h2, uint8_t *h3, uint8_t *
 
 void VanitySearch::checkAddr(int prefIdx, uint8_t *hash160, Int &key, int32_t incr, int endomorphism, bool mode) {
 
+  if (hashType != P2PKH || typeMask == (1U << searchType)) {
+    checkAddrType(searchType, prefIdx, hash160, key, incr, endomorphism, mode);
+    return;
+  }
+
+  // Mixed search, P2PKH and BECH32 addresses share the hash160
+  // (BECH32 and P2SH are checked for compressed keys only)
+  if (typeMask & (1 << P2PKH))
+    checkAddrType(P2PKH, prefIdx, hash160, key, incr, endomorphism, mode);
+  if ((typeMask & (1 << BECH32)) && mode)
+    checkAddrType(BECH32, prefIdx, hash160, key, incr, endomorphism, mode);
+
+}
+
+void VanitySearch::checkAddrType(int type, int prefIdx, uint8_t *hash160, Int &key, int32_t incr, int endomorphism, bool mode) {
+
   if (hasPattern) {
 
     // Wildcard search
-    string addr = secp->GetAddress(searchType, mode, hash160);
+    string addr = getAddress(type, mode, hash160);
 
     for (int i = 0; i < (int)inputPrefixes.size(); i++) {
 
-      if (Wildcard::match(addr.c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+      if (Wildcard::match(addr.c_str(), inputPrefixes[i], caseSensitive)) {
 
         // Found it !
         //*((*pi)[i].found) = true;
-        if (checkPrivKey(addr, key, incr, endomorphism, mode)) {
+        if (checkPrivKey(type, addr, key, incr, endomorphism, mode)) {
           nbFoundKey++;
           patternFound[i] = true;
           updateFound();
@@ -915,60 +1963,103 @@ void VanitySearch::checkAddr(int prefIdx, uint8_t *hash160, Int &key, int32_t in
 
   }
 
-  vector<PREFIX_ITEM> *pi = prefixes[prefIdx].items;
-
-  if (onlyFull) {
-
-    // Full addresses
-    for (int i = 0; i < (int)pi->size(); i++) {
+  PREFIX_ENTRY *pe = prefixEntries + prefixes[prefIdx].offset;
+  int nbItem = (int)prefixes[prefIdx].count;
+  int nbPrefixItem = 0;
+  bool hit = false;
+  string addr;
+
+  // Prefixes come first in the bucket
+  if (!onlyFull) {
+    int st = 0;
+    int ed = nbItem;
+    while (st < ed) {
+      int mi = (st + ed) / 2;
+      if (!pe[mi].isFull) st = mi + 1;
+      else                ed = mi;
+    }
+    nbPrefixItem = st;
+  }
 
-      if (stopWhenFound && *((*pi)[i].found))
-        continue;
+  if (nbPrefixItem > 0) {
 
-      if (ripemd160_comp_hash((*pi)[i].hash160, hash160)) {
+    addr = getAddress(type, mode, hash160);
+    string folded;
+    if (!caseSensitive) {
+      folded = addr;
+      for (int j = 0; j < (int)folded.length(); j++)
+        folded[j] = (char)tolower(folded[j]);
+    }
+    const char *a = caseSensitive ? addr.c_str() : folded.c_str();
+    bool fold = (searchType == ETH);
+
+    // Last prefix lower or equal to the address, the matching prefixes
+    // are this one and its enclosing prefixes
+    int st = 0;
+    int ed = nbPrefixItem;
+    while (st < ed) {
+      int mi = (st + ed) / 2;
+      if (prefixCompare((char *)(prefixData + pe[mi].data), a, (size_t)-1, fold) <= 0) st = mi + 1;
+      else                                                                     ed = mi;
+    }
 
-        // Found it !
-        *((*pi)[i].found) = true;
-        // You believe it ?
-        if (checkPrivKey(secp->GetAddress(searchType, mode, hash160), key, incr, endomorphism, mode)) {
-          nbFoundKey++;
-          updateFound();
+    int i = st - 1;
+    while (i >= 0) {
+      char *p = (char *)(prefixData + pe[i].data);
+      if (prefixCompare(p, a, pe[i].length, fold) == 0 && checksumMatch(p, addr)) {
+        if (!stopWhenFound || !isFound(pe[i].input)) {
+          // Found it !
+          if (setFound(pe[i].input))
+            foundInput(pe[i].input, (uint32_t)(pe + i - prefixEntries));
+          hit = true;
         }
-
       }
-
+      if (pe[i].parent == 0)
+        break;
+      i -= pe[i].parent;
     }
 
-  } else {
-
-
-    char a[64];
+  }
 
-    string addr = secp->GetAddress(searchType, mode, hash160);
+  if (nbPrefixItem < nbItem) {
+
+    // Full addresses, sorted by lPrefix
+    prefixl_t l;
+    memcpy(&l, hash160, sizeof(prefixl_t));
+    int st = nbPrefixItem;
+    int ed = nbItem;
+    while (st < ed) {
+      int mi = (st + ed) / 2;
+      if (pe[mi].lPrefix < l) st = mi + 1;
+      else                    ed = mi;
+    }
 
-    for (int i = 0; i < (int)pi->size(); i++) {
+    for (int i = st; i < nbItem && pe[i].lPrefix == l; i++) {
 
-      if (stopWhenFound && *((*pi)[i].found))
+      if (pe[i].type != type || (stopWhenFound && isFound(pe[i].input)))
         continue;
 
-      strncpy(a, addr.c_str(), (*pi)[i].prefixLength);
-      a[(*pi)[i].prefixLength] = 0;
-
-      if (strcmp((*pi)[i].prefix, a) == 0) {
-
+      if (ripemd160_comp_hash(prefixData + pe[i].data, hash160)) {
         // Found it !
-        *((*pi)[i].found) = true;
-        if (checkPrivKey(addr, key, incr, endomorphism, mode)) {
-          nbFoundKey++;
-          updateFound();
-        }
-
+        if (setFound(pe[i].input))
+          foundInput(pe[i].input, (uint32_t)(pe + i - prefixEntries));
+        hit = true;
       }
 
     }
 
   }
 
+  // Duplicate and enclosing prefixes are reported once
+  if (hit) {
+    if (addr.length() == 0)
+      addr = getAddress(type, mode, hash160);
+    // You believe it ?
+    if (checkPrivKey(type, addr, key, incr, endomorphism, mode)) {
+      nbFoundKey++;
+      updateFound();
+    }
+  }
 }
 
 // ----------------------------------------------------------------------------
@@ -995,175 +2086,298 @@ void *_FindKeyGPU(void *lpParam) {
 
 // ----------------------------------------------------------------------------
 
-void VanitySearch::checkAddresses(bool compressed, Int key, int i, Point p1) {
+bool VanitySearch::checksumMatch(char *p, string &addr) {
+
+  // EIP-55: a prefix having upper case letters must match the checksum case
+  // (the entry text keeps the case of the input prefix)
+  if (searchType != ETH || !caseSensitive)
+    return true;
+
+  bool hasUpper = false;
+  for (int i = 2; p[i] != 0 && !hasUpper; i++)
+    hasUpper = (p[i] >= 'A' && p[i] <= 'F');
+  if (!hasUpper)
+    return true;
+
+  string chk = Secp256K1::GetEIP55Address(addr);
+  return strncmp(chk.c_str() + 2, p + 2, strlen(p) - 2) == 0;
+
+}
+
+string VanitySearch::getAddress(int type, bool mode, uint8_t *h) {
+
+  if (type != XONLY)
+    return secp->GetAddress(type, mode, h);
+
+  // h is x (32 bytes)
+  char addr[128];
+  if (!bech32_encode_bytes(addr, hrp.c_str(), h, 32))
+    return "";
+  return string(addr);
+
+}
+
+string VanitySearch::getAddress(int type, bool mode, Point &p) {
+
+  if (type != XONLY)
+    return secp->GetAddress(type, mode, p);
+
+  uint8_t x[32];
+  p.x.Get32Bytes(x);
+  return getAddress(type, mode, x);
+
+}
+
+// ----------------------------------------------------------------------------
+
+// Search kernels
+// The group step and the checks are instantiated for each address type,
+// search mode, matcher and SIMD width, one of them is selected at startup
+// (selectKernel()). Template parameters are constants in the hot loop.
+
+// Hash computed for each key
+#define HASH_TYPE(type,matcher) (((matcher) >= MATCH_MIXED || (type) == BECH32) ? P2PKH : (type))
+
+void VanitySearch::addCandidate(CPU_GROUP *g, uint8_t *h, int32_t incr, int endomorphism, bool mode, bool script) {
+
+  HASH_CANDIDATE *c = g->cand + g->nbCand++;
+  memcpy(c->hash, h, 20);
+  c->incr = incr;
+  c->endo = (int8_t)endomorphism;
+  c->mode = mode;
+  c->script = script;
+  _mm_prefetch((const char *)&prefixes[*(prefix_t *)h], _MM_HINT_T0);
+
+}
+
+// Lookup pass, the buckets have been prefetched by the hash stage
+template<int type, int matcher>
+void VanitySearch::checkCandidates(CPU_GROUP *g, Int &key) {
+
+  for (int n = 0; n < g->nbCand; n++) {
+
+    HASH_CANDIDATE *c = g->cand + n;
+
+    if (matcher == MATCH_SUFFIX) {
+      checkAddrType(type, 0, c->hash, key, c->incr, c->endo, c->mode);
+      continue;
+    }
+
+    prefix_t pr = *(prefix_t *)c->hash;
+    if (prefixes[pr].count == 0)
+      continue;
+    if (matcher == MATCH_MIXED_P2SH && c->script)
+      checkAddrType(P2SH, pr, c->hash, key, c->incr, c->endo, c->mode);
+    else if (matcher == MATCH_PREFIX)
+      checkAddrType(type, pr, c->hash, key, c->incr, c->endo, c->mode);
+    else
+      checkAddr(pr, c->hash, key, c->incr, c->endo, c->mode);
+
+  }
+  g->nbCand = 0;
+
+}
+
+template<int type, bool compressed, int matcher>
+void VanitySearch::checkHash(CPU_GROUP *g, uint8_t *h, Int &key, int32_t incr, int endomorphism) {
+
+  if (matcher == MATCH_PATTERN) {
+    checkAddrType(type, 0, h, key, incr, endomorphism, compressed);
+    return;
+  }
+
+  if (matcher == MATCH_SUFFIX) {
+    if (suffix.Match(h))
+      addCandidate(g, h, incr, endomorphism, compressed, false);
+    return;
+  }
+
+  addCandidate(g, h, incr, endomorphism, compressed, false);
+  if (matcher == MATCH_MIXED_P2SH && compressed) {
+    uint8_t sh[20];
+    secp->GetScriptHash(h, sh);
+    addCandidate(g, sh, incr, endomorphism, compressed, true);
+  }
+
+}
+
+template<int type, bool compressed, int matcher>
+void VanitySearch::checkHashes(CPU_GROUP *g, uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3,
+                               int32_t incr0, int32_t incr1, int32_t incr2, int32_t incr3,
+                               Int &key, int endomorphism) {
+
+  if (matcher == MATCH_PATTERN) {
+    checkAddrSSE(h0, h1, h2, h3, incr0, incr1, incr2, incr3, key, endomorphism, compressed);
+    return;
+  }
+
+  if (matcher == MATCH_SUFFIX) {
+    bool m[4];
+    suffix.Match(h0, h1, h2, h3, m);
+    if (m[0]) addCandidate(g, h0, incr0, endomorphism, compressed, false);
+    if (m[1]) addCandidate(g, h1, incr1, endomorphism, compressed, false);
+    if (m[2]) addCandidate(g, h2, incr2, endomorphism, compressed, false);
+    if (m[3]) addCandidate(g, h3, incr3, endomorphism, compressed, false);
+    return;
+  }
+
+  addCandidate(g, h0, incr0, endomorphism, compressed, false);
+  addCandidate(g, h1, incr1, endomorphism, compressed, false);
+  addCandidate(g, h2, incr2, endomorphism, compressed, false);
+  addCandidate(g, h3, incr3, endomorphism, compressed, false);
+
+  if (matcher == MATCH_MIXED_P2SH && compressed) {
+    // Script hashes are computed 4 at a time
+    uint8_t sh0[20];
+    uint8_t sh1[20];
+    uint8_t sh2[20];
+    uint8_t sh3[20];
+    secp->GetScriptHash(h0, h1, h2, h3, sh0, sh1, sh2, sh3);
+    addCandidate(g, sh0, incr0, endomorphism, compressed, true);
+    addCandidate(g, sh1, incr1, endomorphism, compressed, true);
+    addCandidate(g, sh2, incr2, endomorphism, compressed, true);
+    addCandidate(g, sh3, incr3, endomorphism, compressed, true);
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+template<int matcher>
+void VanitySearch::checkXOnly(Int &key, int i, PointK1 &p1) {
+
+  // No hash, the lookup is done on the 16 upper bits of x.
+  // Symmetric points have the same x: 3 keys per point.
+  unsigned char h0[32];
+  FieldK1 x[3];
+  x[0].Set(&p1.x);
+  x[1].ModMulK1(&p1.x, &betaK1);
+  x[2].ModMulK1(&p1.x, &beta2K1);
+  x[1].Normalize();
+  x[2].Normalize();
+
+  for (int e = 0; e < 3; e++) {
+    uint64_t top = x[e].bits64[3];
+    prefix_t pr0 = (prefix_t)(((top >> 56) & 0xFF) | ((top >> 40) & 0xFF00));
+    if (matcher == MATCH_PATTERN || prefixes[pr0].count) {
+      x[e].Get32Bytes(h0);
+      checkAddrType(XONLY, pr0, h0, key, i, e, true);
+    }
+  }
+
+}
 
+// ----------------------------------------------------------------------------
+
+template<int type, bool compressed, int matcher>
+void VanitySearch::checkAddresses(CPU_GROUP *g, Int &key, int i, PointK1 p1) {
+
+  const int hType = HASH_TYPE(type, matcher);
   unsigned char h0[20];
-  Point pte1[1];
-  Point pte2[1];
+  PointK1 pte1[1];
+  PointK1 pte2[1];
 
   // Point
-  secp->GetHash160(searchType,compressed, p1, h0);
-  prefix_t pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, i, 0, compressed);
+  secp->GetHash160<hType, compressed>(p1, h0);
+
+  checkHash<type, compressed, matcher>(g, h0, key, i, 0);
 
   // Endomorphism #1
-  pte1[0].x.ModMulK1(&p1.x, &beta);
+  pte1[0].x.ModMulK1(&p1.x, &betaK1);
+  pte1[0].x.Normalize();
   pte1[0].y.Set(&p1.y);
 
-  secp->GetHash160(searchType, compressed, pte1[0], h0);
+  secp->GetHash160<hType, compressed>(pte1[0], h0);
 
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, i, 1, compressed);
+  checkHash<type, compressed, matcher>(g, h0, key, i, 1);
 
   // Endomorphism #2
-  pte2[0].x.ModMulK1(&p1.x, &beta2);
+  pte2[0].x.ModMulK1(&p1.x, &beta2K1);
+  pte2[0].x.Normalize();
   pte2[0].y.Set(&p1.y);
 
-  secp->GetHash160(searchType, compressed, pte2[0], h0);
+  secp->GetHash160<hType, compressed>(pte2[0], h0);
 
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, i, 2, compressed);
+  checkHash<type, compressed, matcher>(g, h0, key, i, 2);
 
   // Curve symetrie
   // if (x,y) = k*G, then (x, -y) is -k*G
   p1.y.ModNeg();
-  secp->GetHash160(searchType, compressed, p1, h0);
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, -i, 0, compressed);
+  secp->GetHash160<hType, compressed>(p1, h0);
+
+  checkHash<type, compressed, matcher>(g, h0, key, -i, 0);
 
   // Endomorphism #1
   pte1[0].y.ModNeg();
 
-  secp->GetHash160(searchType, compressed, pte1[0], h0);
+  secp->GetHash160<hType, compressed>(pte1[0], h0);
 
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, -i, 1, compressed);
+  checkHash<type, compressed, matcher>(g, h0, key, -i, 1);
 
   // Endomorphism #2
   pte2[0].y.ModNeg();
 
-  secp->GetHash160(searchType, compressed, pte2[0], h0);
+  secp->GetHash160<hType, compressed>(pte2[0], h0);
 
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, -i, 2, compressed);
+  checkHash<type, compressed, matcher>(g, h0, key, -i, 2);
 
 }
 
 // ----------------------------------------------------------------------------
 
-void VanitySearch::checkAddressesSSE(bool compressed,Int key, int i, Point p1, Point p2, Point p3, Point p4) {
+template<int type, bool compressed, int matcher>
+void VanitySearch::checkAddressesSSE(CPU_GROUP *g, Int &key, int i, PointK1 p1, PointK1 p2, PointK1 p3, PointK1 p4) {
 
+  const int hType = HASH_TYPE(type, matcher);
   unsigned char h0[20];
   unsigned char h1[20];
   unsigned char h2[20];
   unsigned char h3[20];
-  Point pte1[4];
-  Point pte2[4];
-  prefix_t pr0;
-  prefix_t pr1;
-  prefix_t pr2;
-  prefix_t pr3;
+  PointK1 pte1[4];
+  PointK1 pte2[4];
 
   // Point -------------------------------------------------------------------------
-  secp->GetHash160(searchType, compressed, p1, p2, p3, p4, h0, h1, h2, h3);
-
-  if (!hasPattern) {
-
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
-
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, i, 0, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, i + 1, 0, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, i + 2, 0, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, i + 3, 0, compressed);
-
-  } else {
-
-    checkAddrSSE(h0,h1,h2,h3,i,i+1,i+2,i+3,key,0,compressed);
+  secp->GetHash160<hType, compressed>(p1, p2, p3, p4, h0, h1, h2, h3);
 
-  }
+  checkHashes<type, compressed, matcher>(g, h0, h1, h2, h3, i, i + 1, i + 2, i + 3, key, 0);
 
   // Endomorphism #1
   // if (x, y) = k * G, then (beta*x, y) = lambda*k*G
-  pte1[0].x.ModMulK1(&p1.x, &beta);
+  pte1[0].x.ModMulK1(&p1.x, &betaK1);
+  pte1[0].x.Normalize();
   pte1[0].y.Set(&p1.y);
-  pte1[1].x.ModMulK1(&p2.x, &beta);
+  pte1[1].x.ModMulK1(&p2.x, &betaK1);
+  pte1[1].x.Normalize();
   pte1[1].y.Set(&p2.y);
-  pte1[2].x.ModMulK1(&p3.x, &beta);
+  pte1[2].x.ModMulK1(&p3.x, &betaK1);
+  pte1[2].x.Normalize();
   pte1[2].y.Set(&p3.y);
-  pte1[3].x.ModMulK1(&p4.x, &beta);
+  pte1[3].x.ModMulK1(&p4.x, &betaK1);
+  pte1[3].x.Normalize();
   pte1[3].y.Set(&p4.y);
 
-  secp->GetHash160(searchType, compressed, pte1[0], pte1[1], pte1[2], pte1[3], h0, h1, h2, h3);
-
-  if (!hasPattern) {
-
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
-
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, i, 1, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, (i + 1), 1, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, (i + 2), 1, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, (i + 3), 1, compressed);
-
-  } else {
-
-    checkAddrSSE(h0, h1, h2, h3, i, i + 1, i + 2, i + 3, key, 1, compressed);
+  secp->GetHash160<hType, compressed>(pte1[0], pte1[1], pte1[2], pte1[3], h0, h1, h2, h3);
 
-  }
+  checkHashes<type, compressed, matcher>(g, h0, h1, h2, h3, i, i + 1, i + 2, i + 3, key, 1);
 
   // Endomorphism #2
   // if (x, y) = k * G, then (beta2*x, y) = lambda2*k*G
-  pte2[0].x.ModMulK1(&p1.x, &beta2);
+  pte2[0].x.ModMulK1(&p1.x, &beta2K1);
+  pte2[0].x.Normalize();
   pte2[0].y.Set(&p1.y);
-  pte2[1].x.ModMulK1(&p2.x, &beta2);
+  pte2[1].x.ModMulK1(&p2.x, &beta2K1);
+  pte2[1].x.Normalize();
   pte2[1].y.Set(&p2.y);
-  pte2[2].x.ModMulK1(&p3.x, &beta2);
+  pte2[2].x.ModMulK1(&p3.x, &beta2K1);
+  pte2[2].x.Normalize();
   pte2[2].y.Set(&p3.y);
-  pte2[3].x.ModMulK1(&p4.x, &beta2);
+  pte2[3].x.ModMulK1(&p4.x, &beta2K1);
+  pte2[3].x.Normalize();
   pte2[3].y.Set(&p4.y);
 
-  secp->GetHash160(searchType, compressed, pte2[0], pte2[1], pte2[2], pte2[3], h0, h1, h2, h3);
-
-  if (!hasPattern) {
-
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
-
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, i, 2, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, (i + 1), 2, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, (i + 2), 2, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, (i + 3), 2, compressed);
-
-  } else {
-
-    checkAddrSSE(h0, h1, h2, h3, i, i + 1, i + 2, i + 3, key, 2, compressed);
+  secp->GetHash160<hType, compressed>(pte2[0], pte2[1], pte2[2], pte2[3], h0, h1, h2, h3);
 
-  }
+  checkHashes<type, compressed, matcher>(g, h0, h1, h2, h3, i, i + 1, i + 2, i + 3, key, 2);
 
   // Curve symetrie -------------------------------------------------------------------------
   // if (x,y) = k*G, then (x, -y) is -k*G
@@ -1173,29 +2387,9 @@ void VanitySearch::checkAddressesSSE(bool compressed,Int key, int i, Point p1, P
   p3.y.ModNeg();
   p4.y.ModNeg();
 
-  secp->GetHash160(searchType, compressed, p1, p2, p3, p4, h0, h1, h2, h3);
-
-  if (!hasPattern) {
-
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
-
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, -i, 0, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, -(i + 1), 0, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, -(i + 2), 0, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, -(i + 3), 0, compressed);
-
-  } else {
-
-    checkAddrSSE(h0, h1, h2, h3, -i, -(i + 1), -(i + 2), -(i + 3), key, 0, compressed);
+  secp->GetHash160<hType, compressed>(p1, p2, p3, p4, h0, h1, h2, h3);
 
-  }
+  checkHashes<type, compressed, matcher>(g, h0, h1, h2, h3, -i, -(i + 1), -(i + 2), -(i + 3), key, 0);
 
   // Endomorphism #1
   // if (x, y) = k * G, then (beta*x, y) = lambda*k*G
@@ -1205,29 +2399,9 @@ void VanitySearch::checkAddressesSSE(bool compressed,Int key, int i, Point p1, P
   pte1[3].y.ModNeg();
 
 
-  secp->GetHash160(searchType, compressed, pte1[0], pte1[1], pte1[2], pte1[3], h0, h1, h2, h3);
-
-  if (!hasPattern) {
-
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
-
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, -i, 1, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, -(i + 1), 1, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, -(i + 2), 1, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, -(i + 3), 1, compressed);
-
-  } else {
-
-    checkAddrSSE(h0, h1, h2, h3, -i, -(i + 1), -(i + 2), -(i + 3), key, 1, compressed);
+  secp->GetHash160<hType, compressed>(pte1[0], pte1[1], pte1[2], pte1[3], h0, h1, h2, h3);
 
-  }
+  checkHashes<type, compressed, matcher>(g, h0, h1, h2, h3, -i, -(i + 1), -(i + 2), -(i + 3), key, 1);
 
   // Endomorphism #2
   // if (x, y) = k * G, then (beta2*x, y) = lambda2*k*G
@@ -1236,48 +2410,37 @@ void VanitySearch::checkAddressesSSE(bool compressed,Int key, int i, Point p1, P
   pte2[2].y.ModNeg();
   pte2[3].y.ModNeg();
 
-  secp->GetHash160(searchType, compressed, pte2[0], pte2[1], pte2[2], pte2[3], h0, h1, h2, h3);
-
-  if (!hasPattern) {
-
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
+  secp->GetHash160<hType, compressed>(pte2[0], pte2[1], pte2[2], pte2[3], h0, h1, h2, h3);
 
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, -i, 2, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, -(i + 1), 2, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, -(i + 2), 2, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, -(i + 3), 2, compressed);
+  checkHashes<type, compressed, matcher>(g, h0, h1, h2, h3, -i, -(i + 1), -(i + 2), -(i + 3), key, 2);
 
-  } else {
+}
 
-    checkAddrSSE(h0, h1, h2, h3, -i, -(i + 1), -(i + 2), -(i + 3), key, 2, compressed);
+// ----------------------------------------------------------------------------
+void VanitySearch::randKey(int thId, Int &key) {
 
-  }
+  key.SetInt32(0);
+  chacha20_drbg_rand(rng + thId, (uint8_t *)key.bits64, 32);
 
 }
 
-// ----------------------------------------------------------------------------
-void VanitySearch::getCPUStartingKey(int thId,Int& key,Point& startP) {
+void VanitySearch::getCPUStartingKey(int thId,Int& key,Point *startP) {
 
   if (rekey > 0) {
-    key.Rand(256);
+    randKey(thId, key);
   } else {
     key.Set(&startKey);
     Int off((int64_t)thId);
     off.ShiftL(64);
     key.Add(&off);
   }
+  // Center points of the streams
   Int km(&key);
   km.Add((uint64_t)CPU_GRP_SIZE / 2);
-  startP = secp->ComputePublicKey(&km);
-  if(startPubKeySpecified)
-   startP = secp->AddDirect(startP,startPubKey);
+  for (int s = 0; s < CPU_GRP_STREAM; s++) {
+    startP[s] = secp->ComputePublicKey(&km, startPubKeySpecified ? &startPubKey : NULL);
+    km.Add((uint64_t)CPU_GRP_SIZE);
+  }
 
 }
 
@@ -1288,24 +2451,15 @@ void VanitySearch::FindKeyCPU(TH_PARAM *ph) {
   counters[thId] = 0;
 
   // CPU Thread
-  IntGroup *grp = new IntGroup(CPU_GRP_SIZE/2+1);
+  CPU_GROUP *g = new CPU_GROUP;
+  g->grp = new FieldGroup(CPU_GRP_STREAM * (CPU_GRP_SIZE / 2 + 1), CPU_GRP_STREAM);
+  g->grp->Set(g->dx);
 
   // Group Init
   Int  key;
-  Point startP;
+  Point startP[CPU_GRP_STREAM];
   getCPUStartingKey(thId,key,startP);
 
-  Int dx[CPU_GRP_SIZE/2+1];
-  Point pts[CPU_GRP_SIZE];
-
-  Int dy;
-  Int dyn;
-  Int _s;
-  Int _p;
-  Point pp;
-  Point pn;
-  grp->Set(dx);
-
   ph->hasStarted = true;
   ph->rekeyRequest = false;
 
@@ -1316,163 +2470,312 @@ void VanitySearch::FindKeyCPU(TH_PARAM *ph) {
       ph->rekeyRequest = false;
     }
 
-    // Fill group
-    int i;
-    int hLength = (CPU_GRP_SIZE / 2 - 1);
+    SearchGroupCPU(thId, key, startP, g);
 
-    for (i = 0; i < hLength; i++) {
-      dx[i].ModSub(&Gn[i].x, &startP.x);
-    }
-    dx[i].ModSub(&Gn[i].x, &startP.x);  // For the first point
-    dx[i+1].ModSub(&_2Gn.x, &startP.x); // For the next center point
-
-    // Grouped ModInv
-    grp->ModInv();
+  }
 
-    // We use the fact that P + i*G and P - i*G has the same deltax, so the same inverse
-    // We compute key in the positive and negative way from the center of the group
+  delete g->grp;
+  delete g;
+  ph->isRunning = false;
 
-    // center point
-    pts[CPU_GRP_SIZE/2] = startP;
+}
 
-    for (i = 0; i<hLength && !endOfSearch; i++) {
+// Group step, no y for x-only search (y is needed for the center point only)
+// Lazy reduction: intermediates stay in [0,2^256[, points are normalized
+// before hashing
+// The CPU_GRP_STREAM groups are stepped in lockstep: each operation is done
+// for all streams before the next one, so the multiplications are independent
+// and overlap. The stream groups share a single grouped ModInv.
+#define NS CPU_GRP_STREAM
+template<bool needY>
+void VanitySearch::computeGroup(Point *startPoint, CPU_GROUP *g) {
+
+  FieldGroup *grp = g->grp;
+  FieldK1 *dx = g->dx;
+  PointK1 *pts = g->pts;
+
+  FieldK1 dy[NS];
+  FieldK1 sx[NS];
+  FieldK1 _s[NS];
+  FieldK1 _p[NS];
+  PointK1 startP[NS];
+  PointK1 *pp[NS];
+  PointK1 *pn[NS];
+  int s;
+
+  for (s = 0; s < NS; s++)
+    startP[s].Set(startPoint[s]);
+
+  // Fill group, dx[i*NS + s] for stream s
+  int i;
+  int hLength = (CPU_GRP_SIZE / 2 - 1);
+
+  for (i = 0; i < hLength; i++) {
+    for (s = 0; s < NS; s++)
+      dx[i*NS + s].SubLazy(&Gn[i].x, &startP[s].x);
+  }
+  for (s = 0; s < NS; s++) {
+    dx[i*NS + s].SubLazy(&Gn[i].x, &startP[s].x);      // For the first point
+    dx[(i+1)*NS + s].SubLazy(&_SGn.x, &startP[s].x);   // For the next center point
+  }
 
-      pp = startP;
-      pn = startP;
+  // Grouped ModInv
+  grp->ModInv();
 
-      // P = startP + i*G
-      dy.ModSub(&Gn[i].y,&pp.y);
+  // We use the fact that P + i*G and P - i*G has the same deltax, so the same inverse
+  // We compute key in the positive and negative way from the center of the group
 
-      _s.ModMulK1(&dy, &dx[i]);       // s = (p2.y-p1.y)*inverse(p2.x-p1.x);
-      _p.ModSquareK1(&_s);            // _p = pow2(s)
+  // center point
+  for (s = 0; s < NS; s++)
+    pts[s*CPU_GRP_SIZE + CPU_GRP_SIZE/2] = startP[s];
 
-      pp.x.ModNeg();
-      pp.x.ModAdd(&_p);
-      pp.x.ModSub(&Gn[i].x);           // rx = pow2(s) - p1.x - p2.x;
+  for (i = 0; i<hLength && !endOfSearch; i++) {
 
-      pp.y.ModSub(&Gn[i].x, &pp.x);
-      pp.y.ModMulK1(&_s);
-      pp.y.ModSub(&Gn[i].y);           // ry = - p2.y - s*(ret.x-p2.x);
+    FieldK1 *dxi = dx + i*NS;
 
-      // P = startP - i*G  , if (x,y) = i*G then (x,-y) = -i*G
-      dyn.Set(&Gn[i].y);
-      dyn.ModNeg();
-      dyn.ModSub(&pn.y);
+    for (s = 0; s < NS; s++) {
+      pp[s] = pts + (s*CPU_GRP_SIZE + CPU_GRP_SIZE/2 + (i+1));
+      pn[s] = pts + (s*CPU_GRP_SIZE + CPU_GRP_SIZE/2 - (i+1));
+      sx[s].AddLazy(&startP[s].x, &Gn[i].x);  // p1.x + p2.x, same for both points
+    }
 
-      _s.ModMulK1(&dyn, &dx[i]);      // s = (p2.y-p1.y)*inverse(p2.x-p1.x);
-      _p.ModSquareK1(&_s);            // _p = pow2(s)
+    // P = startP + i*G
+    for (s = 0; s < NS; s++)
+      dy[s].SubLazy(&Gn[i].y, &startP[s].y);
+    for (s = 0; s < NS; s++)
+      _s[s].ModMulK1(&dy[s], &dxi[s]);      // s = (p2.y-p1.y)*inverse(p2.x-p1.x);
+    for (s = 0; s < NS; s++)
+      _p[s].ModSquareK1(&_s[s]);            // _p = pow2(s)
+    for (s = 0; s < NS; s++)
+      pp[s]->x.SubLazy(&_p[s], &sx[s]);     // rx = pow2(s) - p1.x - p2.x;
+
+    if (needY) {
+      for (s = 0; s < NS; s++) {
+        pp[s]->y.SubLazy(&Gn[i].x, &pp[s]->x);
+        pp[s]->y.ModMulK1(&_s[s]);
+      }
+      for (s = 0; s < NS; s++) {
+        pp[s]->y.SubLazy(&Gn[i].y);         // ry = - p2.y - s*(ret.x-p2.x);
+        pp[s]->y.Normalize();
+      }
+    }
+    for (s = 0; s < NS; s++)
+      pp[s]->x.Normalize();
+
+    // P = startP - i*G  , if (x,y) = i*G then (x,-y) = -i*G
+    // s' = -s = (p1.y+p2.y)*inverse(p2.x-p1.x)
+    for (s = 0; s < NS; s++)
+      dy[s].AddLazy(&Gn[i].y, &startP[s].y);
+    for (s = 0; s < NS; s++)
+      _s[s].ModMulK1(&dy[s], &dxi[s]);
+    for (s = 0; s < NS; s++)
+      _p[s].ModSquareK1(&_s[s]);            // _p = pow2(s')
+    for (s = 0; s < NS; s++)
+      pn[s]->x.SubLazy(&_p[s], &sx[s]);     // rx = pow2(s') - p1.x - p2.x;
+
+    if (needY) {
+      for (s = 0; s < NS; s++) {
+        pn[s]->y.SubLazy(&Gn[i].x, &pn[s]->x);
+        pn[s]->y.ModMulK1(&_s[s]);
+      }
+      for (s = 0; s < NS; s++) {
+        pn[s]->y.SubLazy(&Gn[i].y, &pn[s]->y); // ry = p2.y - s'*(p2.x-ret.x);
+        pn[s]->y.Normalize();
+      }
+    }
+    for (s = 0; s < NS; s++)
+      pn[s]->x.Normalize();
 
-      pn.x.ModNeg();
-      pn.x.ModAdd(&_p);
-      pn.x.ModSub(&Gn[i].x);          // rx = pow2(s) - p1.x - p2.x;
+  }
 
-      pn.y.ModSub(&Gn[i].x, &pn.x);
-      pn.y.ModMulK1(&_s);
-      pn.y.ModAdd(&Gn[i].y);          // ry = - p2.y - s*(ret.x-p2.x);
+  // First point (startP - (GRP_SZIE/2)*G)
+  for (s = 0; s < NS; s++) {
 
-      pts[CPU_GRP_SIZE/2 + (i+1)] = pp;
-      pts[CPU_GRP_SIZE/2 - (i+1)] = pn;
+    PointK1 &pn = pts[s*CPU_GRP_SIZE];
+    sx[s].AddLazy(&startP[s].x, &Gn[i].x);
+    dy[s].AddLazy(&Gn[i].y, &startP[s].y);
 
-    }
+    _s[s].ModMulK1(&dy[s], &dx[i*NS + s]);
+    _p[s].ModSquareK1(&_s[s]);
 
-    // First point (startP - (GRP_SZIE/2)*G)
-    pn = startP;
-    dyn.Set(&Gn[i].y);
-    dyn.ModNeg();
-    dyn.ModSub(&pn.y);
+    pn.x.SubLazy(&_p[s], &sx[s]);
 
-    _s.ModMulK1(&dyn, &dx[i]);
-    _p.ModSquareK1(&_s);
+    pn.y.SubLazy(&Gn[i].x, &pn.x);
+    pn.y.ModMulK1(&_s[s]);
+    pn.y.SubLazy(&Gn[i].y, &pn.y);
+    pn.x.Normalize();
+    pn.y.Normalize();
 
-    pn.x.ModNeg();
-    pn.x.ModAdd(&_p);
-    pn.x.ModSub(&Gn[i].x);
+  }
 
-    pn.y.ModSub(&Gn[i].x, &pn.x);
-    pn.y.ModMulK1(&_s);
-    pn.y.ModAdd(&Gn[i].y);
+  // Next start point (startP + CPU_GRP_STREAM*GRP_SIZE*G)
+  for (s = 0; s < NS; s++) {
 
-    pts[0] = pn;
+    PointK1 pp;
+    sx[s].AddLazy(&startP[s].x, &_SGn.x);
+    dy[s].SubLazy(&_SGn.y, &startP[s].y);
 
-    // Next start point (startP + GRP_SIZE*G)
-    pp = startP;
-    dy.ModSub(&_2Gn.y, &pp.y);
+    _s[s].ModMulK1(&dy[s], &dx[(i+1)*NS + s]);
+    _p[s].ModSquareK1(&_s[s]);
 
-    _s.ModMulK1(&dy, &dx[i+1]);
-    _p.ModSquareK1(&_s);
+    pp.x.SubLazy(&_p[s], &sx[s]);
 
-    pp.x.ModNeg();
-    pp.x.ModAdd(&_p);
-    pp.x.ModSub(&_2Gn.x);
+    pp.y.SubLazy(&_SGn.x, &pp.x);
+    pp.y.ModMulK1(&_s[s]);
+    pp.y.SubLazy(&_SGn.y);
+    pp.x.Normalize();
+    pp.y.Normalize();
+    pp.Get(startPoint[s]);
 
-    pp.y.ModSub(&_2Gn.x, &pp.x);
-    pp.y.ModMulK1(&_s);
-    pp.y.ModSub(&_2Gn.y);
-    startP = pp;
+  }
 
 #if 0
-    // Check
-    {
-      bool wrong = false;
-      Point p0 = secp.ComputePublicKey(&key);
-      for (int i = 0; i < CPU_GRP_SIZE; i++) {
-        if (!p0.equals(pts[i])) {
-          wrong = true;
-          printf("[%d] wrong point\n",i);
-        }
-        p0 = secp.NextKey(p0);
+  // Check
+  {
+    bool wrong = false;
+    Point p0 = secp.ComputePublicKey(&key);
+    for (int i = 0; i < CPU_GRP_SIZE; i++) {
+      if (!p0.equals(pts[i])) {
+        wrong = true;
+        printf("[%d] wrong point\n",i);
       }
-      if(wrong) exit(0);
+      p0 = secp.NextKey(p0);
     }
+    if(wrong) exit(0);
+  }
 #endif
 
-    // Check addresses
-    if (useSSE) {
-
-      for (int i = 0; i < CPU_GRP_SIZE && !endOfSearch; i += 4) {
-
-        switch (searchMode) {
-          case SEARCH_COMPRESSED:
-            checkAddressesSSE(true, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
-            break;
-          case SEARCH_UNCOMPRESSED:
-            checkAddressesSSE(false, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
-            break;
-          case SEARCH_BOTH:
-            checkAddressesSSE(true, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
-            checkAddressesSSE(false, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
-            break;
-        }
+}
+#undef NS
 
-      }
+template<int type, int mode, int matcher, int width>
+void VanitySearch::searchGroup(int thId, Int &key, Point *startP, CPU_GROUP *g) {
 
-    } else {
+  computeGroup<true>(startP, g);
 
-      for (int i = 0; i < CPU_GRP_SIZE && !endOfSearch; i ++) {
-
-        switch (searchMode) {
-        case SEARCH_COMPRESSED:
-          checkAddresses(true, key, i, pts[i]);
-          break;
-        case SEARCH_UNCOMPRESSED:
-          checkAddresses(false, key, i, pts[i]);
-          break;
-        case SEARCH_BOTH:
-          checkAddresses(true, key, i, pts[i]);
-          checkAddresses(false, key, i, pts[i]);
-          break;
-        }
+  // Streams are consecutive groups, checked in key order
+  for (int st = 0; st < CPU_GRP_STREAM; st++) {
+
+    PointK1 *pts = g->pts + st * CPU_GRP_SIZE;
+
+    // Check addresses, the hash stage fills the candidate buffer which is
+    // looked up every CPU_CAND_STEP points
+    for (int s = 0; s < CPU_GRP_SIZE && !endOfSearch; s += CPU_CAND_STEP) {
+
+      g->nbCand = 0;
 
+      if (width == 4) {
+        for (int i = s; i < s + CPU_CAND_STEP; i += 4) {
+          if (mode != SEARCH_UNCOMPRESSED)
+            checkAddressesSSE<type, true, matcher>(g, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
+          if (mode != SEARCH_COMPRESSED)
+            checkAddressesSSE<type, false, matcher>(g, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
+        }
+      } else {
+        for (int i = s; i < s + CPU_CAND_STEP; i++) {
+          if (mode != SEARCH_UNCOMPRESSED)
+            checkAddresses<type, true, matcher>(g, key, i, pts[i]);
+          if (mode != SEARCH_COMPRESSED)
+            checkAddresses<type, false, matcher>(g, key, i, pts[i]);
+        }
       }
 
+      checkCandidates<type, matcher>(g, key);
+
     }
 
     key.Add((uint64_t)CPU_GRP_SIZE);
-    counters[thId]+= 6*CPU_GRP_SIZE; // Point + endo #1 + endo #2 + Symetric point + endo #1 + endo #2
 
   }
 
-  ph->isRunning = false;
+  counters[thId] += 6*CPU_GRP_STREAM*CPU_GRP_SIZE; // Point + endo #1 + endo #2 + Symetric point + endo #1 + endo #2
+
+}
+
+template<int matcher>
+void VanitySearch::searchXOnly(int thId, Int &key, Point *startP, CPU_GROUP *g) {
+
+  computeGroup<false>(startP, g);
+
+  for (int st = 0; st < CPU_GRP_STREAM; st++) {
+    PointK1 *pts = g->pts + st * CPU_GRP_SIZE;
+    for (int i = 0; i < CPU_GRP_SIZE && !endOfSearch; i++)
+      checkXOnly<matcher>(key, i, pts[i]);
+    key.Add((uint64_t)CPU_GRP_SIZE);
+  }
+
+  counters[thId] += 3*CPU_GRP_STREAM*CPU_GRP_SIZE; // Point + endo #1 + endo #2
+
+}
+
+void VanitySearch::SearchGroupCPU(int thId, Int &key, Point *startP, CPU_GROUP *g) {
+  (this->*groupKernel)(thId, key, startP, g);
+}
+
+// ----------------------------------------------------------------------------
+// Kernel selection, combinations which cannot occur fall back to an existing
+// instance (mixed and suffix searches are P2PKH, P2SH and BECH32 only)
+
+template<int type, int mode, int matcher>
+VanitySearch::GROUP_KERNEL VanitySearch::selectWidth() {
+
+  if (useSSE)
+    return &VanitySearch::searchGroup<type, mode, matcher, 4>;
+  return &VanitySearch::searchGroup<type, mode, matcher, 1>;
+
+}
+
+template<int type, int mode>
+VanitySearch::GROUP_KERNEL VanitySearch::selectMatcher(int matcher) {
+
+  switch (matcher) {
+  case MATCH_PATTERN:
+    return selectWidth<type, mode, MATCH_PATTERN>();
+  case MATCH_SUFFIX:
+    return selectWidth<type, mode, (type <= BECH32) ? MATCH_SUFFIX : MATCH_PATTERN>();
+  case MATCH_MIXED:
+    return selectWidth<P2PKH, mode, MATCH_MIXED>();
+  case MATCH_MIXED_P2SH:
+    return selectWidth<P2PKH, mode, MATCH_MIXED_P2SH>();
+  }
+  return selectWidth<type, mode, MATCH_PREFIX>();
+
+}
+
+template<int type>
+VanitySearch::GROUP_KERNEL VanitySearch::selectMode(int matcher) {
+
+  switch (searchMode) {
+  case SEARCH_UNCOMPRESSED:
+    return selectMatcher<type, SEARCH_UNCOMPRESSED>(matcher);
+  case SEARCH_BOTH:
+    return selectMatcher<type, (type == ETH) ? SEARCH_COMPRESSED : SEARCH_BOTH>(matcher);
+  }
+  return selectMatcher<type, SEARCH_COMPRESSED>(matcher);
+
+}
+
+VanitySearch::GROUP_KERNEL VanitySearch::selectKernel() {
+
+  int matcher = MATCH_PREFIX;
+  if (hasPattern)
+    matcher = suffixSearch ? MATCH_SUFFIX : MATCH_PATTERN;
+  else if (typeMask & (typeMask - 1))
+    matcher = mixedP2SH ? MATCH_MIXED_P2SH : MATCH_MIXED;
+
+  switch (searchType) {
+  case P2SH:
+    return selectMode<P2SH>(matcher);
+  case BECH32:
+    return selectMode<BECH32>(matcher);
+  case ETH:
+    return selectMode<ETH>(matcher);
+  case XONLY:
+    if (matcher == MATCH_PATTERN)
+      return &VanitySearch::searchXOnly<MATCH_PATTERN>;
+    return &VanitySearch::searchXOnly<MATCH_PREFIX>;
+  }
+  return selectMode<P2PKH>(matcher);
 
 }
 
@@ -1482,7 +2785,7 @@ void VanitySearch::getGPUStartingKeys(int thId, int groupSize, int nbThread, Int
 
   for (int i = 0; i < nbThread; i++) {
     if (rekey > 0) {
-      keys[i].Rand(256);
+      randKey(thId, keys[i]);
     } else {
       keys[i].Set(&startKey);
       Int offT((uint64_t)i);
@@ -1492,14 +2795,18 @@ void VanitySearch::getGPUStartingKeys(int thId, int groupSize, int nbThread, Int
       keys[i].Add(&offT);
       keys[i].Add(&offG);
     }
-    Int k(keys + i);
-    // Starting key is at the middle of the group
-    k.Add((uint64_t)(groupSize / 2));
-    p[i] = secp->ComputePublicKey(&k);
-    if (startPubKeySpecified)
-      p[i] = secp->AddDirect(p[i], startPubKey);
   }
 
+  // Starting key is at the middle of the group
+  Int *k = new Int[nbThread];
+  for (int i = 0; i < nbThread; i++) {
+    k[i].Set(keys + i);
+    k[i].Add((uint64_t)(groupSize / 2));
+  }
+  secp->ComputePublicKeys(nbThread, k, p, startPubKeySpecified ? &startPubKey : NULL,
+                          Timer::getCoreNumber());
+  delete[] k;
+
 }
 
 void VanitySearch::FindKeyGPU(TH_PARAM *ph) {
@@ -1508,34 +2815,40 @@ void VanitySearch::FindKeyGPU(TH_PARAM *ph) {
 
 #ifdef WITHGPU
 
-  // Global init
+  // Global init, engines given by SetGPUEngines() are reused from a
+  // previous search (the CUDA context and buffers are kept)
   int thId = ph->threadId;
-  GPUEngine g(ph->gridSizeX,ph->gridSizeY, ph->gpuId, maxFound, (rekey!=0));
-  int nbThread = g.GetNbThread();
+  GPUEngine *g;
+  if (gpuEngine) {
+    g = gpuEngine[thId - 0x80];
+    g->ResetPrefix();
+  } else {
+    g = new GPUEngine(ph->gridSizeX, ph->gridSizeY, ph->gpuId, maxFound, (rekey != 0));
+  }
+  int nbThread = g->GetNbThread();
   Point *p = new Point[nbThread];
   Int *keys = new Int[nbThread];
   vector<ITEM> found;
 
-  printf("GPU: %s\n",g.deviceName.c_str());
+  message("GPU: %s\n",g->deviceName.c_str());
 
   counters[thId] = 0;
 
-  getGPUStartingKeys(thId, g.GetGroupSize(), nbThread, keys, p);
-
-  g.SetSearchMode(searchMode);
-  g.SetSearchType(searchType);
+  g->SetSearchMode(searchMode);
+  g->SetSearchType(hashType);
   if (onlyFull) {
-    g.SetPrefix(usedPrefixL,nbPrefix);
+    g->SetPrefix(lookup16, lookup32, nbLookup32 - 65536);
   } else {
     if(hasPattern)
-      g.SetPattern(inputPrefixes[0].c_str());
+      g->SetPattern(inputPrefixes[0]);
     else
-      g.SetPrefix(usedPrefix);
+      g->SetPrefix(usedPrefix);
   }
 
-  getGPUStartingKeys(thId, g.GetGroupSize(), nbThread, keys, p);
-  ok = g.SetKeys(p);
+  getGPUStartingKeys(thId, g->GetGroupSize(), nbThread, keys, p);
+  ok = g->SetKeys(p);
   ph->rekeyRequest = false;
+  uint32_t lastPruned = 0;
 
   ph->hasStarted = true;
 
@@ -1543,13 +2856,13 @@ void VanitySearch::FindKeyGPU(TH_PARAM *ph) {
   while (ok && !endOfSearch) {
 
     if (ph->rekeyRequest) {
-      getGPUStartingKeys(thId, g.GetGroupSize(), nbThread, keys, p);
-      ok = g.SetKeys(p);
+      getGPUStartingKeys(thId, g->GetGroupSize(), nbThread, keys, p);
+      ok = g->SetKeys(p);
       ph->rekeyRequest = false;
     }
 
     // Call kernel
-    ok = g.Launch(found);
+    ok = g->Launch(found);
 
     for(int i=0;i<(int)found.size() && !endOfSearch;i++) {
 
@@ -1558,6 +2871,22 @@ void VanitySearch::FindKeyGPU(TH_PARAM *ph) {
 
     }
 
+    // Remove pruned buckets from the GPU lookup (at most once per launch)
+    if (nbPruned != lastPruned && !endOfSearch) {
+      lastPruned = nbPruned;
+      if (onlyFull) {
+        vector<prefix_t> l16(lookup16, lookup16 + 65536);
+        for (int b = 0; b < 65536; b++)
+          if (prefixes[b].count == 0) l16[b] = 0;
+        g->SetPrefix(&l16[0], lookup32, nbLookup32 - 65536);
+      } else {
+        vector<prefix_t> live;
+        for (int i = 0; i < (int)usedPrefix.size(); i++)
+          if (prefixes[usedPrefix[i]].count) live.push_back(usedPrefix[i]);
+        g->SetPrefix(live);
+      }
+    }
+
     if (ok) {
       for (int i = 0; i < nbThread; i++) {
         keys[i].Add((uint64_t)STEP_SIZE);
@@ -1569,10 +2898,12 @@ void VanitySearch::FindKeyGPU(TH_PARAM *ph) {
 
   delete[] keys;
   delete[] p;
+  if (!gpuEngine)
+    delete g;
 
 #else
   ph->hasStarted = true;
-  printf("GPU code not compiled, use -DWITHGPU when compiling.\n");
+  message("GPU code not compiled, use -DWITHGPU when compiling.\n");
 #endif
 
   ph->isRunning = false;
@@ -1592,6 +2923,17 @@ bool VanitySearch::isAlive(TH_PARAM *p) {
 
 }
 
+bool VanitySearch::isDead(TH_PARAM *p) {
+
+  bool isDead = true;
+  int total = nbCPUThread + nbGPUThread;
+  for (int i = 0; i < total; i++)
+    isDead = isDead && !p[i].isRunning;
+
+  return isDead;
+
+}
+
 // ----------------------------------------------------------------------------
 
 bool VanitySearch::hasStarted(TH_PARAM *p) {
@@ -1642,14 +2984,24 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
 
   double t0;
   double t1;
-  endOfSearch = false;
   nbCPUThread = nbThread;
   nbGPUThread = (useGpu?(int)gpuId.size():0);
   nbFoundKey = 0;
 
   memset(counters,0,sizeof(counters));
 
-  printf("Number of CPU thread: %d\n", nbCPUThread);
+  char *ctimeBuff;
+  time_t now = time(NULL);
+  ctimeBuff = ctime(&now);
+  message("Start %s", ctimeBuff);
+
+  if (rekey > 0) {
+    message("Base Key: Randomly changed every %.0f Mkeys\n",(double)rekey);
+  } else {
+    message("Base Key: %s\n", startKey.GetBase16().c_str());
+  }
+
+  message("Number of CPU thread: %d\n", nbCPUThread);
 
   TH_PARAM *params = (TH_PARAM *)malloc((nbCPUThread + nbGPUThread) * sizeof(TH_PARAM));
   memset(params,0,(nbCPUThread + nbGPUThread) * sizeof(TH_PARAM));
@@ -1662,12 +3014,11 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
 
 #ifdef WIN64
     DWORD thread_id;
-    CreateThread(NULL, 0, _FindKey, (void*)(params+i), 0, &thread_id);
-    ghMutex = CreateMutex(NULL, FALSE, NULL);
+    CloseHandle(CreateThread(NULL, 0, _FindKey, (void*)(params+i), 0, &thread_id));
 #else
     pthread_t thread_id;
     pthread_create(&thread_id, NULL, &_FindKey, (void*)(params+i));
-    ghMutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_detach(thread_id);
 #endif
   }
 
@@ -1681,10 +3032,11 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
     params[nbCPUThread+i].gridSizeY = gridSize[2*i+1];
 #ifdef WIN64
     DWORD thread_id;
-    CreateThread(NULL, 0, _FindKeyGPU, (void*)(params+(nbCPUThread+i)), 0, &thread_id);
+    CloseHandle(CreateThread(NULL, 0, _FindKeyGPU, (void*)(params+(nbCPUThread+i)), 0, &thread_id));
 #else
     pthread_t thread_id;
     pthread_create(&thread_id, NULL, &_FindKeyGPU, (void*)(params+(nbCPUThread+i)));
+    pthread_detach(thread_id);
 #endif
   }
 
@@ -1710,7 +3062,7 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
 
   // Wait that all threads have started
   while (!hasStarted(params)) {
-    Timer::SleepMillis(500);
+    Timer::SleepMillis(10);
   }
 
   t0 = Timer::get_tick();
@@ -1720,8 +3072,8 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
 
     int delay = 2000;
     while (isAlive(params) && delay>0) {
-      Timer::SleepMillis(500);
-      delay -= 500;
+      Timer::SleepMillis(10);
+      delay -= 10;
     }
 
     gpuCount = getGPUCount();
@@ -1746,7 +3098,7 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
     avgGpuKeyRate /= (double)(nbSample);
 
     if (isAlive(params)) {
-      printf("\r[%.2f Mkey/s][GPU %.2f Mkey/s][Total 2^%.2f]%s[Found %d]  ",
+      message("\r[%.2f Mkey/s][GPU %.2f Mkey/s][Total 2^%.2f]%s[Found %d]  ",
         avgKeyRate / 1000000.0, avgGpuKeyRate / 1000000.0,
           log2((double)count), GetExpectedTime(avgKeyRate, (double)count).c_str(),nbFoundKey);
     }
@@ -1765,6 +3117,12 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
 
   }
 
+  // Threads are detached, stop the remaining ones and wait for all of them
+  // before releasing params (the caller may delete this object)
+  endOfSearch = true;
+  while (!isDead(params))
+    Timer::SleepMillis(10);
+
   free(params);
 
 }
@@ -1784,3 +3142,39 @@ string VanitySearch::GetHex(vector<unsigned char> &buffer) {
   return ret;
 
 }
+
+// ----------------------------------------------------------------------------
+
+void VanitySearch::GenerateCode(Secp256K1 *secp, int size) {
+
+  // Compute generator table (Jacobian)
+  Point *Gn = new Point[size / 2];
+  Gn[0] = secp->G;
+  Gn[1] = secp->DoubleJacobian(secp->G);
+  for (int i = 2; i < size / 2; i++)
+    Gn[i] = secp->AddJacobianMixed(Gn[i - 1], secp->G);
+  secp->BatchNormalize(Gn + 1, size / 2 - 1);
+
+  // Write file
+  FILE *f = fopen("CPUGroup.h", "w");
+
+  fprintf(f, "// File generated by VanitySearch::GenerateCode()\n");
+  fprintf(f, "// CPU GROUP definitions\n");
+  fprintf(f, "#define CPU_GRP_GEN_SIZE %d\n\n", size);
+  fprintf(f, "// SecpK1 Generator table (Contains G,2G,3G,...,(CPU_GRP_SIZE/2 )G)\n");
+  fprintf(f, "static const uint64_t cpuGx[][4] = {\n");
+  for (int i = 0; i < size / 2; i++) {
+    fprintf(f, "  %s,\n", Gn[i].x.GetC64Str(4).c_str());
+  }
+  fprintf(f, "};\n");
+
+  fprintf(f, "static const uint64_t cpuGy[][4] = {\n");
+  for (int i = 0; i < size / 2; i++) {
+    fprintf(f, "  %s,\n", Gn[i].y.GetC64Str(4).c_str());
+  }
+  fprintf(f, "};\n\n");
+
+  fclose(f);
+  delete[] Gn;
+
+}
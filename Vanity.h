@@ -21,21 +21,73 @@
 #include <string>
 #include <vector>
 #include "SECP256k1.h"
+#include "FieldK1.h"
+#include "Suffix.h"
+#include "hash/chacha20.h"
 #include "GPU/GPUEngine.h"
 #ifdef WIN64
 #include <Windows.h>
 #endif
 
 #define CPU_GRP_SIZE 1024
+// Consecutive groups stepped in lockstep by a CPU thread (one ModInv)
+#define CPU_GRP_STREAM 4
+
+// Search kernel matchers
+#define MATCH_PREFIX     0  // Prefix table
+#define MATCH_PATTERN    1  // Wildcard patterns
+#define MATCH_SUFFIX     2  // Suffix filter, then wildcard patterns
+#define MATCH_MIXED      3  // Prefix table, P2PKH and BECH32 mixed
+#define MATCH_MIXED_P2SH 4  // Mixed, P2SH checked on the script hash
+
+// Case unsensitive search: leading characters which give the lookup prefix
+#define CASE_LEADING_LENGTH 6
 
 class VanitySearch;
 
+// Called (serialized) for each key found instead of the standard output
+typedef void (*FOUND_CALLBACK)(void *user, std::string addr, std::string pAddr, std::string pAddrHex);
+
+typedef struct {
+
+  void *ptr;
+  size_t size;
+
+} ARENA_ITEM;
+
+// Hashes waiting for the lookup pass, the hash stage issues a prefetch on
+// their bucket and the lookup is done every CPU_CAND_STEP points
+#define CPU_CAND_STEP 64
+#define CPU_CAND_SIZE (CPU_CAND_STEP * 6 * 2 * 2) // 6 keys per point, both modes, script hashes
+
+typedef struct {
+
+  uint8_t hash[20];
+  int32_t incr;
+  int8_t endo;
+  bool mode;
+  bool script;        // P2SH script hash (mixed search)
+  uint8_t pad;
+
+} HASH_CANDIDATE;
+
+// CPU group buffers (one per thread)
+typedef struct {
+
+  FieldGroup *grp;
+  FieldK1 dx[CPU_GRP_STREAM * (CPU_GRP_SIZE / 2 + 1)]; // Interleaved streams
+  PointK1 pts[CPU_GRP_STREAM * CPU_GRP_SIZE];
+  HASH_CANDIDATE cand[CPU_CAND_SIZE];
+  int nbCand;
+
+} CPU_GROUP;
+
 typedef struct {
 
   VanitySearch *obj;
   int  threadId;
-  bool isRunning;
-  bool hasStarted;
+  volatile bool isRunning;
+  volatile bool hasStarted;
   bool rekeyRequest;
   int  gridSizeX;
   int  gridSizeY;
@@ -48,9 +100,10 @@ typedef struct {
 
   char *prefix;
   int prefixLength;
+  int type;
   prefix_t sPrefix;
+  int sPrefixBits;    // Known leading bits of sPrefix (x-only prefix < 16 bits)
   double difficulty;
-  bool *found;
 
   // For dreamer ;)
   bool isFull;
@@ -59,70 +112,227 @@ typedef struct {
 
 } PREFIX_ITEM;
 
+// Compact prefix entry (16 bytes), text and hash160 are stored in prefixData
+// In a bucket, prefixes come first, sorted by text: a prefix is followed by
+// its duplicates and by the longer prefixes it contains. Full addresses
+// follow, sorted by lPrefix.
 typedef struct {
 
-  std::vector<PREFIX_ITEM> *items;
-  bool found;
+  union {
+    prefixl_t lPrefix;  // Sort key (full address)
+    uint32_t parent;    // Distance to the enclosing prefix, 0 if none (prefix)
+  };
+  uint32_t data;      // Offset in prefixData: hash160 (full address) or prefix text
+  uint32_t input;     // Input prefix index (found bit, difficulty)
+  prefix_t sPrefix;   // Bucket
+  uint8_t length;     // Prefix length
+  uint8_t isFull : 1;
+  uint8_t type : 7;   // Address type (P2PKH, P2SH and BECH32 can be mixed)
+
+} PREFIX_ENTRY;
+
+typedef struct {
+
+  uint32_t offset;  // First entry in prefixEntries
+  uint32_t count;   // Number of entries (0 if unused or pruned)
+  uint32_t live;    // Number of entries not yet found
 
 } PREFIX_TABLE_ITEM;
 
+// Inputs not yet found, per difficulty
+typedef struct {
+
+  double difficulty;
+  uint32_t left;
+
+} DIFFICULTY_ITEM;
+
+// Compiled prefix database (-compile-prefixes), sections follow the header:
+// bucket table (65536 x offset,count), difficulties (nbInput), entries (nbEntry),
+// lookup32 (nbLookup32), lookup16 (65536) (GPU, full addresses only), data (dataSize)
+#define PREFIXDB_MAGIC   0x42445356 // "VSDB"
+#define PREFIXDB_VERSION 4
+
+typedef struct {
+
+  uint32_t magic;
+  uint32_t version;
+  uint32_t entrySize;
+  int32_t  searchType;
+  uint32_t caseSensitive;
+  uint32_t onlyFull;
+  uint32_t nbInput;
+  uint32_t nbPrefix;
+  uint32_t nbEntry;
+  uint32_t dataSize;
+  uint32_t nbLookup32;
+  uint32_t typeMask;
+  uint8_t  pad[16];
+
+} PREFIXDB_HEADER;
+
+// Prefix lookup building
+typedef struct {
+
+  VanitySearch *obj;
+  int  threadId;
+  int  nbThread;
+  int  step;
+  int  startIdx;
+  int  endIdx;
+  int  nbPrefix;
+  bool onlyFull;
+  uint32_t typeMask;
+  std::vector<PREFIX_ENTRY> items;
+  std::vector<uint8_t> data;
+  uint32_t dataOffset;
+  std::vector<uint32_t> bucketPos;
+
+} PREFIX_TH_PARAM;
+
 class VanitySearch {
 
 public:
 
-  VanitySearch(Secp256K1 *secp, std::vector<std::string> &prefix, std::string seed, int searchMode,
+  VanitySearch(Secp256K1 *secp, std::vector<char *> &prefix, std::string seed, int searchMode,
                bool useGpu,bool stop,std::string outputFile, bool useSSE,uint32_t maxFound,uint64_t rekey,
-               bool caseSensitive,Point &startPubKey,bool paranoiacSeed);
+               bool caseSensitive,Point &startPubKey,bool paranoiacSeed,std::string prefixDB,
+               std::string hrp,bool quiet);
+  ~VanitySearch();
+
+  bool IsReady();
+  std::string GetError();
+  void Stop();
+  void SetFoundCallback(FOUND_CALLBACK callback, void *user);
+  // GPU engines kept by the caller (one per gpuId, default: created by Search())
+  void SetGPUEngines(GPUEngine **engines);
+
+  // Search driven by an external thread pool (see Scheduler)
+  void StartJob(int nbThread);
+  void InitKeyCPU(int thId, Int &key, Point *startP);
+  void RekeyCPU(int thId, Int &key, Point *startP);
+  uint64_t GetRekey();
+  void SearchGroupCPU(int thId, Int &key, Point *startP, CPU_GROUP *g);
+  bool IsEnded();
+  uint64_t GetCount();
+  int GetNbFound();
+  double GetStartTime();
+  int GetSearchType();
+  std::string GetExpectedTime(double keyRate, double keyCount);
 
   void Search(int nbThread,std::vector<int> gpuId,std::vector<int> gridSize);
   void FindKeyCPU(TH_PARAM *p);
   void FindKeyGPU(TH_PARAM *p);
+  static void GenerateCode(Secp256K1 *secp, int size);
+  static void InitGenerator(Secp256K1 *secp);
+  static bool IsPrefixDB(std::string fileName);
+  bool SavePrefixes(std::string fileName);
+  void BuildPrefixes(PREFIX_TH_PARAM *p);
 
 private:
 
+  typedef void (VanitySearch::*GROUP_KERNEL)(int thId, Int &key, Point *startP, CPU_GROUP *g);
+
   std::string GetHex(std::vector<unsigned char> &buffer);
-  std::string GetExpectedTime(double keyRate, double keyCount);
-  bool checkPrivKey(std::string addr, Int &key, int32_t incr, int endomorphism, bool mode);
+  void message(const char *fmt, ...);
+  void setError(const char *fmt, ...);
+  bool checkPrivKey(int type, std::string addr, Int &key, int32_t incr, int endomorphism, bool mode);
   void checkAddr(int prefIdx, uint8_t *hash160, Int &key, int32_t incr, int endomorphism, bool mode);
+  void checkAddrType(int type, int prefIdx, uint8_t *hash, Int &key, int32_t incr, int endomorphism, bool mode);
   void checkAddrSSE(uint8_t *h1, uint8_t *h2, uint8_t *h3, uint8_t *h4,
                     int32_t incr1, int32_t incr2, int32_t incr3, int32_t incr4,
                     Int &key, int endomorphism, bool mode);
-  void checkAddresses(bool compressed, Int key, int i, Point p1);
-  void checkAddressesSSE(bool compressed, Int key, int i, Point p1, Point p2, Point p3, Point p4);
-  void output(std::string addr, std::string pAddr, std::string pAddrHex);
+  void addCandidate(CPU_GROUP *g, uint8_t *h, int32_t incr, int endomorphism, bool mode, bool script);
+  template<int type, int matcher>
+  void checkCandidates(CPU_GROUP *g, Int &key);
+  template<int type, bool compressed, int matcher>
+  void checkHash(CPU_GROUP *g, uint8_t *h, Int &key, int32_t incr, int endomorphism);
+  template<int type, bool compressed, int matcher>
+  void checkHashes(CPU_GROUP *g, uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3,
+                   int32_t incr0, int32_t incr1, int32_t incr2, int32_t incr3,
+                   Int &key, int endomorphism);
+  template<int type, bool compressed, int matcher>
+  void checkAddresses(CPU_GROUP *g, Int &key, int i, PointK1 p1);
+  template<int type, bool compressed, int matcher>
+  void checkAddressesSSE(CPU_GROUP *g, Int &key, int i, PointK1 p1, PointK1 p2, PointK1 p3, PointK1 p4);
+  template<int matcher>
+  void checkXOnly(Int &key, int i, PointK1 &p1);
+  template<bool needY>
+  void computeGroup(Point *startPoint, CPU_GROUP *g);
+  template<int type, int mode, int matcher, int width>
+  void searchGroup(int thId, Int &key, Point *startP, CPU_GROUP *g);
+  template<int matcher>
+  void searchXOnly(int thId, Int &key, Point *startP, CPU_GROUP *g);
+  template<int type, int mode, int matcher>
+  GROUP_KERNEL selectWidth();
+  template<int type, int mode>
+  GROUP_KERNEL selectMatcher(int matcher);
+  template<int type>
+  GROUP_KERNEL selectMode(int matcher);
+  GROUP_KERNEL selectKernel();
+  std::string getAddress(int type, bool mode, uint8_t *h);
+  std::string getAddress(int type, bool mode, Point &p);
+  std::string getSearchInfo();
+  bool checksumMatch(char *prefix, std::string &addr);
+  void output(int type, std::string addr, std::string pAddr, std::string pAddrHex);
   bool isAlive(TH_PARAM *p);
-  bool isSingularPrefix(std::string pref);
+  bool isDead(TH_PARAM *p);
+  bool isSingularPrefix(char *pref);
   bool hasStarted(TH_PARAM *p);
   void rekeyRequest(TH_PARAM *p);
   uint64_t getGPUCount();
   uint64_t getCPUCount();
-  bool initPrefix(std::string &prefix, PREFIX_ITEM *it);
+  bool initPrefix(char *prefix, PREFIX_ITEM *it);
+  int getPrefixType(char *prefix);
+  bool buildPrefixes();
+  bool loadPrefixes(std::string fileName);
+  void launchPrefixThreads(PREFIX_TH_PARAM *params, int nbThread, int step);
+  void addEntry(PREFIX_TH_PARAM *p, PREFIX_ITEM *it, uint32_t input);
+  void *allocArena(size_t size);
+  bool isFound(uint32_t input);
+  bool setFound(uint32_t input);
+  void initFound();
+  void foundInput(uint32_t input, uint32_t entry);
+  void killEntry(uint32_t entry);
   void dumpPrefixes();
   double getDiffuclty();
   void updateFound();
-  void getCPUStartingKey(int thId, Int& key, Point& startP);
+  void randKey(int thId, Int &key);
+  void getCPUStartingKey(int thId, Int& key, Point *startP);
   void getGPUStartingKeys(int thId, int groupSize, int nbThread, Int *keys, Point *p);
-  void enumCaseUnsentivePrefix(std::string s, std::vector<std::string> &list);
+  double enumCaseUnsentivePrefix(std::string s, std::vector<std::string> &list);
   bool prefixMatch(char *prefix, char *addr);
 
   Secp256K1 *secp;
+  GROUP_KERNEL groupKernel;
   Int startKey;
   Point startPubKey;
   bool startPubKeySpecified;
   uint64_t counters[256];
   double startTime;
   int searchType;
+  uint32_t typeMask;  // Types of the prefixes (1 << type)
+  int hashType;       // Hash computed for each key (mixed search: hash160)
+  bool mixedP2SH;     // P2SH prefixes checked on the script hash of the hash160
   int searchMode;
+  std::string hrp;
   bool hasPattern;
+  bool suffixSearch;  // All patterns end with a literal (Suffix filter)
+  Suffix suffix;
   bool caseSensitive;
   bool useGpu;
   bool stopWhenFound;
-  bool endOfSearch;
+  bool ready;
+  GPUEngine **gpuEngine;
+  bool quiet;         // No console output (library)
+  std::string error;  // First error, see GetError()
+  volatile bool endOfSearch;
   int nbCPUThread;
   int nbGPUThread;
   int nbFoundKey;
   uint64_t rekey;
   uint64_t lastRekey;
+  CHACHA20_DRBG *rng;
   uint32_t nbPrefix;
   std::string outputFile;
   bool useSSE;
@@ -132,13 +342,33 @@ private:
   bool *patternFound;
   std::vector<PREFIX_TABLE_ITEM> prefixes;
   std::vector<prefix_t> usedPrefix;
-  std::vector<LPREFIX> usedPrefixL;
-  std::vector<std::string> &inputPrefixes;
+  PREFIX_ENTRY *prefixEntries;
+  uint32_t nbEntry;
+  uint32_t nbInput;
+  uint8_t *prefixData;
+  uint32_t prefixDataSize;
+  uint64_t *prefixFound;
+  uint64_t *entryDead;
+  uint32_t nbInputLeft;
+  uint32_t nbPruned;
+  std::vector<DIFFICULTY_ITEM> difficulties;
+  double *prefixDifficulty;
+  prefix_t *lookup16;
+  uint32_t *lookup32;
+  uint32_t nbLookup32;
+  std::vector<ARENA_ITEM> arenas;
+  void *prefixDBMap;
+  size_t prefixDBSize;
+  FOUND_CALLBACK foundCallback;
+  void *foundUser;
+  std::vector<char *> &inputPrefixes;
 
   Int beta;
   Int lambda;
   Int beta2;
   Int lambda2;
+  FieldK1 betaK1;
+  FieldK1 beta2K1;
 
 #ifdef WIN64
   HANDLE ghMutex;
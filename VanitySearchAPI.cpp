@@ -0,0 +1,457 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "VanitySearchAPI.h"
+#include "Vanity.h"
+#include "Scheduler.h"
+#include "PrefixFile.h"
+#include "SECP256k1.h"
+#include "Timer.h"
+#include "Random.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace std;
+
+typedef struct {
+  void *ptr;
+  size_t size;
+} FILE_MAP;
+
+struct vs_context {
+
+  // Parameters
+  vector<char *> prefixes;      // VanitySearch keeps a reference
+  vector<char *> owned;         // Prefixes added by vs_add_prefix()
+  vector<FILE_MAP> maps;        // Prefixes loaded by vs_load_prefixes()
+  string prefixDB;
+  int searchMode;
+  bool caseSensitive;
+  string hrp;
+  bool stop;
+  string seed;
+  bool paranoiacSeed;
+  string outputFile;
+  uint32_t maxFound;
+  uint64_t rekey;
+  bool useSSE;
+  Point startPubKey;
+  bool startPubKeyCompressed;
+  vs_found_callback callback;
+  void *user;
+  bool quiet;
+
+  // Search
+  VanitySearch *v;
+  bool useGpu;
+  Scheduler *sched;
+  int jobId;
+  int nbThread;
+  vector<int> gpuId;
+  vector<int> gridSize;
+  volatile bool searching;      // Search() thread (gpu)
+  bool hasThread;
+#ifdef WIN64
+  HANDLE thread;
+#else
+  pthread_t thread;
+#endif
+
+  string error;
+
+};
+
+static Secp256K1 *secp = NULL;
+static string initError;
+
+Secp256K1 *vs_secp() {
+  return secp;
+}
+
+// ----------------------------------------------------------------------------
+
+static int fail(vs_context *ctx, string error) {
+  ctx->error = error;
+  return VS_ERROR;
+}
+
+static void _onFound(void *user, string addr, string pAddr, string pAddrHex) {
+  vs_context *ctx = (vs_context *)user;
+  ctx->callback(ctx->user, addr.c_str(), pAddr.c_str(), pAddrHex.c_str());
+}
+
+static int build(vs_context *ctx, bool useGpu) {
+
+  if (secp == NULL)
+    return fail(ctx, "vs_init() not called");
+  if (ctx->v != NULL) {
+    vs_stats s;
+    vs_get_stats(ctx, &s);
+    if (s.running)
+      return fail(ctx, "search already started");
+    vs_wait(ctx);
+    delete ctx->v;
+    ctx->v = NULL;
+  }
+
+  // The split key gives the search mode
+  int mode = ctx->searchMode;
+  if (!ctx->startPubKey.isZero())
+    mode = ctx->startPubKeyCompressed ? SEARCH_COMPRESSED : SEARCH_UNCOMPRESSED;
+
+  ctx->useGpu = useGpu;
+  ctx->v = new VanitySearch(secp, ctx->prefixes, ctx->seed, mode, useGpu, ctx->stop, ctx->outputFile,
+                            ctx->useSSE, ctx->maxFound, ctx->rekey, ctx->caseSensitive, ctx->startPubKey,
+                            ctx->paranoiacSeed, ctx->prefixDB, ctx->hrp, ctx->quiet);
+  if (!ctx->v->IsReady()) {
+    string error = ctx->v->GetError();
+    delete ctx->v;
+    ctx->v = NULL;
+    return fail(ctx, (error.length() > 0) ? error : "nothing to search");
+  }
+  if (ctx->callback != NULL)
+    ctx->v->SetFoundCallback(_onFound, ctx);
+
+  return VS_OK;
+
+}
+
+static void setGpu(vs_context *ctx, const int *gpuId, const int *gridSize, int nbGpu) {
+
+  ctx->gpuId.clear();
+  ctx->gridSize.clear();
+  for (int i = 0; i < nbGpu; i++) {
+    ctx->gpuId.push_back(gpuId[i]);
+    ctx->gridSize.push_back(gridSize ? gridSize[2 * i] : -1);
+    ctx->gridSize.push_back(gridSize ? gridSize[2 * i + 1] : 128);
+  }
+
+}
+
+#ifdef WIN64
+DWORD WINAPI _search(LPVOID lpParam) {
+#else
+void *_search(void *lpParam) {
+#endif
+  vs_context *ctx = (vs_context *)lpParam;
+  ctx->v->Search(ctx->nbThread, ctx->gpuId, ctx->gridSize);
+  ctx->searching = false;
+  return 0;
+}
+
+// ----------------------------------------------------------------------------
+
+int vs_init(int gTableBits, const char *gTableFile) {
+
+  if (secp != NULL)
+    return VS_OK;
+
+  if (gTableBits < GTABLE_MIN_WBITS || gTableBits > GTABLE_MAX_WBITS) {
+    char tmp[128];
+    sprintf(tmp, "Invalid generator table window size %d, [%d..%d] expected", gTableBits,
+            GTABLE_MIN_WBITS, GTABLE_MAX_WBITS);
+    initError = string(tmp);
+    return VS_ERROR;
+  }
+
+  Timer::Init();
+  rseed(Timer::getSeed32());
+  secp = new Secp256K1();
+  secp->Init(gTableBits, gTableFile);
+  VanitySearch::InitGenerator(secp);
+  return VS_OK;
+
+}
+
+vs_context *vs_create(void) {
+
+  vs_context *ctx = new vs_context;
+  ctx->searchMode = SEARCH_COMPRESSED;
+  ctx->caseSensitive = true;
+  ctx->hrp = "npub";
+  ctx->stop = false;
+  ctx->paranoiacSeed = false;
+  ctx->maxFound = 65536;
+  ctx->rekey = 0;
+  ctx->useSSE = true;
+  ctx->startPubKey.Clear();
+  ctx->startPubKeyCompressed = true;
+  ctx->callback = NULL;
+  ctx->user = NULL;
+  ctx->quiet = true;
+  ctx->v = NULL;
+  ctx->useGpu = false;
+  ctx->sched = NULL;
+  ctx->jobId = -1;
+  ctx->nbThread = 0;
+  ctx->searching = false;
+  ctx->hasThread = false;
+  return ctx;
+
+}
+
+void vs_destroy(vs_context *ctx) {
+
+  if (ctx == NULL)
+    return;
+  vs_stop(ctx);
+  vs_wait(ctx);
+  delete ctx->sched;
+  delete ctx->v;
+  for (int i = 0; i < (int)ctx->owned.size(); i++)
+    free(ctx->owned[i]);
+  for (int i = 0; i < (int)ctx->maps.size(); i++)
+    PrefixFile::Unmap(ctx->maps[i].ptr, ctx->maps[i].size);
+  delete ctx;
+
+}
+
+const char *vs_last_error(vs_context *ctx) {
+  if (ctx == NULL)
+    return initError.c_str();
+  return ctx->error.c_str();
+}
+
+// ----------------------------------------------------------------------------
+
+int vs_add_prefix(vs_context *ctx, const char *prefix) {
+
+  if (prefix == NULL || prefix[0] == 0)
+    return fail(ctx, "empty prefix");
+  char *p = strdup(prefix);
+  ctx->owned.push_back(p);
+  ctx->prefixes.push_back(p);
+  return VS_OK;
+
+}
+
+int vs_load_prefixes(vs_context *ctx, const char *fileName) {
+
+  FILE *f = fopen(fileName, "rb");
+  if (f == NULL)
+    return fail(ctx, string("cannot open ") + fileName);
+  fclose(f);
+
+  if (VanitySearch::IsPrefixDB(string(fileName))) {
+    ctx->prefixDB = string(fileName);
+    return VS_OK;
+  }
+
+  // The lines point into the mapping, released by vs_destroy()
+  string error;
+  FILE_MAP m;
+  if (!PrefixFile::Load(string(fileName), ctx->prefixes, &m.ptr, &m.size, error))
+    return fail(ctx, error);
+  if (m.ptr != NULL)
+    ctx->maps.push_back(m);
+  return VS_OK;
+
+}
+
+int vs_set_split_key(vs_context *ctx, const char *pubKeyHex) {
+
+  if (secp == NULL)
+    return fail(ctx, "vs_init() not called");
+  bool compressed;
+  Point p;
+  if (!secp->ParsePublicKeyHex(string(pubKeyHex), p, compressed))
+    return fail(ctx, "invalid public key");
+  ctx->startPubKey = p;
+  ctx->startPubKeyCompressed = compressed;
+  return VS_OK;
+
+}
+
+int vs_set_search_mode(vs_context *ctx, int searchMode) {
+
+  if (searchMode != VS_COMPRESSED && searchMode != VS_UNCOMPRESSED && searchMode != VS_BOTH)
+    return fail(ctx, "invalid search mode");
+  ctx->searchMode = searchMode;
+  return VS_OK;
+
+}
+
+int vs_set_case_sensitive(vs_context *ctx, int caseSensitive) {
+  ctx->caseSensitive = (caseSensitive != 0);
+  return VS_OK;
+}
+
+int vs_set_hrp(vs_context *ctx, const char *hrp) {
+
+  if (hrp == NULL || hrp[0] == 0)
+    return fail(ctx, "empty hrp");
+  ctx->hrp = string(hrp);
+  return VS_OK;
+
+}
+
+int vs_set_stop_when_found(vs_context *ctx, int stop) {
+  ctx->stop = (stop != 0);
+  return VS_OK;
+}
+
+int vs_set_seed(vs_context *ctx, const char *seed, int paranoiac) {
+  ctx->seed = string(seed);
+  ctx->paranoiacSeed = (paranoiac != 0);
+  return VS_OK;
+}
+
+int vs_set_output_file(vs_context *ctx, const char *fileName) {
+  ctx->outputFile = string(fileName);
+  return VS_OK;
+}
+
+int vs_set_max_found(vs_context *ctx, uint32_t maxFound) {
+  ctx->maxFound = maxFound;
+  return VS_OK;
+}
+
+int vs_set_rekey(vs_context *ctx, uint64_t rekey) {
+  ctx->rekey = rekey;
+  return VS_OK;
+}
+
+int vs_set_sse(vs_context *ctx, int useSSE) {
+  ctx->useSSE = (useSSE != 0);
+  return VS_OK;
+}
+
+int vs_set_callback(vs_context *ctx, vs_found_callback callback, void *user) {
+  ctx->callback = callback;
+  ctx->user = user;
+  return VS_OK;
+}
+
+int vs_set_verbose(vs_context *ctx, int verbose) {
+  ctx->quiet = (verbose == 0);
+  return VS_OK;
+}
+
+int vs_save_prefixes(vs_context *ctx, const char *fileName) {
+
+  if (build(ctx, false) != VS_OK)
+    return VS_ERROR;
+  bool ok = ctx->v->SavePrefixes(string(fileName));
+  if (!ok)
+    fail(ctx, ctx->v->GetError());
+  delete ctx->v;
+  ctx->v = NULL;
+  return ok ? VS_OK : VS_ERROR;
+
+}
+
+// ----------------------------------------------------------------------------
+
+int vs_start(vs_context *ctx, int nbThread, const int *gpuId, const int *gridSize, int nbGpu) {
+
+  if (build(ctx, nbGpu > 0) != VS_OK)
+    return VS_ERROR;
+
+  if (nbGpu == 0) {
+
+    // CPU: job on a private thread pool, no console output
+    if (nbThread < 1)
+      nbThread = Timer::getCoreNumber();
+    if (ctx->sched == NULL || ctx->sched->GetNbThread() != nbThread) {
+      delete ctx->sched;
+      ctx->sched = new Scheduler(nbThread);
+    }
+    ctx->jobId = ctx->sched->AddJob(ctx->v, 0, 1.0);
+
+  } else {
+
+    // GPU: standard search in a background thread
+    ctx->nbThread = nbThread;
+    setGpu(ctx, gpuId, gridSize, nbGpu);
+    ctx->searching = true;
+    ctx->hasThread = true;
+#ifdef WIN64
+    DWORD thread_id;
+    ctx->thread = CreateThread(NULL, 0, _search, (void*)ctx, 0, &thread_id);
+#else
+    pthread_create(&ctx->thread, NULL, &_search, (void*)ctx);
+#endif
+
+  }
+
+  return VS_OK;
+
+}
+
+int vs_stop(vs_context *ctx) {
+
+  if (ctx->v != NULL)
+    ctx->v->Stop();
+  return VS_OK;
+
+}
+
+int vs_wait(vs_context *ctx) {
+
+  if (ctx->v == NULL)
+    return VS_OK;
+
+  if (ctx->hasThread) {
+#ifdef WIN64
+    WaitForSingleObject(ctx->thread, INFINITE);
+    CloseHandle(ctx->thread);
+#else
+    pthread_join(ctx->thread, NULL);
+#endif
+    ctx->hasThread = false;
+  }
+
+  if (ctx->jobId >= 0) {
+    while (!ctx->v->IsEnded())
+      Timer::SleepMillis(10);
+    ctx->sched->RemoveJob(ctx->jobId);
+    ctx->jobId = -1;
+  }
+
+  return VS_OK;
+
+}
+
+int vs_get_stats(vs_context *ctx, vs_stats *stats) {
+
+  memset(stats, 0, sizeof(vs_stats));
+  if (ctx->v == NULL)
+    return VS_OK;
+
+  VanitySearch *v = ctx->v;
+  double dt = Timer::get_tick() - v->GetStartTime();
+  stats->count = v->GetCount();
+  stats->keyRate = (dt > 0.0) ? (double)stats->count / dt : 0.0;
+  stats->found = v->GetNbFound();
+  stats->running = (ctx->hasThread ? ctx->searching : (ctx->jobId >= 0 && !v->IsEnded())) ? 1 : 0;
+  string expected = v->GetExpectedTime(stats->keyRate, (double)stats->count);
+  strncpy(stats->expected, expected.c_str(), sizeof(stats->expected) - 1);
+  return VS_OK;
+
+}
+
+int vs_search(vs_context *ctx, int nbThread, const int *gpuId, const int *gridSize, int nbGpu) {
+
+  if (build(ctx, nbGpu > 0) != VS_OK)
+    return VS_ERROR;
+
+  setGpu(ctx, gpuId, gridSize, nbGpu);
+  ctx->v->Search(nbThread, ctx->gpuId, ctx->gridSize);
+  return VS_OK;
+
+}
@@ -0,0 +1,109 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// libvanitysearch C API
+
+#ifndef VANITYSEARCHAPIH
+#define VANITYSEARCHAPIH
+
+#include <stdint.h>
+
+#if defined(WIN64) && defined(VS_BUILD_DLL)
+#define VS_API __declspec(dllexport)
+#else
+#define VS_API
+#endif
+
+#define VS_OK     0
+#define VS_ERROR -1
+
+// Search modes (same values as SEARCH_COMPRESSED...)
+#define VS_COMPRESSED   0
+#define VS_UNCOMPRESSED 1
+#define VS_BOTH         2
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct vs_context vs_context;
+
+// Called for each key found, from a search thread (one call at a time per context).
+// wif is the partial private key when a split key is set (final key: VanitySearch -rp).
+typedef void (*vs_found_callback)(void *user, const char *address, const char *wif, const char *privHex);
+
+typedef struct {
+
+  uint64_t count;       // Keys checked
+  double keyRate;       // Key/s since start
+  int found;            // Keys found
+  int running;          // 1 until the search has ended
+  char expected[64];    // Probability and expected time (prefix search only)
+
+} vs_stats;
+
+// Global init, call once before anything else (gTableFile may be NULL)
+VS_API int vs_init(int gTableBits, const char *gTableFile);
+
+VS_API vs_context *vs_create(void);
+VS_API void vs_destroy(vs_context *ctx);
+// Last error of ctx, vs_last_error(NULL) gives the vs_init() error
+VS_API const char *vs_last_error(vs_context *ctx);
+
+// Search parameters, must be set before vs_start()/vs_search()
+VS_API int vs_add_prefix(vs_context *ctx, const char *prefix);
+VS_API int vs_load_prefixes(vs_context *ctx, const char *fileName);
+VS_API int vs_set_split_key(vs_context *ctx, const char *pubKeyHex);
+VS_API int vs_set_search_mode(vs_context *ctx, int searchMode);
+VS_API int vs_set_case_sensitive(vs_context *ctx, int caseSensitive);
+// Human readable part of x-only (hrp1...) prefixes, default is "npub"
+VS_API int vs_set_hrp(vs_context *ctx, const char *hrp);
+VS_API int vs_set_stop_when_found(vs_context *ctx, int stop);
+VS_API int vs_set_seed(vs_context *ctx, const char *seed, int paranoiac);
+VS_API int vs_set_output_file(vs_context *ctx, const char *fileName);
+VS_API int vs_set_max_found(vs_context *ctx, uint32_t maxFound);
+VS_API int vs_set_rekey(vs_context *ctx, uint64_t rekey);
+VS_API int vs_set_sse(vs_context *ctx, int useSSE);
+VS_API int vs_set_callback(vs_context *ctx, vs_found_callback callback, void *user);
+// Console output (search info, ignored prefixes, progress), off by default
+VS_API int vs_set_verbose(vs_context *ctx, int verbose);
+
+// Compile the prefixes to a database usable with vs_load_prefixes()
+VS_API int vs_save_prefixes(vs_context *ctx, const char *fileName);
+
+// Start the workers and return, nbGpu = 0 for a CPU only search.
+// gridSize holds 2 values per gpu (NULL for default).
+VS_API int vs_start(vs_context *ctx, int nbThread, const int *gpuId, const int *gridSize, int nbGpu);
+VS_API int vs_stop(vs_context *ctx);
+// Returns when all the search threads have ended (vs_destroy() may follow)
+VS_API int vs_wait(vs_context *ctx);
+VS_API int vs_get_stats(vs_context *ctx, vs_stats *stats);
+
+// Blocking search (progress output when verbose), returns when all the
+// search threads have ended
+VS_API int vs_search(vs_context *ctx, int nbThread, const int *gpuId, const int *gridSize, int nbGpu);
+
+#ifdef __cplusplus
+}
+
+// Shared curve context (C++ clients)
+class Secp256K1;
+Secp256K1 *vs_secp();
+
+#endif
+
+#endif // VANITYSEARCHAPIH
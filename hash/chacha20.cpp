@@ -0,0 +1,161 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "chacha20.h"
+#include <immintrin.h>
+#include <string.h>
+
+static const uint32_t sigma[4] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+
+// ----------------------------------------------------------------------------
+
+#define ROTL(a,n) (((a) << (n)) | ((a) >> (32 - (n))))
+
+#define QR(a,b,c,d) \
+  a += b; d ^= a; d = ROTL(d,16); \
+  c += d; b ^= c; b = ROTL(b,12); \
+  a += b; d ^= a; d = ROTL(d,8);  \
+  c += d; b ^= c; b = ROTL(b,7);
+
+void chacha20_block(const uint32_t *key, uint64_t counter, uint64_t nonce, uint8_t *out) {
+
+  uint32_t s[16];
+  uint32_t x[16];
+
+  memcpy(s, sigma, 16);
+  memcpy(s + 4, key, 32);
+  s[12] = (uint32_t)counter;
+  s[13] = (uint32_t)(counter >> 32);
+  s[14] = (uint32_t)nonce;
+  s[15] = (uint32_t)(nonce >> 32);
+  memcpy(x, s, 64);
+
+  for (int i = 0; i < 10; i++) {
+    QR(x[0], x[4], x[8], x[12]);
+    QR(x[1], x[5], x[9], x[13]);
+    QR(x[2], x[6], x[10], x[14]);
+    QR(x[3], x[7], x[11], x[15]);
+    QR(x[0], x[5], x[10], x[15]);
+    QR(x[1], x[6], x[11], x[12]);
+    QR(x[2], x[7], x[8], x[13]);
+    QR(x[3], x[4], x[9], x[14]);
+  }
+
+  // Little endian output
+  for (int i = 0; i < 16; i++)
+    x[i] += s[i];
+  memcpy(out, x, 64);
+
+}
+
+// ----------------------------------------------------------------------------
+// 4 blocks in parallel, lane j of x[i] is the word i of block j
+
+#define ADD(a,b) _mm_add_epi32(a,b)
+#define XOR(a,b) _mm_xor_si128(a,b)
+#define ROTLV(a,n) _mm_or_si128(_mm_slli_epi32(a,n), _mm_srli_epi32(a,32-n))
+
+#define QRV(a,b,c,d) \
+  a = ADD(a,b); d = XOR(d,a); d = _mm_shuffle_epi8(d,rot16); \
+  c = ADD(c,d); b = XOR(b,c); b = ROTLV(b,12); \
+  a = ADD(a,b); d = XOR(d,a); d = _mm_shuffle_epi8(d,rot8); \
+  c = ADD(c,d); b = XOR(b,c); b = ROTLV(b,7);
+
+void chacha20sse_4B(const uint32_t *key, uint64_t counter, uint64_t nonce, uint8_t *out) {
+
+  __m128i s[16];
+  __m128i x[16];
+  const __m128i rot16 = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  const __m128i rot8 = _mm_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+
+  for (int i = 0; i < 4; i++)
+    s[i] = _mm_set1_epi32((int)sigma[i]);
+  for (int i = 0; i < 8; i++)
+    s[4 + i] = _mm_set1_epi32((int)key[i]);
+  uint64_t c0 = counter;
+  uint64_t c1 = counter + 1;
+  uint64_t c2 = counter + 2;
+  uint64_t c3 = counter + 3;
+  s[12] = _mm_setr_epi32((int)c0, (int)c1, (int)c2, (int)c3);
+  s[13] = _mm_setr_epi32((int)(c0 >> 32), (int)(c1 >> 32), (int)(c2 >> 32), (int)(c3 >> 32));
+  s[14] = _mm_set1_epi32((int)nonce);
+  s[15] = _mm_set1_epi32((int)(nonce >> 32));
+  for (int i = 0; i < 16; i++)
+    x[i] = s[i];
+
+  for (int i = 0; i < 10; i++) {
+    QRV(x[0], x[4], x[8], x[12]);
+    QRV(x[1], x[5], x[9], x[13]);
+    QRV(x[2], x[6], x[10], x[14]);
+    QRV(x[3], x[7], x[11], x[15]);
+    QRV(x[0], x[5], x[10], x[15]);
+    QRV(x[1], x[6], x[11], x[12]);
+    QRV(x[2], x[7], x[8], x[13]);
+    QRV(x[3], x[4], x[9], x[14]);
+  }
+
+  for (int i = 0; i < 16; i++)
+    x[i] = ADD(x[i], s[i]);
+
+  // Transpose 4x4 words
+  for (int i = 0; i < 16; i += 4) {
+    __m128i t0 = _mm_unpacklo_epi32(x[i], x[i + 1]);
+    __m128i t1 = _mm_unpacklo_epi32(x[i + 2], x[i + 3]);
+    __m128i t2 = _mm_unpackhi_epi32(x[i], x[i + 1]);
+    __m128i t3 = _mm_unpackhi_epi32(x[i + 2], x[i + 3]);
+    _mm_storeu_si128((__m128i *)(out + i * 4), _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(out + 64 + i * 4), _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(out + 128 + i * 4), _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128((__m128i *)(out + 192 + i * 4), _mm_unpackhi_epi64(t2, t3));
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+void chacha20_drbg_init(CHACHA20_DRBG *d, const uint8_t *seed, uint64_t stream) {
+
+  memcpy(d->key, seed, 32);
+  d->stream = stream;
+  d->pos = sizeof(d->buffer);
+
+}
+
+void chacha20_drbg_rand(CHACHA20_DRBG *d, uint8_t *out, size_t length) {
+
+  while (length > 0) {
+
+    if (d->pos == sizeof(d->buffer)) {
+      // The key changes at each refill, the counter can restart at 0
+      chacha20sse_4B(d->key, 0, d->stream, d->buffer);
+      memcpy(d->key, d->buffer, 32);
+      memset(d->buffer, 0, 32);
+      d->pos = 32;
+    }
+
+    size_t n = sizeof(d->buffer) - d->pos;
+    if (n > length) n = length;
+    memcpy(out, d->buffer + d->pos, n);
+    // Erase what has been given
+    memset(d->buffer + d->pos, 0, n);
+    d->pos += (int)n;
+    out += n;
+    length -= n;
+
+  }
+
+}
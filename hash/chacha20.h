@@ -0,0 +1,43 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CHACHA20_H
+#define CHACHA20_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// ChaCha20 (original variant: 64 bit counter, 64 bit nonce)
+void chacha20_block(const uint32_t *key, uint64_t counter, uint64_t nonce, uint8_t *out);
+// 4 consecutive blocks (256 bytes), SSE
+void chacha20sse_4B(const uint32_t *key, uint64_t counter, uint64_t nonce, uint8_t *out);
+
+// DRBG with fast key erasure: each refill produces 4 blocks, the first 32
+// bytes become the next key. One instance per thread (stream = thread id).
+typedef struct {
+
+  uint32_t key[8];
+  uint64_t stream;
+  uint8_t buffer[256];
+  int pos;
+
+} CHACHA20_DRBG;
+
+void chacha20_drbg_init(CHACHA20_DRBG *d, const uint8_t *seed, uint64_t stream);
+void chacha20_drbg_rand(CHACHA20_DRBG *d, uint8_t *out, size_t length);
+
+#endif
@@ -0,0 +1,584 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "hash160.h"
+#include <immintrin.h>
+#include <string.h>
+
+#ifdef WIN64
+#define INLINE __forceinline
+#else
+#define INLINE inline __attribute__((always_inline))
+#endif
+
+// Fused SHA256 + RIPEMD160. The transforms are inlined in each kernel so the
+// constant message words (padding, length, RIPEMD160 input padding) and the
+// initial states are propagated by the compiler: their part of the message
+// schedule and of the first rounds is computed at compile time.
+
+namespace _hash160sse {
+
+#define add3(x0, x1, x2 ) _mm_add_epi32(_mm_add_epi32(x0, x1), x2)
+#define add4(x0, x1, x2, x3) _mm_add_epi32(_mm_add_epi32(x0, x1), _mm_add_epi32(x2, x3))
+#define add5(x0, x1, x2, x3, x4) _mm_add_epi32(add3(x0, x1, x2), _mm_add_epi32(x3, x4))
+
+// SHA256 ---------------------------------------------------------------------
+
+#define Maj(b,c,d) _mm_or_si128(_mm_and_si128(b, c), _mm_and_si128(d, _mm_or_si128(b, c)) )
+#define Ch(b,c,d)  _mm_xor_si128(_mm_and_si128(b, c) , _mm_andnot_si128(b , d) )
+#define ROR(x,n)   _mm_or_si128( _mm_srli_epi32(x, n) , _mm_slli_epi32(x, 32 - n) )
+#define SHR(x,n)   _mm_srli_epi32(x, n)
+
+#define S0(x) (_mm_xor_si128(ROR((x), 2) , _mm_xor_si128(ROR((x), 13), ROR((x), 22))))
+#define S1(x) (_mm_xor_si128(ROR((x), 6) , _mm_xor_si128(ROR((x), 11), ROR((x), 25))))
+#define s0(x) (_mm_xor_si128(ROR((x), 7) , _mm_xor_si128(ROR((x), 18), SHR((x), 3))))
+#define s1(x) (_mm_xor_si128(ROR((x), 17), _mm_xor_si128(ROR((x), 19), SHR((x), 10))))
+
+#define Round(a, b, c, d, e, f, g, h, i, w)                 \
+    T1 = add5(h, S1(e), Ch(e, f, g), _mm_set1_epi32(i), w); \
+    d = _mm_add_epi32(d, T1);                               \
+    T2 = _mm_add_epi32(S0(a), Maj(a, b, c));                \
+    h = _mm_add_epi32(T1, T2);
+
+#define WMIX() \
+  w[0] = add4(s1(w[14]), w[9], s0(w[1]), w[0]); \
+  w[1] = add4(s1(w[15]), w[10], s0(w[2]), w[1]); \
+  w[2] = add4(s1(w[0]), w[11], s0(w[3]), w[2]); \
+  w[3] = add4(s1(w[1]), w[12], s0(w[4]), w[3]); \
+  w[4] = add4(s1(w[2]), w[13], s0(w[5]), w[4]); \
+  w[5] = add4(s1(w[3]), w[14], s0(w[6]), w[5]); \
+  w[6] = add4(s1(w[4]), w[15], s0(w[7]), w[6]); \
+  w[7] = add4(s1(w[5]), w[0], s0(w[8]), w[7]); \
+  w[8] = add4(s1(w[6]), w[1], s0(w[9]), w[8]); \
+  w[9] = add4(s1(w[7]), w[2], s0(w[10]), w[9]); \
+  w[10] = add4(s1(w[8]), w[3], s0(w[11]), w[10]); \
+  w[11] = add4(s1(w[9]), w[4], s0(w[12]), w[11]); \
+  w[12] = add4(s1(w[10]), w[5], s0(w[13]), w[12]); \
+  w[13] = add4(s1(w[11]), w[6], s0(w[14]), w[13]); \
+  w[14] = add4(s1(w[12]), w[7], s0(w[15]), w[14]); \
+  w[15] = add4(s1(w[13]), w[8], s0(w[0]), w[15]);
+
+  INLINE void sha256Initialize(__m128i *s) {
+    s[0] = _mm_set1_epi32(0x6a09e667);
+    s[1] = _mm_set1_epi32(0xbb67ae85);
+    s[2] = _mm_set1_epi32(0x3c6ef372);
+    s[3] = _mm_set1_epi32(0xa54ff53a);
+    s[4] = _mm_set1_epi32(0x510e527f);
+    s[5] = _mm_set1_epi32(0x9b05688c);
+    s[6] = _mm_set1_epi32(0x1f83d9ab);
+    s[7] = _mm_set1_epi32(0x5be0cd19);
+  }
+
+  INLINE void sha256Transform(__m128i *s, __m128i *w) {
+
+    __m128i a = s[0];
+    __m128i b = s[1];
+    __m128i c = s[2];
+    __m128i d = s[3];
+    __m128i e = s[4];
+    __m128i f = s[5];
+    __m128i g = s[6];
+    __m128i h = s[7];
+    __m128i T1, T2;
+
+    Round(a, b, c, d, e, f, g, h, 0x428A2F98, w[0]);
+    Round(h, a, b, c, d, e, f, g, 0x71374491, w[1]);
+    Round(g, h, a, b, c, d, e, f, 0xB5C0FBCF, w[2]);
+    Round(f, g, h, a, b, c, d, e, 0xE9B5DBA5, w[3]);
+    Round(e, f, g, h, a, b, c, d, 0x3956C25B, w[4]);
+    Round(d, e, f, g, h, a, b, c, 0x59F111F1, w[5]);
+    Round(c, d, e, f, g, h, a, b, 0x923F82A4, w[6]);
+    Round(b, c, d, e, f, g, h, a, 0xAB1C5ED5, w[7]);
+    Round(a, b, c, d, e, f, g, h, 0xD807AA98, w[8]);
+    Round(h, a, b, c, d, e, f, g, 0x12835B01, w[9]);
+    Round(g, h, a, b, c, d, e, f, 0x243185BE, w[10]);
+    Round(f, g, h, a, b, c, d, e, 0x550C7DC3, w[11]);
+    Round(e, f, g, h, a, b, c, d, 0x72BE5D74, w[12]);
+    Round(d, e, f, g, h, a, b, c, 0x80DEB1FE, w[13]);
+    Round(c, d, e, f, g, h, a, b, 0x9BDC06A7, w[14]);
+    Round(b, c, d, e, f, g, h, a, 0xC19BF174, w[15]);
+
+    WMIX()
+
+    Round(a, b, c, d, e, f, g, h, 0xE49B69C1, w[0]);
+    Round(h, a, b, c, d, e, f, g, 0xEFBE4786, w[1]);
+    Round(g, h, a, b, c, d, e, f, 0x0FC19DC6, w[2]);
+    Round(f, g, h, a, b, c, d, e, 0x240CA1CC, w[3]);
+    Round(e, f, g, h, a, b, c, d, 0x2DE92C6F, w[4]);
+    Round(d, e, f, g, h, a, b, c, 0x4A7484AA, w[5]);
+    Round(c, d, e, f, g, h, a, b, 0x5CB0A9DC, w[6]);
+    Round(b, c, d, e, f, g, h, a, 0x76F988DA, w[7]);
+    Round(a, b, c, d, e, f, g, h, 0x983E5152, w[8]);
+    Round(h, a, b, c, d, e, f, g, 0xA831C66D, w[9]);
+    Round(g, h, a, b, c, d, e, f, 0xB00327C8, w[10]);
+    Round(f, g, h, a, b, c, d, e, 0xBF597FC7, w[11]);
+    Round(e, f, g, h, a, b, c, d, 0xC6E00BF3, w[12]);
+    Round(d, e, f, g, h, a, b, c, 0xD5A79147, w[13]);
+    Round(c, d, e, f, g, h, a, b, 0x06CA6351, w[14]);
+    Round(b, c, d, e, f, g, h, a, 0x14292967, w[15]);
+
+    WMIX()
+
+    Round(a, b, c, d, e, f, g, h, 0x27B70A85, w[0]);
+    Round(h, a, b, c, d, e, f, g, 0x2E1B2138, w[1]);
+    Round(g, h, a, b, c, d, e, f, 0x4D2C6DFC, w[2]);
+    Round(f, g, h, a, b, c, d, e, 0x53380D13, w[3]);
+    Round(e, f, g, h, a, b, c, d, 0x650A7354, w[4]);
+    Round(d, e, f, g, h, a, b, c, 0x766A0ABB, w[5]);
+    Round(c, d, e, f, g, h, a, b, 0x81C2C92E, w[6]);
+    Round(b, c, d, e, f, g, h, a, 0x92722C85, w[7]);
+    Round(a, b, c, d, e, f, g, h, 0xA2BFE8A1, w[8]);
+    Round(h, a, b, c, d, e, f, g, 0xA81A664B, w[9]);
+    Round(g, h, a, b, c, d, e, f, 0xC24B8B70, w[10]);
+    Round(f, g, h, a, b, c, d, e, 0xC76C51A3, w[11]);
+    Round(e, f, g, h, a, b, c, d, 0xD192E819, w[12]);
+    Round(d, e, f, g, h, a, b, c, 0xD6990624, w[13]);
+    Round(c, d, e, f, g, h, a, b, 0xF40E3585, w[14]);
+    Round(b, c, d, e, f, g, h, a, 0x106AA070, w[15]);
+
+    WMIX()
+
+    Round(a, b, c, d, e, f, g, h, 0x19A4C116, w[0]);
+    Round(h, a, b, c, d, e, f, g, 0x1E376C08, w[1]);
+    Round(g, h, a, b, c, d, e, f, 0x2748774C, w[2]);
+    Round(f, g, h, a, b, c, d, e, 0x34B0BCB5, w[3]);
+    Round(e, f, g, h, a, b, c, d, 0x391C0CB3, w[4]);
+    Round(d, e, f, g, h, a, b, c, 0x4ED8AA4A, w[5]);
+    Round(c, d, e, f, g, h, a, b, 0x5B9CCA4F, w[6]);
+    Round(b, c, d, e, f, g, h, a, 0x682E6FF3, w[7]);
+    Round(a, b, c, d, e, f, g, h, 0x748F82EE, w[8]);
+    Round(h, a, b, c, d, e, f, g, 0x78A5636F, w[9]);
+    Round(g, h, a, b, c, d, e, f, 0x84C87814, w[10]);
+    Round(f, g, h, a, b, c, d, e, 0x8CC70208, w[11]);
+    Round(e, f, g, h, a, b, c, d, 0x90BEFFFA, w[12]);
+    Round(d, e, f, g, h, a, b, c, 0xA4506CEB, w[13]);
+    Round(c, d, e, f, g, h, a, b, 0xBEF9A3F7, w[14]);
+    Round(b, c, d, e, f, g, h, a, 0xC67178F2, w[15]);
+
+    s[0] = _mm_add_epi32(a, s[0]);
+    s[1] = _mm_add_epi32(b, s[1]);
+    s[2] = _mm_add_epi32(c, s[2]);
+    s[3] = _mm_add_epi32(d, s[3]);
+    s[4] = _mm_add_epi32(e, s[4]);
+    s[5] = _mm_add_epi32(f, s[5]);
+    s[6] = _mm_add_epi32(g, s[6]);
+    s[7] = _mm_add_epi32(h, s[7]);
+
+  }
+
+  // Out of line version for the 65 bytes message (measured slower when
+  // the 2 blocks are inlined)
+#ifdef WIN64
+  __declspec(noinline)
+#else
+  __attribute__((noinline))
+#endif
+  void sha256TransformBlock(__m128i *s, __m128i *w) {
+    sha256Transform(s, w);
+  }
+
+#undef Round
+
+// RIPEMD160 ------------------------------------------------------------------
+
+#define ROL(x,n) _mm_or_si128( _mm_slli_epi32(x, n) , _mm_srli_epi32(x, 32 - n) )
+
+#ifdef WIN64
+
+#define not(x) _mm_andnot_si128(x, _mm_cmpeq_epi32(_mm_setzero_si128(), _mm_setzero_si128()))
+#define f1(x,y,z) _mm_xor_si128(x, _mm_xor_si128(y, z))
+#define f2(x,y,z) _mm_or_si128(_mm_and_si128(x,y),_mm_andnot_si128(x,z))
+#define f3(x,y,z) _mm_xor_si128(_mm_or_si128(x,not(y)),z)
+#define f4(x,y,z) _mm_or_si128(_mm_and_si128(x,z),_mm_andnot_si128(z,y))
+#define f5(x,y,z) _mm_xor_si128(x,_mm_or_si128(y,not(z)))
+
+#else
+
+#define f1(x,y,z) _mm_xor_si128(x, _mm_xor_si128(y, z))
+#define f2(x,y,z) _mm_or_si128(_mm_and_si128(x,y),_mm_andnot_si128(x,z))
+#define f3(x,y,z) _mm_xor_si128(_mm_or_si128(x,~(y)),z)
+#define f4(x,y,z) _mm_or_si128(_mm_and_si128(x,z),_mm_andnot_si128(z,y))
+#define f5(x,y,z) _mm_xor_si128(x,_mm_or_si128(y,~(z)))
+
+#endif
+
+#define Round(a,b,c,d,e,f,x,k,r) \
+  u = add4(a,f,x,_mm_set1_epi32(k)); \
+  a = _mm_add_epi32(ROL(u, r),e); \
+  c = ROL(c, 10);
+
+#define R11(a,b,c,d,e,x,r) Round(a, b, c, d, e, f1(b, c, d), x, 0, r)
+#define R21(a,b,c,d,e,x,r) Round(a, b, c, d, e, f2(b, c, d), x, 0x5A827999ul, r)
+#define R31(a,b,c,d,e,x,r) Round(a, b, c, d, e, f3(b, c, d), x, 0x6ED9EBA1ul, r)
+#define R41(a,b,c,d,e,x,r) Round(a, b, c, d, e, f4(b, c, d), x, 0x8F1BBCDCul, r)
+#define R51(a,b,c,d,e,x,r) Round(a, b, c, d, e, f5(b, c, d), x, 0xA953FD4Eul, r)
+#define R12(a,b,c,d,e,x,r) Round(a, b, c, d, e, f5(b, c, d), x, 0x50A28BE6ul, r)
+#define R22(a,b,c,d,e,x,r) Round(a, b, c, d, e, f4(b, c, d), x, 0x5C4DD124ul, r)
+#define R32(a,b,c,d,e,x,r) Round(a, b, c, d, e, f3(b, c, d), x, 0x6D703EF3ul, r)
+#define R42(a,b,c,d,e,x,r) Round(a, b, c, d, e, f2(b, c, d), x, 0x7A6D76E9ul, r)
+#define R52(a,b,c,d,e,x,r) Round(a, b, c, d, e, f1(b, c, d), x, 0, r)
+
+  // RIPEMD160 of the 32 bytes SHA256 digests held in s (big endian words)
+  INLINE void ripemd160Final(__m128i *s, __m128i *r) {
+
+    const __m128i bswap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    __m128i w[16];
+
+    w[0] = _mm_shuffle_epi8(s[0], bswap);
+    w[1] = _mm_shuffle_epi8(s[1], bswap);
+    w[2] = _mm_shuffle_epi8(s[2], bswap);
+    w[3] = _mm_shuffle_epi8(s[3], bswap);
+    w[4] = _mm_shuffle_epi8(s[4], bswap);
+    w[5] = _mm_shuffle_epi8(s[5], bswap);
+    w[6] = _mm_shuffle_epi8(s[6], bswap);
+    w[7] = _mm_shuffle_epi8(s[7], bswap);
+    w[8] = _mm_set1_epi32(0x80);
+    w[9] = _mm_setzero_si128();
+    w[10] = _mm_setzero_si128();
+    w[11] = _mm_setzero_si128();
+    w[12] = _mm_setzero_si128();
+    w[13] = _mm_setzero_si128();
+    w[14] = _mm_set1_epi32(32 << 3);
+    w[15] = _mm_setzero_si128();
+
+    __m128i a1 = _mm_set1_epi32(0x67452301ul);
+    __m128i b1 = _mm_set1_epi32(0xEFCDAB89ul);
+    __m128i c1 = _mm_set1_epi32(0x98BADCFEul);
+    __m128i d1 = _mm_set1_epi32(0x10325476ul);
+    __m128i e1 = _mm_set1_epi32(0xC3D2E1F0ul);
+    __m128i a2 = a1;
+    __m128i b2 = b1;
+    __m128i c2 = c1;
+    __m128i d2 = d1;
+    __m128i e2 = e1;
+    __m128i u;
+
+    R11(a1, b1, c1, d1, e1, w[0], 11);
+    R12(a2, b2, c2, d2, e2, w[5], 8);
+    R11(e1, a1, b1, c1, d1, w[1], 14);
+    R12(e2, a2, b2, c2, d2, w[14], 9);
+    R11(d1, e1, a1, b1, c1, w[2], 15);
+    R12(d2, e2, a2, b2, c2, w[7], 9);
+    R11(c1, d1, e1, a1, b1, w[3], 12);
+    R12(c2, d2, e2, a2, b2, w[0], 11);
+    R11(b1, c1, d1, e1, a1, w[4], 5);
+    R12(b2, c2, d2, e2, a2, w[9], 13);
+    R11(a1, b1, c1, d1, e1, w[5], 8);
+    R12(a2, b2, c2, d2, e2, w[2], 15);
+    R11(e1, a1, b1, c1, d1, w[6], 7);
+    R12(e2, a2, b2, c2, d2, w[11], 15);
+    R11(d1, e1, a1, b1, c1, w[7], 9);
+    R12(d2, e2, a2, b2, c2, w[4], 5);
+    R11(c1, d1, e1, a1, b1, w[8], 11);
+    R12(c2, d2, e2, a2, b2, w[13], 7);
+    R11(b1, c1, d1, e1, a1, w[9], 13);
+    R12(b2, c2, d2, e2, a2, w[6], 7);
+    R11(a1, b1, c1, d1, e1, w[10], 14);
+    R12(a2, b2, c2, d2, e2, w[15], 8);
+    R11(e1, a1, b1, c1, d1, w[11], 15);
+    R12(e2, a2, b2, c2, d2, w[8], 11);
+    R11(d1, e1, a1, b1, c1, w[12], 6);
+    R12(d2, e2, a2, b2, c2, w[1], 14);
+    R11(c1, d1, e1, a1, b1, w[13], 7);
+    R12(c2, d2, e2, a2, b2, w[10], 14);
+    R11(b1, c1, d1, e1, a1, w[14], 9);
+    R12(b2, c2, d2, e2, a2, w[3], 12);
+    R11(a1, b1, c1, d1, e1, w[15], 8);
+    R12(a2, b2, c2, d2, e2, w[12], 6);
+
+    R21(e1, a1, b1, c1, d1, w[7], 7);
+    R22(e2, a2, b2, c2, d2, w[6], 9);
+    R21(d1, e1, a1, b1, c1, w[4], 6);
+    R22(d2, e2, a2, b2, c2, w[11], 13);
+    R21(c1, d1, e1, a1, b1, w[13], 8);
+    R22(c2, d2, e2, a2, b2, w[3], 15);
+    R21(b1, c1, d1, e1, a1, w[1], 13);
+    R22(b2, c2, d2, e2, a2, w[7], 7);
+    R21(a1, b1, c1, d1, e1, w[10], 11);
+    R22(a2, b2, c2, d2, e2, w[0], 12);
+    R21(e1, a1, b1, c1, d1, w[6], 9);
+    R22(e2, a2, b2, c2, d2, w[13], 8);
+    R21(d1, e1, a1, b1, c1, w[15], 7);
+    R22(d2, e2, a2, b2, c2, w[5], 9);
+    R21(c1, d1, e1, a1, b1, w[3], 15);
+    R22(c2, d2, e2, a2, b2, w[10], 11);
+    R21(b1, c1, d1, e1, a1, w[12], 7);
+    R22(b2, c2, d2, e2, a2, w[14], 7);
+    R21(a1, b1, c1, d1, e1, w[0], 12);
+    R22(a2, b2, c2, d2, e2, w[15], 7);
+    R21(e1, a1, b1, c1, d1, w[9], 15);
+    R22(e2, a2, b2, c2, d2, w[8], 12);
+    R21(d1, e1, a1, b1, c1, w[5], 9);
+    R22(d2, e2, a2, b2, c2, w[12], 7);
+    R21(c1, d1, e1, a1, b1, w[2], 11);
+    R22(c2, d2, e2, a2, b2, w[4], 6);
+    R21(b1, c1, d1, e1, a1, w[14], 7);
+    R22(b2, c2, d2, e2, a2, w[9], 15);
+    R21(a1, b1, c1, d1, e1, w[11], 13);
+    R22(a2, b2, c2, d2, e2, w[1], 13);
+    R21(e1, a1, b1, c1, d1, w[8], 12);
+    R22(e2, a2, b2, c2, d2, w[2], 11);
+
+    R31(d1, e1, a1, b1, c1, w[3], 11);
+    R32(d2, e2, a2, b2, c2, w[15], 9);
+    R31(c1, d1, e1, a1, b1, w[10], 13);
+    R32(c2, d2, e2, a2, b2, w[5], 7);
+    R31(b1, c1, d1, e1, a1, w[14], 6);
+    R32(b2, c2, d2, e2, a2, w[1], 15);
+    R31(a1, b1, c1, d1, e1, w[4], 7);
+    R32(a2, b2, c2, d2, e2, w[3], 11);
+    R31(e1, a1, b1, c1, d1, w[9], 14);
+    R32(e2, a2, b2, c2, d2, w[7], 8);
+    R31(d1, e1, a1, b1, c1, w[15], 9);
+    R32(d2, e2, a2, b2, c2, w[14], 6);
+    R31(c1, d1, e1, a1, b1, w[8], 13);
+    R32(c2, d2, e2, a2, b2, w[6], 6);
+    R31(b1, c1, d1, e1, a1, w[1], 15);
+    R32(b2, c2, d2, e2, a2, w[9], 14);
+    R31(a1, b1, c1, d1, e1, w[2], 14);
+    R32(a2, b2, c2, d2, e2, w[11], 12);
+    R31(e1, a1, b1, c1, d1, w[7], 8);
+    R32(e2, a2, b2, c2, d2, w[8], 13);
+    R31(d1, e1, a1, b1, c1, w[0], 13);
+    R32(d2, e2, a2, b2, c2, w[12], 5);
+    R31(c1, d1, e1, a1, b1, w[6], 6);
+    R32(c2, d2, e2, a2, b2, w[2], 14);
+    R31(b1, c1, d1, e1, a1, w[13], 5);
+    R32(b2, c2, d2, e2, a2, w[10], 13);
+    R31(a1, b1, c1, d1, e1, w[11], 12);
+    R32(a2, b2, c2, d2, e2, w[0], 13);
+    R31(e1, a1, b1, c1, d1, w[5], 7);
+    R32(e2, a2, b2, c2, d2, w[4], 7);
+    R31(d1, e1, a1, b1, c1, w[12], 5);
+    R32(d2, e2, a2, b2, c2, w[13], 5);
+
+    R41(c1, d1, e1, a1, b1, w[1], 11);
+    R42(c2, d2, e2, a2, b2, w[8], 15);
+    R41(b1, c1, d1, e1, a1, w[9], 12);
+    R42(b2, c2, d2, e2, a2, w[6], 5);
+    R41(a1, b1, c1, d1, e1, w[11], 14);
+    R42(a2, b2, c2, d2, e2, w[4], 8);
+    R41(e1, a1, b1, c1, d1, w[10], 15);
+    R42(e2, a2, b2, c2, d2, w[1], 11);
+    R41(d1, e1, a1, b1, c1, w[0], 14);
+    R42(d2, e2, a2, b2, c2, w[3], 14);
+    R41(c1, d1, e1, a1, b1, w[8], 15);
+    R42(c2, d2, e2, a2, b2, w[11], 14);
+    R41(b1, c1, d1, e1, a1, w[12], 9);
+    R42(b2, c2, d2, e2, a2, w[15], 6);
+    R41(a1, b1, c1, d1, e1, w[4], 8);
+    R42(a2, b2, c2, d2, e2, w[0], 14);
+    R41(e1, a1, b1, c1, d1, w[13], 9);
+    R42(e2, a2, b2, c2, d2, w[5], 6);
+    R41(d1, e1, a1, b1, c1, w[3], 14);
+    R42(d2, e2, a2, b2, c2, w[12], 9);
+    R41(c1, d1, e1, a1, b1, w[7], 5);
+    R42(c2, d2, e2, a2, b2, w[2], 12);
+    R41(b1, c1, d1, e1, a1, w[15], 6);
+    R42(b2, c2, d2, e2, a2, w[13], 9);
+    R41(a1, b1, c1, d1, e1, w[14], 8);
+    R42(a2, b2, c2, d2, e2, w[9], 12);
+    R41(e1, a1, b1, c1, d1, w[5], 6);
+    R42(e2, a2, b2, c2, d2, w[7], 5);
+    R41(d1, e1, a1, b1, c1, w[6], 5);
+    R42(d2, e2, a2, b2, c2, w[10], 15);
+    R41(c1, d1, e1, a1, b1, w[2], 12);
+    R42(c2, d2, e2, a2, b2, w[14], 8);
+
+    R51(b1, c1, d1, e1, a1, w[4], 9);
+    R52(b2, c2, d2, e2, a2, w[12], 8);
+    R51(a1, b1, c1, d1, e1, w[0], 15);
+    R52(a2, b2, c2, d2, e2, w[15], 5);
+    R51(e1, a1, b1, c1, d1, w[5], 5);
+    R52(e2, a2, b2, c2, d2, w[10], 12);
+    R51(d1, e1, a1, b1, c1, w[9], 11);
+    R52(d2, e2, a2, b2, c2, w[4], 9);
+    R51(c1, d1, e1, a1, b1, w[7], 6);
+    R52(c2, d2, e2, a2, b2, w[1], 12);
+    R51(b1, c1, d1, e1, a1, w[12], 8);
+    R52(b2, c2, d2, e2, a2, w[5], 5);
+    R51(a1, b1, c1, d1, e1, w[2], 13);
+    R52(a2, b2, c2, d2, e2, w[8], 14);
+    R51(e1, a1, b1, c1, d1, w[10], 12);
+    R52(e2, a2, b2, c2, d2, w[7], 6);
+    R51(d1, e1, a1, b1, c1, w[14], 5);
+    R52(d2, e2, a2, b2, c2, w[6], 8);
+    R51(c1, d1, e1, a1, b1, w[1], 12);
+    R52(c2, d2, e2, a2, b2, w[2], 13);
+    R51(b1, c1, d1, e1, a1, w[3], 13);
+    R52(b2, c2, d2, e2, a2, w[13], 6);
+    R51(a1, b1, c1, d1, e1, w[8], 14);
+    R52(a2, b2, c2, d2, e2, w[14], 5);
+    R51(e1, a1, b1, c1, d1, w[11], 11);
+    R52(e2, a2, b2, c2, d2, w[0], 15);
+    R51(d1, e1, a1, b1, c1, w[6], 8);
+    R52(d2, e2, a2, b2, c2, w[3], 13);
+    R51(c1, d1, e1, a1, b1, w[15], 5);
+    R52(c2, d2, e2, a2, b2, w[9], 11);
+    R51(b1, c1, d1, e1, a1, w[13], 6);
+    R52(b2, c2, d2, e2, a2, w[11], 11);
+
+    r[0] = add3(_mm_set1_epi32(0xEFCDAB89ul), c1, d2);
+    r[1] = add3(_mm_set1_epi32(0x98BADCFEul), d1, e2);
+    r[2] = add3(_mm_set1_epi32(0x10325476ul), e1, a2);
+    r[3] = add3(_mm_set1_epi32(0xC3D2E1F0ul), a1, b2);
+    r[4] = add3(_mm_set1_epi32(0x67452301ul), b1, c2);
+
+  }
+
+} // namespace _hash160sse
+
+#define LOADW(i) _mm_set_epi32(i0[i], i1[i], i2[i], i3[i])
+
+// r[] is stored to an aligned buffer, lane i of r[k] is rb[4*k+i]
+#ifdef WIN64
+#define RBUFFER __declspec(align(16)) uint32_t rb[20]
+#else
+#define RBUFFER uint32_t rb[20] __attribute__ ((aligned (16)))
+#endif
+
+#define DEPACK(d,i) \
+((uint32_t *)d)[0] = rb[i]; \
+((uint32_t *)d)[1] = rb[4 + i]; \
+((uint32_t *)d)[2] = rb[8 + i]; \
+((uint32_t *)d)[3] = rb[12 + i]; \
+((uint32_t *)d)[4] = rb[16 + i];
+
+#define UNPACK() \
+  _hash160sse::ripemd160Final(s, r); \
+  RBUFFER; \
+  _mm_store_si128((__m128i *)(rb + 0), r[0]); \
+  _mm_store_si128((__m128i *)(rb + 4), r[1]); \
+  _mm_store_si128((__m128i *)(rb + 8), r[2]); \
+  _mm_store_si128((__m128i *)(rb + 12), r[3]); \
+  _mm_store_si128((__m128i *)(rb + 16), r[4]); \
+  DEPACK(d0, 3); \
+  DEPACK(d1, 2); \
+  DEPACK(d2, 1); \
+  DEPACK(d3, 0);
+
+// ----------------------------------------------------------------------------
+
+void hash160sse_33(uint32_t *i0, uint32_t *i1, uint32_t *i2, uint32_t *i3,
+                   uint8_t *d0, uint8_t *d1, uint8_t *d2, uint8_t *d3) {
+
+  __m128i s[8];
+  __m128i w[16];
+  __m128i r[5];
+
+  w[0] = LOADW(0);
+  w[1] = LOADW(1);
+  w[2] = LOADW(2);
+  w[3] = LOADW(3);
+  w[4] = LOADW(4);
+  w[5] = LOADW(5);
+  w[6] = LOADW(6);
+  w[7] = LOADW(7);
+  w[8] = LOADW(8);
+  w[9] = _mm_setzero_si128();
+  w[10] = _mm_setzero_si128();
+  w[11] = _mm_setzero_si128();
+  w[12] = _mm_setzero_si128();
+  w[13] = _mm_setzero_si128();
+  w[14] = _mm_setzero_si128();
+  w[15] = _mm_set1_epi32(33 << 3);
+
+  _hash160sse::sha256Initialize(s);
+  _hash160sse::sha256Transform(s, w);
+  UNPACK();
+
+}
+
+void hash160sse_65(uint32_t *i0, uint32_t *i1, uint32_t *i2, uint32_t *i3,
+                   uint8_t *d0, uint8_t *d1, uint8_t *d2, uint8_t *d3) {
+
+  __m128i s[8];
+  __m128i w[16];
+  __m128i r[5];
+
+  w[0] = LOADW(0);
+  w[1] = LOADW(1);
+  w[2] = LOADW(2);
+  w[3] = LOADW(3);
+  w[4] = LOADW(4);
+  w[5] = LOADW(5);
+  w[6] = LOADW(6);
+  w[7] = LOADW(7);
+  w[8] = LOADW(8);
+  w[9] = LOADW(9);
+  w[10] = LOADW(10);
+  w[11] = LOADW(11);
+  w[12] = LOADW(12);
+  w[13] = LOADW(13);
+  w[14] = LOADW(14);
+  w[15] = LOADW(15);
+
+  _hash160sse::sha256Initialize(s);
+  _hash160sse::sha256TransformBlock(s, w);
+
+  // Last block: 1 byte + padding
+  w[0] = LOADW(16);
+  w[1] = _mm_setzero_si128();
+  w[2] = _mm_setzero_si128();
+  w[3] = _mm_setzero_si128();
+  w[4] = _mm_setzero_si128();
+  w[5] = _mm_setzero_si128();
+  w[6] = _mm_setzero_si128();
+  w[7] = _mm_setzero_si128();
+  w[8] = _mm_setzero_si128();
+  w[9] = _mm_setzero_si128();
+  w[10] = _mm_setzero_si128();
+  w[11] = _mm_setzero_si128();
+  w[12] = _mm_setzero_si128();
+  w[13] = _mm_setzero_si128();
+  w[14] = _mm_setzero_si128();
+  w[15] = _mm_set1_epi32(65 << 3);
+
+  _hash160sse::sha256TransformBlock(s, w);
+  UNPACK();
+
+}
+
+void hash160sse_22(uint32_t *i0, uint32_t *i1, uint32_t *i2, uint32_t *i3,
+                   uint8_t *d0, uint8_t *d1, uint8_t *d2, uint8_t *d3) {
+
+  __m128i s[8];
+  __m128i w[16];
+  __m128i r[5];
+
+  w[0] = LOADW(0);
+  w[1] = LOADW(1);
+  w[2] = LOADW(2);
+  w[3] = LOADW(3);
+  w[4] = LOADW(4);
+  w[5] = LOADW(5);
+  w[6] = _mm_setzero_si128();
+  w[7] = _mm_setzero_si128();
+  w[8] = _mm_setzero_si128();
+  w[9] = _mm_setzero_si128();
+  w[10] = _mm_setzero_si128();
+  w[11] = _mm_setzero_si128();
+  w[12] = _mm_setzero_si128();
+  w[13] = _mm_setzero_si128();
+  w[14] = _mm_setzero_si128();
+  w[15] = _mm_set1_epi32(22 << 3);
+
+  _hash160sse::sha256Initialize(s);
+  _hash160sse::sha256Transform(s, w);
+  UNPACK();
+
+}
@@ -0,0 +1,38 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HASH160_H
+#define HASH160_H
+
+#include <stdint.h>
+
+// RIPEMD160(SHA256(m)) of 4 messages, SSE. Inputs are the big endian message
+// words, the last one holds the 0x80 padding byte (see KEYBUFF macros).
+// The SHA256 state is passed to RIPEMD160 in registers, the padding of the
+// RIPEMD160 block and of the 33 and 22 bytes messages is folded at compile time.
+
+// Compressed public key (33 bytes, 9 words)
+void hash160sse_33(uint32_t *i0, uint32_t *i1, uint32_t *i2, uint32_t *i3,
+                   uint8_t *d0, uint8_t *d1, uint8_t *d2, uint8_t *d3);
+// Uncompressed public key (65 bytes, 17 words)
+void hash160sse_65(uint32_t *i0, uint32_t *i1, uint32_t *i2, uint32_t *i3,
+                   uint8_t *d0, uint8_t *d1, uint8_t *d2, uint8_t *d3);
+// P2WPKH redeem script (22 bytes, 6 words)
+void hash160sse_22(uint32_t *i0, uint32_t *i1, uint32_t *i2, uint32_t *i3,
+                   uint8_t *d0, uint8_t *d1, uint8_t *d2, uint8_t *d3);
+
+#endif // HASH160_H
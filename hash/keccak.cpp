@@ -0,0 +1,220 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "keccak.h"
+#include <immintrin.h>
+#include <string.h>
+
+static const uint64_t RC[24] = {
+  0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+  0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+  0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+  0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+  0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+  0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+// ----------------------------------------------------------------------------
+// Keccak-f[1600] round, s[x+5y] is the lane (x,y).
+// Theta, Rho and Pi (Bij = rotated lanes at their new position), Chi, Iota.
+
+#define KECCAK_ROUND(s,rc) \
+  C0 = XOR(XOR(XOR(XOR(s[0], s[5]), s[10]), s[15]), s[20]); \
+  C1 = XOR(XOR(XOR(XOR(s[1], s[6]), s[11]), s[16]), s[21]); \
+  C2 = XOR(XOR(XOR(XOR(s[2], s[7]), s[12]), s[17]), s[22]); \
+  C3 = XOR(XOR(XOR(XOR(s[3], s[8]), s[13]), s[18]), s[23]); \
+  C4 = XOR(XOR(XOR(XOR(s[4], s[9]), s[14]), s[19]), s[24]); \
+  D0 = XOR(C4, ROL(C1, 1)); \
+  D1 = XOR(C0, ROL(C2, 1)); \
+  D2 = XOR(C1, ROL(C3, 1)); \
+  D3 = XOR(C2, ROL(C4, 1)); \
+  D4 = XOR(C3, ROL(C0, 1)); \
+  B00 = XOR(s[0], D0); \
+  B10 = ROL(XOR(s[1], D1), 1); \
+  B20 = ROL(XOR(s[2], D2), 62); \
+  B05 = ROL(XOR(s[3], D3), 28); \
+  B15 = ROL(XOR(s[4], D4), 27); \
+  B16 = ROL(XOR(s[5], D0), 36); \
+  B01 = ROL(XOR(s[6], D1), 44); \
+  B11 = ROL(XOR(s[7], D2), 6); \
+  B21 = ROL(XOR(s[8], D3), 55); \
+  B06 = ROL(XOR(s[9], D4), 20); \
+  B07 = ROL(XOR(s[10], D0), 3); \
+  B17 = ROL(XOR(s[11], D1), 10); \
+  B02 = ROL(XOR(s[12], D2), 43); \
+  B12 = ROL(XOR(s[13], D3), 25); \
+  B22 = ROL(XOR(s[14], D4), 39); \
+  B23 = ROL(XOR(s[15], D0), 41); \
+  B08 = ROL(XOR(s[16], D1), 45); \
+  B18 = ROL(XOR(s[17], D2), 15); \
+  B03 = ROL(XOR(s[18], D3), 21); \
+  B13 = ROL(XOR(s[19], D4), 8); \
+  B14 = ROL(XOR(s[20], D0), 18); \
+  B24 = ROL(XOR(s[21], D1), 2); \
+  B09 = ROL(XOR(s[22], D2), 61); \
+  B19 = ROL(XOR(s[23], D3), 56); \
+  B04 = ROL(XOR(s[24], D4), 14); \
+  s[0] = XOR(B00, ANDN(B01, B02)); \
+  s[1] = XOR(B01, ANDN(B02, B03)); \
+  s[2] = XOR(B02, ANDN(B03, B04)); \
+  s[3] = XOR(B03, ANDN(B04, B00)); \
+  s[4] = XOR(B04, ANDN(B00, B01)); \
+  s[5] = XOR(B05, ANDN(B06, B07)); \
+  s[6] = XOR(B06, ANDN(B07, B08)); \
+  s[7] = XOR(B07, ANDN(B08, B09)); \
+  s[8] = XOR(B08, ANDN(B09, B05)); \
+  s[9] = XOR(B09, ANDN(B05, B06)); \
+  s[10] = XOR(B10, ANDN(B11, B12)); \
+  s[11] = XOR(B11, ANDN(B12, B13)); \
+  s[12] = XOR(B12, ANDN(B13, B14)); \
+  s[13] = XOR(B13, ANDN(B14, B10)); \
+  s[14] = XOR(B14, ANDN(B10, B11)); \
+  s[15] = XOR(B15, ANDN(B16, B17)); \
+  s[16] = XOR(B16, ANDN(B17, B18)); \
+  s[17] = XOR(B17, ANDN(B18, B19)); \
+  s[18] = XOR(B18, ANDN(B19, B15)); \
+  s[19] = XOR(B19, ANDN(B15, B16)); \
+  s[20] = XOR(B20, ANDN(B21, B22)); \
+  s[21] = XOR(B21, ANDN(B22, B23)); \
+  s[22] = XOR(B22, ANDN(B23, B24)); \
+  s[23] = XOR(B23, ANDN(B24, B20)); \
+  s[24] = XOR(B24, ANDN(B20, B21)); \
+  s[0] = XOR(s[0], rc);
+
+// ----------------------------------------------------------------------------
+
+#define XOR(a,b) ((a) ^ (b))
+#define ANDN(a,b) (~(a) & (b))
+#define ROL(a,n) (((a) << (n)) | ((a) >> (64 - (n))))
+
+static void keccakf(uint64_t *s) {
+
+  uint64_t C0, C1, C2, C3, C4;
+  uint64_t D0, D1, D2, D3, D4;
+  uint64_t B00, B01, B02, B03, B04, B05, B06, B07, B08, B09, B10, B11, B12;
+  uint64_t B13, B14, B15, B16, B17, B18, B19, B20, B21, B22, B23, B24;
+
+  for (int r = 0; r < 24; r++) {
+    KECCAK_ROUND(s, RC[r]);
+  }
+
+}
+
+#undef XOR
+#undef ANDN
+#undef ROL
+
+// 2 states in parallel, lane j of s[i] is the word i of state j
+
+#define XOR(a,b) _mm_xor_si128(a,b)
+#define ANDN(a,b) _mm_andnot_si128(a,b)
+#define ROL(a,n) _mm_or_si128(_mm_slli_epi64(a,n), _mm_srli_epi64(a,64-(n)))
+
+static void keccakf_sse(__m128i *s) {
+
+  __m128i C0, C1, C2, C3, C4;
+  __m128i D0, D1, D2, D3, D4;
+  __m128i B00, B01, B02, B03, B04, B05, B06, B07, B08, B09, B10, B11, B12;
+  __m128i B13, B14, B15, B16, B17, B18, B19, B20, B21, B22, B23, B24;
+
+  for (int r = 0; r < 24; r++) {
+    KECCAK_ROUND(s, _mm_set1_epi64x((int64_t)RC[r]));
+  }
+
+}
+
+#undef XOR
+#undef ANDN
+#undef ROL
+
+// ----------------------------------------------------------------------------
+
+void keccak256(const uint8_t *data, size_t length, uint8_t *hash) {
+
+  uint64_t s[25];
+  uint8_t block[136];
+  memset(s, 0, sizeof(s));
+
+  // Absorb (little endian lanes)
+  while (length >= 136) {
+    memcpy(block, data, 136);
+    for (int i = 0; i < 17; i++)
+      s[i] ^= ((uint64_t *)block)[i];
+    keccakf(s);
+    data += 136;
+    length -= 136;
+  }
+
+  memset(block, 0, 136);
+  memcpy(block, data, length);
+  block[length] ^= 0x01;
+  block[135] ^= 0x80;
+  for (int i = 0; i < 17; i++)
+    s[i] ^= ((uint64_t *)block)[i];
+  keccakf(s);
+
+  memcpy(hash, s, 32);
+
+}
+
+void keccak160_64(const uint64_t *in, uint8_t *hash) {
+
+  uint64_t s[25];
+  memcpy(s, in, 64);
+  memset(s + 8, 0, 17 * 8);
+  s[8] = 0x01;
+  s[16] = 0x8000000000000000ULL;
+  keccakf(s);
+
+  // Bytes 12..31 of the hash
+  memcpy(hash, (uint8_t *)s + 12, 20);
+
+}
+
+static void keccak160sse_2(const uint64_t *i0, const uint64_t *i1, uint8_t *h0, uint8_t *h1) {
+
+#ifdef WIN64
+  __declspec(align(16)) uint64_t out[8];
+#else
+  uint64_t out[8] __attribute__((aligned(16)));
+#endif
+  __m128i s[25];
+
+  for (int i = 0; i < 8; i++)
+    s[i] = _mm_set_epi64x((int64_t)i1[i], (int64_t)i0[i]);
+  for (int i = 8; i < 25; i++)
+    s[i] = _mm_setzero_si128();
+  s[8] = _mm_set1_epi64x(0x01);
+  s[16] = _mm_set1_epi64x((int64_t)0x8000000000000000ULL);
+  keccakf_sse(s);
+
+  for (int i = 0; i < 4; i++)
+    _mm_store_si128((__m128i *)(out + 2 * i), s[i]);
+  uint64_t w0[4] = { out[0], out[2], out[4], out[6] };
+  uint64_t w1[4] = { out[1], out[3], out[5], out[7] };
+  memcpy(h0, (uint8_t *)w0 + 12, 20);
+  memcpy(h1, (uint8_t *)w1 + 12, 20);
+
+}
+
+void keccak160sse_64(const uint64_t *i0, const uint64_t *i1, const uint64_t *i2, const uint64_t *i3,
+                     uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3) {
+
+  keccak160sse_2(i0, i1, h0, h1);
+  keccak160sse_2(i2, i3, h2, h3);
+
+}
@@ -0,0 +1,32 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef KECCAK_H
+#define KECCAK_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// Keccak-256 (original padding, as used by Ethereum)
+void keccak256(const uint8_t *data, size_t length, uint8_t *hash);
+// Last 20 bytes of Keccak-256 of a 64 bytes message (8 little endian words)
+void keccak160_64(const uint64_t *in, uint8_t *hash);
+// 4 messages, SSE (2x2 lanes)
+void keccak160sse_64(const uint64_t *i0, const uint64_t *i1, const uint64_t *i2, const uint64_t *i3,
+                     uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3);
+
+#endif
@@ -18,7 +18,9 @@
 #include "Timer.h"
 #include "Vanity.h"
 #include "SECP256k1.h"
-#include <fstream>
+#include "PrefixFile.h"
+#include "Daemon.h"
+#include "VanitySearchAPI.h"
 #include <string>
 #include <string.h>
 #include <stdexcept>
@@ -37,15 +39,21 @@ void printUsage() {
   printf("             [-gpuId gpuId1[,gpuId2,...]] [-g g1x,g1y,[,g2x,g2y,...]]\n");
   printf("             [-o outputfile] [-m maxFound] [-ps seed] [-s seed] [-t nbThread]\n");
   printf("             [-nosse] [-r rekey] [-check] [-kp] [-sp startPubKey]\n");
-  printf("             [-rp privkey partialkeyfile] [prefix]\n\n");
+  printf("             [-rp privkey partialkeyfile] [-gt nbBit] [-gtc file]\n");
+  printf("             [-compile-prefixes inputfile dbfile] [-daemon] [-daemon-socket file]\n");
+  printf("             [-hrp hrp]\n");
+  printf("             [prefix]\n\n");
   printf(" prefix: prefix to search (Can contains wildcard '?' or '*')\n");
+  printf("         Patterns ending with a literal (e.g. 1*Cafe) are filtered on their last\n");
+  printf("         characters without encoding the address (CPU)\n");
   printf(" -v: Print version\n");
   printf(" -u: Search uncompressed addresses\n");
   printf(" -b: Search both uncompressed or compressed addresses\n");
   printf(" -c: Case unsensitive search\n");
+  printf(" -hrp hrp: Human readable part of x-only public key prefixes (hrp1...), default is npub\n");
   printf(" -gpu: Enable gpu calculation\n");
   printf(" -stop: Stop when all prefixes are found\n");
-  printf(" -i inputfile: Get list of prefixes to search from specified file\n");
+  printf(" -i inputfile: Get list of prefixes to search from specified file or prefix database\n");
   printf(" -o outputfile: Output results to the specified file\n");
   printf(" -gpu gpuId1,gpuId2,...: List of GPU(s) to use, default is 0\n");
   printf(" -g g1x,g1y,g2x,g2y, ...: Specify GPU(s) kernel gridsize, default is 8*(MP number),128\n");
@@ -62,6 +70,13 @@ void printUsage() {
   printf(" -rp privkey partialkeyfile: Reconstruct final private key(s) from partial key(s) info.\n");
   printf(" -sp startPubKey: Start the search with a pubKey (for private key splitting)\n");
   printf(" -r rekey: Rekey interval in MegaKey, default is disabled\n");
+  printf(" -gt nbBit: Generator table window size in bits [%d..%d], default is %d\n",
+         GTABLE_MIN_WBITS, GTABLE_MAX_WBITS, GTABLE_DEF_WBITS);
+  printf(" -gtc file: Load generator table from file (mapped), create it if needed\n");
+  printf(" -compile-prefixes inputfile dbfile: Compile a prefix list to a database usable with -i\n");
+  printf(" -daemon: Process search orders (JSON lines) from stdin, results on stdout\n");
+  printf("          CPU orders are searched concurrently (priority, weight)\n");
+  printf(" -daemon-socket file: Process search orders from a unix socket\n");
   exit(0);
 
 }
@@ -117,47 +132,20 @@ void getInts(string name,vector<int> &tokens, const string &text, char sep) {
 
 // ------------------------------------------------------------------------------------------
 
-void parseFile(string fileName, vector<string> &lines) {
+// Number of values following an option (same as the argument parser in main())
+int getNbValue(char *opt) {
 
-  // Get file size
-  FILE *fp = fopen(fileName.c_str(), "rb");
-  if (fp == NULL) {
-    printf("Error: Cannot open %s %s\n", fileName.c_str(), strerror(errno));
-    exit(-1);
-  }
-  fseek(fp, 0L, SEEK_END);
-  size_t sz = ftell(fp);
-  size_t nbAddr = sz / 33; /* Upper approximation */
-  bool loaddingProgress = sz > 100000;
-  fclose(fp);
-
-  // Parse file
-  int nbLine = 0;
-  string line;
-  ifstream inFile(fileName);
-  lines.reserve(nbAddr);
-  while (getline(inFile, line)) {
-
-    // Remove ending \r\n
-    int l = (int)line.length() - 1;
-    while (l >= 0 && isspace(line.at(l))) {
-      line.pop_back();
-      l--;
-    }
+  const char *opt1[] = { "-gpuId","-sp","-ca","-cp","-g","-s","-ps","-o","-hrp","-i",
+                         "-daemon-socket","-t","-m","-r","-gt","-gtc" };
+  const char *opt2[] = { "-rp","-compile-prefixes" };
 
-    if (line.length() > 0) {
-      lines.push_back(line);
-      nbLine++;
-      if (loaddingProgress) {
-        if ((nbLine % 50000) == 0)
-          printf("[Loading input file %5.1f%%]\r", ((double)nbLine*100.0) / ((double)(nbAddr)*33.0 / 34.0));
-      }
-    }
-
-  }
-
-  if (loaddingProgress)
-    printf("[Loading input file 100.0%%]\n");
+  for (int i = 0; i < (int)(sizeof(opt1) / sizeof(opt1[0])); i++)
+    if (strcmp(opt, opt1[i]) == 0)
+      return 1;
+  for (int i = 0; i < (int)(sizeof(opt2) / sizeof(opt2[0])); i++)
+    if (strcmp(opt, opt2[i]) == 0)
+      return 2;
+  return 0;
 
 }
 
@@ -235,16 +223,6 @@ void outputAdd(string outputFile, int addrType, string addr, string pAddr, strin
 }
 
 // ------------------------------------------------------------------------------------------
-#define CHECK_ADDR()                                           \
-  fullPriv.ModAddK1order(&e, &partialPrivKey);                 \
-  p = secp->ComputePublicKey(&fullPriv);                       \
-  cAddr = secp->GetAddress(addrType, compressed, p);           \
-  if (cAddr == addr) {                                         \
-    found = true;                                              \
-    string pAddr = secp->GetPrivAddress(compressed, fullPriv); \
-    string pAddrHex = fullPriv.GetBase16();                    \
-    outputAdd(outputFile, addrType, addr, pAddr, pAddrHex);    \
-  }
 
 void reconstructAdd(Secp256K1 *secp, string fileName, string outputFile, string privAddr) {
 
@@ -259,17 +237,23 @@ void reconstructAdd(Secp256K1 *secp, string fileName, string outputFile, string
   if(privKey.IsNegative())
     exit(-1);
 
-  vector<string> lines;
-  parseFile(fileName,lines);
+  vector<char *> lines;
+  string error;
+  void *map;
+  size_t size;
+  if (!PrefixFile::Load(fileName, lines, &map, &size, error)) {
+    printf("Error: %s\n", error.c_str());
+    exit(-1);
+  }
 
   for (int i = 0; i < (int)lines.size(); i+=2) {
 
     string addr;
     string partialPrivAddr;
 
-    if (lines[i].substr(0, 12) == "PubAddress: ") {
+    if (strncmp(lines[i], "PubAddress: ", 12) == 0) {
 
-      addr = lines[i].substr(12);
+      addr = string(lines[i] + 12);
 
       switch (addr.data()[0]) {
       case '1':
@@ -279,6 +263,8 @@ void reconstructAdd(Secp256K1 *secp, string fileName, string outputFile, string
       case 'b':
       case 'B':
         addrType = BECH32; break;
+      case '0':
+        addrType = ETH; break;
       default:
         printf("Invalid partialkey info file at line %d\n", i);
         printf("%s Address format not supported\n", addr.c_str());
@@ -290,8 +276,8 @@ void reconstructAdd(Secp256K1 *secp, string fileName, string outputFile, string
       exit(-1);
     }
 
-    if (lines[i+1].substr(0, 13) == "PartialPriv: ") {
-      partialPrivAddr = lines[i+1].substr(13);
+    if (strncmp(lines[i+1], "PartialPriv: ", 13) == 0) {
+      partialPrivAddr = string(lines[i+1] + 13);
     } else {
       printf("Invalid partialkey info file at line %d (\"PartialPriv: \" expected)\n", i);
       exit(-1);
@@ -312,45 +298,39 @@ void reconstructAdd(Secp256K1 *secp, string fileName, string outputFile, string
     } else {
 
       // Reconstruct the address
-      Int fullPriv;
-      Point p;
-      Int e;
-      string cAddr;
+      // Candidates: no sym, endo 0/1/2 then sym, endo 0/1/2
+      Int e[6];
+      Int fullPriv[6];
+      Point p[6];
       bool found = false;
 
-      // No sym, no endo
-      e.Set(&privKey);
-      CHECK_ADDR();
-
-      // No sym, endo 1
-      e.Set(&privKey);
-      e.ModMulK1order(&lambda);
-      CHECK_ADDR();
-
-      // No sym, endo 2
-      e.Set(&privKey);
-      e.ModMulK1order(&lambda2);
-      CHECK_ADDR();
-
-      // sym, no endo
-      e.Set(&privKey);
-      e.Neg();
-      e.Add(&secp->order);
-      CHECK_ADDR();
-
-      // sym, endo 1
-      e.Set(&privKey);
-      e.ModMulK1order(&lambda);
-      e.Neg();
-      e.Add(&secp->order);
-      CHECK_ADDR();
-
-      // sym, endo 2
-      e.Set(&privKey);
-      e.ModMulK1order(&lambda2);
-      e.Neg();
-      e.Add(&secp->order);
-      CHECK_ADDR();
+      e[0].Set(&privKey);
+      e[1].Set(&privKey);
+      e[1].ModMulK1order(&lambda);
+      e[2].Set(&privKey);
+      e[2].ModMulK1order(&lambda2);
+      for (int j = 0; j < 3; j++) {
+        e[j + 3].Set(&e[j]);
+        e[j + 3].Neg();
+        e[j + 3].Add(&secp->order);
+      }
+      for (int j = 0; j < 6; j++)
+        fullPriv[j].ModAddK1order(&e[j], &partialPrivKey);
+
+      // All candidates are normalized with a single ModInv
+      secp->ComputePublicKeys(6, fullPriv, p);
+
+      for (int j = 0; j < 6; j++) {
+        string cAddr = secp->GetAddress(addrType, compressed, p[j]);
+        if (addrType == ETH)
+          cAddr = Secp256K1::GetEIP55Address(cAddr);
+        if (cAddr == addr) {
+          found = true;
+          string pAddr = secp->GetPrivAddress(compressed, fullPriv[j]);
+          string pAddrHex = fullPriv[j].GetBase16();
+          outputAdd(outputFile, addrType, addr, pAddr, pAddrHex);
+        }
+      }
 
       if (!found) {
         printf("Unable to reconstruct final key from partialkey line %d\n Addr: %s\n PartKey: %s\n",
@@ -367,13 +347,26 @@ void reconstructAdd(Secp256K1 *secp, string fileName, string outputFile, string
 
 int main(int argc, char* argv[]) {
 
-  // Global Init
-  Timer::Init();
-  rseed(Timer::getSeed32());
+  // Generator table options are needed before any key computation
+  int gTableBits = GTABLE_DEF_WBITS;
+  string gTableFile = "";
+  // Option values are skipped (e.g. -o -gt)
+  for (int i = 1; i < argc - 1; i += 1 + getNbValue(argv[i])) {
+    if (strcmp(argv[i], "-gt") == 0) {
+      gTableBits = getInt("gTableBits", argv[i + 1]);
+    } else if (strcmp(argv[i], "-gtc") == 0) {
+      gTableFile = string(argv[i + 1]);
+    }
+  }
 
-  // Init SecpK1
-  Secp256K1 *secp = new Secp256K1();
-  secp->Init();
+  // Global Init (libvanitysearch)
+  if (vs_init(gTableBits, gTableFile.c_str()) != VS_OK) {
+    printf("Error: %s\n", vs_last_error(NULL));
+    exit(-1);
+  }
+  Secp256K1 *secp = vs_secp();
+  vs_context *ctx = vs_create();
+  vs_set_verbose(ctx, 1);
 
   // Browse arguments
   if (argc < 2) {
@@ -388,18 +381,18 @@ int main(int argc, char* argv[]) {
   vector<int> gpuId = {0};
   vector<int> gridSize;
   string seed = "";
-  vector<string> prefix;
+  string compileFile = "";
   string outputFile = "";
   int nbCPUThread = Timer::getCoreNumber();
   bool tSpecified = false;
   bool sse = true;
   uint32_t maxFound = 65536;
   uint64_t rekey = 0;
-  Point startPuKey;
-  startPuKey.Clear();
-  bool startPubKeyCompressed;
   bool caseSensitive = true;
+  string hrp = "npub";
   bool paranoiacSeed = false;
+  bool daemon = false;
+  string daemonSocket = "";
 
   while (a < argc) {
 
@@ -422,6 +415,7 @@ int main(int argc, char* argv[]) {
     } else if (strcmp(argv[a], "-check") == 0) {
 
       Int::Check();
+      FieldK1::Check();
       secp->Check();
 
 #ifdef WITHGPU
@@ -450,8 +444,10 @@ int main(int argc, char* argv[]) {
       exit(0);
     } else if (strcmp(argv[a], "-sp") == 0) {
       a++;
-      string pub = string(argv[a]);
-      startPuKey = secp->ParsePublicKeyHex(pub, startPubKeyCompressed);
+      if (vs_set_split_key(ctx, argv[a]) != VS_OK) {
+        printf("Error: %s %s\n", vs_last_error(ctx), argv[a]);
+        exit(-1);
+      }
       a++;
     } else if(strcmp(argv[a],"-ca") == 0) {
       a++;
@@ -513,9 +509,33 @@ int main(int argc, char* argv[]) {
       a++;
       outputFile = string(argv[a]);
       a++;
+    } else if (strcmp(argv[a], "-hrp") == 0) {
+      a++;
+      hrp = string(argv[a]);
+      a++;
     } else if (strcmp(argv[a], "-i") == 0) {
       a++;
-      parseFile(string(argv[a]),prefix);
+      if (vs_load_prefixes(ctx, argv[a]) != VS_OK) {
+        printf("Error: %s\n", vs_last_error(ctx));
+        exit(-1);
+      }
+      a++;
+    } else if (strcmp(argv[a], "-compile-prefixes") == 0) {
+      a++;
+      if (vs_load_prefixes(ctx, argv[a]) != VS_OK) {
+        printf("Error: %s\n", vs_last_error(ctx));
+        exit(-1);
+      }
+      a++;
+      compileFile = string(argv[a]);
+      a++;
+    } else if (strcmp(argv[a], "-daemon") == 0) {
+      daemon = true;
+      a++;
+    } else if (strcmp(argv[a], "-daemon-socket") == 0) {
+      a++;
+      daemon = true;
+      daemonSocket = string(argv[a]);
       a++;
     } else if (strcmp(argv[a], "-t") == 0) {
       a++;
@@ -530,10 +550,13 @@ int main(int argc, char* argv[]) {
       a++;
       rekey = (uint64_t)getInt("rekey", argv[a]);
       a++;
+    } else if (strcmp(argv[a], "-gt") == 0 || strcmp(argv[a], "-gtc") == 0) {
+      // Already handled
+      a += 2;
     } else if (strcmp(argv[a], "-h") == 0) {
       printUsage();
     } else if (a == argc - 1) {
-      prefix.push_back(string(argv[a]));
+      vs_add_prefix(ctx, argv[a]);
       a++;
     } else {
       printf("Unexpected %s argument\n",argv[a]);
@@ -542,7 +565,8 @@ int main(int argc, char* argv[]) {
 
   }
 
-  printf("VanitySearch v" RELEASE "\n");
+  // Daemon on stdin: stdout is for results only
+  fprintf(daemon ? stderr : stdout, "VanitySearch v" RELEASE "\n");
 
   if(gridSize.size()==0) {
     for (int i = 0; i < gpuId.size(); i++) {
@@ -561,14 +585,33 @@ int main(int argc, char* argv[]) {
   if(nbCPUThread<0)
     nbCPUThread = 0;
 
-  // If a starting public key is specified, force the search mode according to the key
-  if (!startPuKey.isZero()) {
-    searchMode = (startPubKeyCompressed)?SEARCH_COMPRESSED:SEARCH_UNCOMPRESSED;
+  if (daemon) {
+    Daemon *d = new Daemon(secp, searchMode, gpuEnable, gpuId, gridSize, nbCPUThread, sse, maxFound, paranoiacSeed);
+    d->Run(daemonSocket);
+    delete d;
+    vs_destroy(ctx);
+    return 0;
   }
 
-  VanitySearch *v = new VanitySearch(secp, prefix, seed, searchMode, gpuEnable, stop, outputFile, sse,
-    maxFound, rekey, caseSensitive, startPuKey, paranoiacSeed);
-  v->Search(nbCPUThread,gpuId,gridSize);
+  // If a starting public key is specified, the search mode is given by the key
+  vs_set_search_mode(ctx, searchMode);
+  vs_set_case_sensitive(ctx, caseSensitive);
+  vs_set_hrp(ctx, hrp.c_str());
+  vs_set_stop_when_found(ctx, stop);
+  vs_set_seed(ctx, seed.c_str(), paranoiacSeed);
+  vs_set_output_file(ctx, outputFile.c_str());
+  vs_set_max_found(ctx, maxFound);
+  vs_set_rekey(ctx, rekey);
+  vs_set_sse(ctx, sse);
+
+  if (compileFile.length() > 0) {
+    if (vs_save_prefixes(ctx, compileFile.c_str()) != VS_OK)
+      exit(-1);
+    exit(0);
+  }
+
+  if (vs_search(ctx, nbCPUThread, gpuId.data(), gridSize.data(), gpuEnable ? (int)gpuId.size() : 0) != VS_OK)
+    exit(-1);
 
   return 0;
 }